@@ -20,3 +20,38 @@ test('init, version and clean dispose', async () => {
 });
 
 
+test('native executor is configurable and reports metrics', async () => {
+  let config: ConfigParamsCloud = {
+    blockAllNetworkAccess: true
+  };
+
+  let app = await createJabraApplication('A7tSsfD42VenLagL2mM6i2f0VafP/842cbuPCnC+uE8=', config, false, { sdkExecutorThreadCount: 2 });
+
+  await app.getSDKVersionAsync();
+
+  let metrics = await app.getNativeMetricsAsync();
+  expect(metrics.executor.threadCount).toBeGreaterThanOrEqual(2);
+  expect(metrics.executor.completed).toBeGreaterThanOrEqual(1);
+  expect(metrics.executor.stuckCalls).toEqual([]);
+  expect(metrics.workerPool.hits + metrics.workerPool.misses).toBeGreaterThanOrEqual(1);
+  expect(metrics.events.delivered).toBeGreaterThanOrEqual(1); // At least the initialization result.
+
+  await app.disposeAsync();
+});
+
+
+test('calls with an aborted signal are rejected without being run', async () => {
+  let config: ConfigParamsCloud = {
+    blockAllNetworkAccess: true
+  };
+
+  let app = await createJabraApplication('A7tSsfD42VenLagL2mM6i2f0VafP/842cbuPCnC+uE8=', config);
+
+  const abortedSignal = { aborted: true, addEventListener: () => {}, removeEventListener: () => {} };
+  await expect(app.getSDKVersionAsync({ signal: abortedSignal })).rejects.toHaveProperty('name', 'AbortError');
+
+  // Generous timeout does not affect normal calls:
+  expect(await app.getSDKVersionAsync({ timeoutMs: 60000 })).toBeTruthy();
+
+  await app.disposeAsync();
+});
@@ -1,15 +1,17 @@
 {
   "variables": {
+    # Set with "node-gyp rebuild --build_benchmarks=true" to also build the native microbenchmarks.
+    "build_benchmarks%": "false",
+    # Set with "node-gyp rebuild --build_tests=true" to also build the native tests (see src/test).
+    "build_tests%": "false",
     "conditions": [
       ["OS=='win' and target_arch=='ia32'", {
         "jabralibfolder": "libjabra/windows/x86",
-        "jabralibfile": "libjabra.dll",
-        "jabraliblibrary": "libjabra.lib"
+        "jabralibfile": "libjabra.dll"
       }],
       ["OS=='win' and target_arch=='x64'", {
         "jabralibfolder": "libjabra/windows/x64",
-        "jabralibfile": "libjabra.dll",
-        "jabraliblibrary": "libjabra.lib"
+        "jabralibfile": "libjabra.dll"
       }],
       ["OS=='mac'", {
         "jabralibfolder": "libjabra/mac",
@@ -47,17 +49,16 @@
         "includes",
         "<!@(node -p \"require('node-addon-api').include\")",
       ],
-      'defines': [ 'NAPI_CPP_EXCEPTIONS' ],
-      'link_settings': {
-         'library_dirs': [
-            '.',
-          ],
-      },
+      # libjabra is not linked but loaded on first use from next to the addon (see src/main/jabralib.h):
+      'defines': [ 'NAPI_CPP_EXCEPTIONS', 'JABRA_LIBRARY_FILE="<(jabralibfile)"' ],
       'conditions': [
+        ["build_benchmarks=='true'", {
+          "sources": [ "src/benchmark/settings-conversion.cc" ],
+          'defines': [ 'BUILD_BENCHMARKS' ],
+        }],
         ['OS=="win"', {
           'conditions': [
             ['target_arch=="ia32"', {
-              'libraries': [ '<(jabralibfolder)/<(jabraliblibrary)' ],
               "copies":
               [
                   {
@@ -67,7 +68,6 @@
               ]
             }],
             ['target_arch=="x64"', {
-              'libraries': [ '<(jabralibfolder)/<(jabraliblibrary)' ],
               "copies":
               [
                   {
@@ -83,10 +83,7 @@
           },
         }],
         ['OS=="linux"', {
-          'libraries': [ "../<(jabralibfolder)/<(jabralibfile)" ],
-          'ldflags': [
-            "-Wl,-rpath,'$$ORIGIN'"
-          ],
+          'libraries': [ '-ldl' ],
           'cflags_cc': [
             '-fexceptions',
             '-Wno-unused-variable'
@@ -100,7 +97,6 @@
           ],
         }],
         ['OS=="mac"', {
-         'libraries': [ '../<(jabralibfolder)/<(jabralibfile)' ],
          'xcode_settings': {
            'ld_version_details': 'true',
            'GCC_ENABLE_CPP_EXCEPTIONS': 'YES',
@@ -122,21 +118,79 @@
               'destination': '<(PRODUCT_DIR)',
               'files': ['<(module_root_dir)/<(jabralibfolder)/<(jabralibfile)']
             }
-         ],
-         'postbuilds': [
-          {
-            'postbuild_name': 'fix relative dylib lookup',
-            'action': [
-              'install_name_tool',
-              '-change',
-              '@rpath/libjabra.dylib',
-              '@loader_path/libjabra.dylib',
-              '${BUILT_PRODUCTS_DIR}/sdkintegration.node',
-            ],
-          },
          ]
         }],
       ]
     }
+  ],
+  "conditions": [
+    ["build_benchmarks=='true'", {
+      "targets": [
+        {
+          "target_name": "worker_allocations_benchmark",
+          "type": "executable",
+          "sources": [ "src/benchmark/worker-allocations.cc" ],
+          "cflags_cc": [
+            "-std=c++14",
+            "-fexceptions"
+          ],
+          'xcode_settings': {
+            'GCC_ENABLE_CPP_EXCEPTIONS': 'YES',
+            'CLANG_CXX_LIBRARY': 'libc++',
+            'MACOSX_DEPLOYMENT_TARGET': '10.7',
+          },
+          'msvs_settings': {
+            'VCCLCompilerTool': { 'ExceptionHandling': 1 },
+          },
+        }
+      ]
+    }],
+    ["build_tests=='true'", {
+      "targets": [
+        {
+          "target_name": "mpscring_test",
+          "type": "executable",
+          "sources": [ "src/test/mpscring.cc" ],
+          "cflags_cc": [
+            "-std=c++14",
+            "-fexceptions",
+            "-pthread"
+          ],
+          "ldflags": [ "-pthread" ],
+          'xcode_settings': {
+            'GCC_ENABLE_CPP_EXCEPTIONS': 'YES',
+            'CLANG_CXX_LIBRARY': 'libc++',
+            'MACOSX_DEPLOYMENT_TARGET': '10.7',
+          },
+          'msvs_settings': {
+            'VCCLCompilerTool': { 'ExceptionHandling': 1 },
+          },
+        },
+        {
+          "target_name": "metadatafile_test",
+          "type": "executable",
+          "sources": [ "src/test/metadatafile.cc", "src/main/metadatafile.cc" ],
+          "cflags_cc": [
+            "-std=c++14",
+            "-fexceptions"
+          ],
+          # The napi and libjabra headers are only needed for their types:
+          "include_dirs": [
+            "libjabra/headers",
+            "includes",
+            "<!@(node -p \"require('node-addon-api').include\")",
+          ],
+          'defines': [ 'NAPI_CPP_EXCEPTIONS' ],
+          'xcode_settings': {
+            'GCC_ENABLE_CPP_EXCEPTIONS': 'YES',
+            'CLANG_CXX_LIBRARY': 'libc++',
+            'MACOSX_DEPLOYMENT_TARGET': '10.7',
+          },
+          'msvs_settings': {
+            'VCCLCompilerTool': { 'ExceptionHandling': 1 },
+          },
+        }
+      ]
+    }]
   ]
 }
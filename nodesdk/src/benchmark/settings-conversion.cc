@@ -0,0 +1,235 @@
+/**
+ * Benchmark of converting DeviceSettings to javascript objects (see toNodeType in settings.cc) for a synthetic
+ * device with many settings, comparing:
+ *
+ * - "legacy": As toNodeType did before, i.e. a new key string and a Set call for every property.
+ * - "interned": toNodeType itself, using the shared PropertyKeys and defining all properties of an object at once.
+ * - "values": toNapiSettingValues, i.e. only the current values (as GetSettingValues returns them), for javascript
+ *   holding on to the schema.
+ *
+ * Only compiled into the addon with "node-gyp rebuild --build_benchmarks=true". Run with
+ * "npm run benchmark-settings-conversion" (see src/manualtest/settings-conversion-benchmark.ts).
+ */
+
+#include "../main/settings.h"
+#include "../main/napiutil.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+
+/**
+ * DeviceSettings with 'count' settings similar to those of a real device, owning all its memory.
+ */
+class SyntheticDeviceSettings {
+  public:
+    explicit SyntheticDeviceSettings(unsigned int count) : settingInfos(count), listKeyValues(count * LIST_SIZE),
+      dependents(count * LIST_SIZE), validationRules(count), byteValues(count) {
+      for (unsigned int i = 0; i < count; ++i) {
+        SettingInfo& setting = settingInfos[i];
+        const std::string id = std::to_string(i);
+        const bool isStringSetting = (i % 5) == 0;
+
+        setting.guid = text("a8f4c2d1-0b3e-4f6a-9c7d-" + id);
+        setting.name = text("Setting " + id);
+        setting.helpText = text("Help text explaining what setting " + id + " does on the device.");
+        setting.settingDataType = isStringSetting ? DataType::settingString : DataType::settingByte;
+        byteValues[i] = (uint8_t)(i % LIST_SIZE);
+        setting.currValue = isStringSetting ? (void *)text("Value " + id) : (void *)&byteValues[i];
+        setting.cntrlType = isStringSetting ? ControlType::cntrlTextBox : ControlType::cntrlComboBox;
+        setting.groupName = text("Group " + std::to_string(i / 20));
+        setting.groupHelpText = text("Settings in group " + std::to_string(i / 20));
+        setting.isValidationSupport = isStringSetting;
+        setting.validationRule = isStringSetting ? &validationRules[i] : nullptr;
+        validationRules[i].minLength = 0;
+        validationRules[i].maxLength = 64;
+        validationRules[i].regExp = text("^[a-zA-Z0-9 ]*$");
+        validationRules[i].errorMessage = text("Only letters, digits and spaces");
+        setting.isDepedentsetting = (i % 3) == 0;
+        setting.dependentDefaultValue = setting.isDepedentsetting ? setting.currValue : nullptr;
+
+        setting.listSize = isStringSetting ? 0 : LIST_SIZE;
+        setting.listKeyValue = isStringSetting ? nullptr : &listKeyValues[i * LIST_SIZE];
+        for (int j = 0; j < setting.listSize; ++j) {
+          ListKeyValue& keyValue = setting.listKeyValue[j];
+          keyValue.key = (unsigned short)j;
+          keyValue.value = text("Option " + std::to_string(j));
+          keyValue.dependentcount = setting.isDepedentsetting ? 1 : 0;
+          keyValue.dependents = &dependents[i * LIST_SIZE + j];
+          keyValue.dependents->GUID = setting.guid;
+          keyValue.dependents->enableFlag = (j % 2) == 0;
+        }
+      }
+
+      settings.settingCount = count;
+      settings.settingInfo = count > 0 ? &settingInfos[0] : nullptr;
+      settings.errStatus = NoError;
+    }
+
+    DeviceSettings * get() {
+      return &settings;
+    }
+
+  private:
+    static const int LIST_SIZE = 4;
+
+    char * text(const std::string& value) {
+      texts.push_back(value);
+      return &texts.back()[0];
+    }
+
+    DeviceSettings settings;
+    std::vector<SettingInfo> settingInfos;
+    std::vector<ListKeyValue> listKeyValues;
+    std::vector<DependencySetting> dependents;
+    std::vector<ValidationRule> validationRules;
+    std::vector<uint8_t> byteValues;
+    std::deque<std::string> texts; // Stable addresses.
+};
+
+/**
+ * The conversion as done before PropertyKeys and ObjectBuilder, for comparison.
+ */
+static void legacyToNodeType(DeviceSettings *src, Napi::Object& dest) {
+  Napi::Env env = dest.Env();
+
+  Napi::Array settings = Napi::Array::New(env, src->settingCount);
+  for (unsigned int i=0; i<src->settingCount; ++i) {
+    SettingInfo& settingSrc = src->settingInfo[i];
+    Napi::Object settingDst = Napi::Object::New(env);
+
+    settingDst.Set(Napi::String::New(env, "guid"), Napi::String::New(env, settingSrc.guid ? settingSrc.guid : ""));
+    settingDst.Set(Napi::String::New(env, "name"), Napi::String::New(env, settingSrc.name ? settingSrc.name : ""));
+    settingDst.Set(Napi::String::New(env, "helpText"), Napi::String::New(env, settingSrc.helpText ? settingSrc.helpText : ""));
+    settingDst.Set(Napi::String::New(env, "isValidationSupport"), Napi::Boolean::New(env, settingSrc.isValidationSupport));
+
+    ValidationRule *validationRuleSrc = settingSrc.validationRule;
+    if (validationRuleSrc) {
+       Napi::Object validationRuleDst = Napi::Object::New(env);
+       validationRuleDst.Set(Napi::String::New(env, "minLength"), Napi::Number::New(env, validationRuleSrc->minLength));
+       validationRuleDst.Set(Napi::String::New(env, "maxLength"), Napi::Number::New(env, validationRuleSrc->maxLength));
+       validationRuleDst.Set(Napi::String::New(env, "errorMessage"), Napi::String::New(env, validationRuleSrc->errorMessage ? validationRuleSrc->errorMessage : ""));
+       validationRuleDst.Set(Napi::String::New(env, "regExp"), Napi::String::New(env, validationRuleSrc->regExp ? validationRuleSrc->regExp : ""));
+       settingDst.Set(Napi::String::New(env, "validationRule"), validationRuleDst);
+    }
+
+    settingDst.Set(Napi::String::New(env, "isDeviceRestart"), Napi::Boolean::New(env, settingSrc.isDeviceRestart));
+    settingDst.Set(Napi::String::New(env, "isSettingProtected"), Napi::Boolean::New(env, settingSrc.isSettingProtected));
+    settingDst.Set(Napi::String::New(env, "isSettingProtectionEnabled"), Napi::Boolean::New(env, settingSrc.isSettingProtectionEnabled));
+    settingDst.Set(Napi::String::New(env, "isWirelessConnect"), Napi::Boolean::New(env, settingSrc.isWirelessConnect));
+    settingDst.Set(Napi::String::New(env, "cntrlType"), Napi::Number::New(env, settingSrc.cntrlType));
+    settingDst.Set(Napi::String::New(env, "settingDataType"), Napi::Number::New(env, settingSrc.settingDataType));
+
+    if (settingSrc.currValue) {
+      if (settingSrc.settingDataType == DataType::settingByte) {
+        settingDst.Set(Napi::String::New(env, "currValue"), Napi::Number::New(env, *((uint8_t *)settingSrc.currValue)));
+      } else if (settingSrc.settingDataType == DataType::settingString) {
+        settingDst.Set(Napi::String::New(env, "currValue"), Napi::String::New(env, (char *)settingSrc.currValue));
+      }
+    }
+
+    settingDst.Set(Napi::String::New(env, "groupName"), Napi::String::New(env, settingSrc.groupName ? settingSrc.groupName : ""));
+    settingDst.Set(Napi::String::New(env, "groupHelpText"), Napi::String::New(env, settingSrc.groupHelpText ? settingSrc.groupHelpText : ""));
+    settingDst.Set(Napi::String::New(env, "isDepedentsetting"), Napi::Boolean::New(env, settingSrc.isDepedentsetting));
+    settingDst.Set(Napi::String::New(env, "isPCsetting"), Napi::Boolean::New(env, settingSrc.isPCsetting));
+    settingDst.Set(Napi::String::New(env, "isChildDeviceSetting"), Napi::Boolean::New(env, settingSrc.isChildDeviceSetting));
+
+    if (settingSrc.dependentDefaultValue) {
+      if (settingSrc.settingDataType == DataType::settingByte) {
+        settingDst.Set(Napi::String::New(env, "dependentDefaultValue"), Napi::Number::New(env, *((uint8_t *)settingSrc.dependentDefaultValue)));
+      } else if (settingSrc.settingDataType == DataType::settingString) {
+        settingDst.Set(Napi::String::New(env, "dependentDefaultValue"), Napi::String::New(env, (char *)settingSrc.dependentDefaultValue));
+      }
+    }
+
+    Napi::Array keyValueList = Napi::Array::New(env, settingSrc.listSize);
+    settingDst.Set(Napi::String::New(env, "listSize"), Napi::Number::New(env, settingSrc.listSize));
+    for (int j=0; j< settingSrc.listSize; ++j) {
+      ListKeyValue& listKeyValueSrc = settingSrc.listKeyValue[j];
+      Napi::Object listKeyValueDst = Napi::Object::New(env);
+      listKeyValueDst.Set(Napi::String::New(env, "key"), Napi::Number::New(env, listKeyValueSrc.key));
+      if (listKeyValueSrc.value) {
+        listKeyValueDst.Set(Napi::String::New(env, "value"), Napi::String::New(env, (char *)listKeyValueSrc.value));
+      }
+      listKeyValueDst.Set(Napi::String::New(env, "dependentcount"), Napi::Number::New(env, listKeyValueSrc.dependentcount));
+
+      Napi::Array dependenciesList = Napi::Array::New(env, listKeyValueSrc.dependentcount);
+      for (int k=0; k< listKeyValueSrc.dependentcount; ++k) {
+        DependencySetting& dependencySettingSrc = listKeyValueSrc.dependents[k];
+        Napi::Object dependencySettingDst = Napi::Object::New(env);
+        dependencySettingDst.Set(Napi::String::New(env, "GUID"), Napi::String::New(env, dependencySettingSrc.GUID ? dependencySettingSrc.GUID : ""));
+        dependencySettingDst.Set(Napi::String::New(env, "enableFlag"), Napi::Boolean::New(env, dependencySettingSrc.enableFlag));
+        dependenciesList.Set(k, dependencySettingDst);
+      }
+
+      listKeyValueDst.Set(Napi::String::New(env, "dependents"), dependenciesList);
+      keyValueList.Set(j, listKeyValueDst);
+    }
+
+    settingDst.Set(Napi::String::New(env, "listKeyValue"), keyValueList);
+    settings.Set(i, settingDst);
+  }
+
+  dest.Set(Napi::String::New(env, "errStatus"), Napi::Number::New(env, src->errStatus));
+  dest.Set(Napi::String::New(env, "settingInfo"), settings);
+}
+
+/**
+ * BenchmarkSettingsConversion(settingCount, iterations, legacy) converts a synthetic DeviceSettings object
+ * 'iterations' times and returns the last result (for comparing the output of both conversions).
+ */
+Napi::Value napi_BenchmarkSettingsConversion(const Napi::CallbackInfo& info) {
+  const char * const functionName = __func__;
+  Napi::Env env = info.Env();
+
+  if (!util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::BOOLEAN})) {
+    return env.Undefined();
+  }
+
+  const unsigned int settingCount = info[0].As<Napi::Number>().Uint32Value();
+  const unsigned int iterations = info[1].As<Napi::Number>().Uint32Value();
+  const bool legacy = info[2].As<Napi::Boolean>().Value();
+
+  SyntheticDeviceSettings settings(settingCount);
+  auto convert = [&settings, legacy, env]() {
+    Napi::Object converted = Napi::Object::New(env);
+    if (legacy) {
+      legacyToNodeType(settings.get(), converted);
+    } else {
+      toNodeType(0, settings.get(), converted);
+    }
+    return converted;
+  };
+
+  for (unsigned int i = 1; i < iterations; ++i) {
+    Napi::HandleScope scope(env);
+    convert();
+  }
+  return convert();
+}
+
+/**
+ * BenchmarkSettingValuesConversion(settingCount, iterations) converts the current values of a synthetic
+ * DeviceSettings object 'iterations' times and returns the last result.
+ */
+Napi::Value napi_BenchmarkSettingValuesConversion(const Napi::CallbackInfo& info) {
+  const char * const functionName = __func__;
+  Napi::Env env = info.Env();
+
+  if (!util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER})) {
+    return env.Undefined();
+  }
+
+  const unsigned int settingCount = info[0].As<Napi::Number>().Uint32Value();
+  const unsigned int iterations = info[1].As<Napi::Number>().Uint32Value();
+
+  SyntheticDeviceSettings settings(settingCount);
+  SettingSchema schema = SettingSchema::fromDeviceSettings(*settings.get());
+  schema.revision = 1;
+
+  for (unsigned int i = 1; i < iterations; ++i) {
+    Napi::HandleScope scope(env);
+    toNapiSettingValues(env, schema, *settings.get());
+  }
+  return toNapiSettingValues(env, schema, *settings.get());
+}
@@ -0,0 +1,160 @@
+/**
+ * Microbenchmark comparing heap allocations and time per call of the two ways async workers store their
+ * callables (see napiutil.h):
+ *
+ * - "std::function": As JAsyncWorker and the high-level helpers did before, i.e. work, mapper and cleanup
+ *   wrapped in std::function's and the device id bound with std::bind.
+ * - "template": As BasicJAsyncWorker created with MakeJAsyncWorker, i.e. callables stored by value with
+ *   their types as template parameters.
+ *
+ * The workers mirror the napiutil.h layout, but napi and libjabra are stubbed out, so the benchmark can be
+ * built and run without node. Build and run with "npm run benchmark-worker-allocations".
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string>
+
+static unsigned long long allocationCount = 0;
+
+void * operator new(std::size_t size) {
+    ++allocationCount;
+    if (void * p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void * p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void * p, std::size_t) noexcept {
+    std::free(p);
+}
+
+// Stand-ins for napi/libjabra types and calls:
+struct Env { int id; };
+struct NapiBoolean { bool value; };
+
+static volatile bool deviceState = true;
+
+static bool Jabra_IsMuteSupported(unsigned short deviceId) {
+    return deviceState && deviceId != 0;
+}
+
+struct NoCleanup {
+    template <typename T>
+    void operator()(T&) const {}
+};
+
+/**
+ * Stand-in for SdkAsyncWorker.
+ */
+class Worker {
+  public:
+    virtual ~Worker() {}
+    virtual void run() = 0;
+    virtual void complete(const Env& env) = 0;
+};
+
+template <typename R, typename N, typename WorkFunc, typename MapperFunc, typename CleanupFunc>
+class BasicWorker : public Worker {
+  private:
+    R result;
+    const char * const name;
+    WorkFunc work;
+    MapperFunc mapper;
+    CleanupFunc cleanup;
+
+  public:
+    N napiResult;
+
+    BasicWorker(const char * const name, WorkFunc work, MapperFunc mapper, CleanupFunc cleanup)
+      : result(), name(name), work(std::move(work)), mapper(std::move(mapper)), cleanup(std::move(cleanup)), napiResult() {}
+
+    void run() override {
+        result = work();
+    }
+
+    void complete(const Env& env) override {
+        napiResult = mapper(env, result);
+        cleanup(result);
+    }
+};
+
+template <typename R, typename N>
+class FunctionWorker : public BasicWorker<R, N, std::function<R()>, std::function<N(const Env&, const R&)>, std::function<void(R&)>> {
+  public:
+    FunctionWorker(const char * const name, const std::function<R()>& work, const std::function<N(const Env&, const R&)>& mapper,
+                   const std::function<void(R&)>& cleanup = [](R&) {})
+      : BasicWorker<R, N, std::function<R()>, std::function<N(const Env&, const R&)>, std::function<void(R&)>>(name, work, mapper, cleanup) {}
+};
+
+// Before: helper taking std::function's and binding the device id.
+template <typename N, typename R>
+static Worker * functionHelper(const char * const name, unsigned short deviceId,
+                               const std::function<R(unsigned short)>& work,
+                               const std::function<N(const Env&, const R&)>& mapper,
+                               const std::function<void(R&)>& cleanup = [](R&) {}) {
+    return new FunctionWorker<R, N>(name, std::bind(work, deviceId), mapper, cleanup);
+}
+
+// After: helper with callables as template parameters.
+template <typename N, typename R, typename WorkFunc, typename MapperFunc, typename CleanupFunc = NoCleanup>
+static Worker * templateHelper(const char * const name, unsigned short deviceId,
+                               const WorkFunc& work, const MapperFunc& mapper, const CleanupFunc& cleanup = CleanupFunc()) {
+    auto bound = [work, deviceId]() mutable { return work(deviceId); };
+    return new BasicWorker<R, N, decltype(bound), MapperFunc, CleanupFunc>(name, bound, mapper, cleanup);
+}
+
+template <typename MakeWorker>
+static void measure(const char * const name, unsigned long long calls, MakeWorker makeWorker) {
+    const Env env{ 1 };
+
+    // Warm up.
+    for (int i = 0; i < 1000; ++i) {
+        Worker * worker = makeWorker((unsigned short)(i % 8 + 1));
+        worker->run();
+        worker->complete(env);
+        delete worker;
+    }
+
+    const unsigned long long allocationsBefore = allocationCount;
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned long long i = 0; i < calls; ++i) {
+        Worker * worker = makeWorker((unsigned short)(i % 8 + 1));
+        worker->run();
+        worker->complete(env);
+        delete worker;
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const unsigned long long allocations = allocationCount - allocationsBefore;
+
+    std::printf("%-14s: %.2f allocations/call, %.1f ns/call\n", name, (double)allocations / calls,
+                (double)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / calls);
+}
+
+int main(int argc, char ** argv) {
+    const unsigned long long calls = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const char * const functionName = "napi_IsMuteSupported";
+
+    std::printf("Worker create/run/complete/delete, %llu calls (both include the worker allocation itself):\n", calls);
+
+    measure("std::function", calls, [functionName](unsigned short deviceId) {
+        return functionHelper<NapiBoolean, bool>(functionName, deviceId, [functionName](unsigned short deviceId) {
+            return Jabra_IsMuteSupported(deviceId);
+        }, [](const Env& env, bool result) { return NapiBoolean{ result }; });
+    });
+
+    measure("template", calls, [functionName](unsigned short deviceId) {
+        return templateHelper<NapiBoolean, bool>(functionName, deviceId, [functionName](unsigned short deviceId) {
+            return Jabra_IsMuteSupported(deviceId);
+        }, [](const Env& env, bool result) { return NapiBoolean{ result }; });
+    });
+
+    return 0;
+}
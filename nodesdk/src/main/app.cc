@@ -1,34 +1,34 @@
 #include "stdafx.h"
+#include <atomic>
 #include <unordered_map>
 #include <chrono>
 #include <string.h>
 #include "bt.h"
+#include "capabilities.h"
+#include "eventchannel.h"
+#include "propertykeys.h"
+#include "eventinterest.h"
+#include "eventhistory.h"
+#include "devlog.h"
+#include "buttoncatalogue.h"
+#include "startup.h"
+#include "attachprefetch.h"
+#include "metadatacache.h"
+#include <fstream>
 
 // -----------------------------------------------------------
 
 /**
  * Holds all init state to pass between threads, including
  * all paramters to Jabra_Initialize, Jabra_SetAppID and
- * all event handler functions.
+ * the channel delivering all events to javascript.
  */
 class StateJabraInitialize {
   private:
   Napi::Env env;
 
   std::string appId;
-  ThreadSafeCallback *initializedCallback;
-  ThreadSafeCallback *firstScanDoneCallback;
-  ThreadSafeCallback *attachedCallback;
-  ThreadSafeCallback *deAttachedCallback;
-  ThreadSafeCallback *buttonInDataTranslatedCallback;
-  ThreadSafeCallback *devLogCallback;
-  ThreadSafeCallback *batteryStatusCallback;
-  ThreadSafeCallback *remoteMmiCallback;
-  ThreadSafeCallback *downloadFirmwareProgressCallback;
-  ThreadSafeCallback *uploadProgressCallback;
-  ThreadSafeCallback *registerPairingListCallback;
-  ThreadSafeCallback *gNPButtonEventCallBack;
-  ThreadSafeCallback *dectInfoCallback;
+  std::atomic<EventChannel *> eventChannel; // Read from libjabra callback and executor threads.
 
   std::string proxy;
   std::string baseUrl_capabilities;
@@ -36,48 +36,29 @@ class StateJabraInitialize {
   bool blockAllNetworkAccess;
   bool nonJabraDeviceDectection;
 
+  bool useDeviceCatalogueParams;
+  std::string preloadZipFile;
+  DeviceCatalogue_params deviceCatalogueParams; // preloadZipFile is set when initializing.
+
   bool initializationStartedState;
   
-  static void releaseCallback(ThreadSafeCallback* & callback) {
-    if (callback) {
-      ThreadSafeCallback* exception_safe_copy = callback;
-      callback = nullptr;
-      delete exception_safe_copy;
+  static void releaseEventChannel(std::atomic<EventChannel *>& channel) {
+    EventChannel* exception_safe_copy = channel.exchange(nullptr);
+    if (exception_safe_copy) {
+      exception_safe_copy->close();
     }
   }
 
   public:
   StateJabraInitialize() : env(NULL), 
-                           initializedCallback(nullptr),
-                           firstScanDoneCallback(nullptr),
-                           attachedCallback(nullptr),
-                           deAttachedCallback(nullptr),
-                           buttonInDataTranslatedCallback(nullptr),
-                           devLogCallback(nullptr),
-                           batteryStatusCallback(nullptr),
-                           remoteMmiCallback(nullptr),
-                           downloadFirmwareProgressCallback(nullptr),
-                           uploadProgressCallback(nullptr),
-                           registerPairingListCallback(nullptr),
-                           gNPButtonEventCallBack(nullptr),
-                           dectInfoCallback(nullptr),
+                           eventChannel(nullptr),
+                           useDeviceCatalogueParams(false),
+                           deviceCatalogueParams(),
                            initializationStartedState(false) {}
 
   void set(const Napi::Env& _env,
            const std::string& _appId,
-           ThreadSafeCallback* _initializedCallback,
-           ThreadSafeCallback* _firstScanDoneCallback,
-           ThreadSafeCallback* _attachedCallback,
-           ThreadSafeCallback* _deAttachedCallback,
-           ThreadSafeCallback* _buttonInDataTranslatedCallback,
-           ThreadSafeCallback* _devLogCallback,
-           ThreadSafeCallback* _batteryStatusCallback,
-           ThreadSafeCallback* _remoteMmiCallback,
-           ThreadSafeCallback* _downloadFirmwareProgressCallback,
-           ThreadSafeCallback* _uploadProgressCallback,
-           ThreadSafeCallback* _registerPairingListCallback,
-           ThreadSafeCallback* _gNPButtonEventCallBack,
-           ThreadSafeCallback* _dectInfoCallback,
+           EventChannel* _eventChannel,
            const std::string& _proxy,
            const std::string& _baseUrl_capabilities,
            const std::string& _baseUrl_fw,
@@ -87,19 +68,7 @@ class StateJabraInitialize {
       env = _env;
       appId = _appId;
 
-      initializedCallback = _initializedCallback;
-      firstScanDoneCallback = _firstScanDoneCallback;
-      attachedCallback = _attachedCallback;
-      deAttachedCallback = _deAttachedCallback;
-      buttonInDataTranslatedCallback = _buttonInDataTranslatedCallback;
-      devLogCallback = _devLogCallback;
-      batteryStatusCallback = _batteryStatusCallback;
-      remoteMmiCallback = _remoteMmiCallback;
-      downloadFirmwareProgressCallback = _downloadFirmwareProgressCallback;
-      uploadProgressCallback = _uploadProgressCallback;
-      registerPairingListCallback = _registerPairingListCallback;
-      gNPButtonEventCallBack = _gNPButtonEventCallBack;
-      dectInfoCallback = _dectInfoCallback;
+      eventChannel = _eventChannel;
 
       proxy = _proxy;
       baseUrl_capabilities = _baseUrl_capabilities;
@@ -112,64 +81,48 @@ class StateJabraInitialize {
   }
 
   
-  bool isInitializationStarted() {
-    return initializationStartedState;
-  }
-
-  const std::string& getAppId() const {
-    return appId;
-  }
-
-  ThreadSafeCallback * getInitializedCallback() {
-    return initializedCallback;
-  }
-
-  ThreadSafeCallback * getFirstScanDoneCallback() {
-    return firstScanDoneCallback;
-  }
-
-  ThreadSafeCallback * getAttachedCallback() {
-    return attachedCallback;
-  }
-
-  ThreadSafeCallback * getDeAttachedCallback() {
-    return deAttachedCallback;
-  }
-
-  ThreadSafeCallback * getButtonInDataTranslatedCallback() {
-    return buttonInDataTranslatedCallback;
-  }
-
-  ThreadSafeCallback * getDevLogCallback() {
-    return devLogCallback;
-  }
-
-  ThreadSafeCallback * getBatteryStatusCallback() {
-    return batteryStatusCallback;
+  /**
+   * Set the device catalogue behaviour (nullptr = libjabra defaults). Call after set().
+   */
+  void setDeviceCatalogue(const Napi::Object* config) {
+    useDeviceCatalogueParams = config != nullptr;
+    preloadZipFile.clear();
+    deviceCatalogueParams = DeviceCatalogue_params();
+    if (config) {
+      Napi::Object params = *config;
+      // Defaults as documented by libjabra:
+      preloadZipFile = util::getObjStringOrDefault(params, "preloadZipFile", "");
+      deviceCatalogueParams.delayInSecondsBeforeStartingRefresh = (unsigned)util::getObjInt32OrDefault(params, "delayInSecondsBeforeStartingRefresh", 30);
+      deviceCatalogueParams.refreshAtConnect = util::getObjBooleanOrDefault(params, "refreshAtConnect", true);
+      deviceCatalogueParams.refreshAtStartup = util::getObjBooleanOrDefault(params, "refreshAtStartup", true);
+      deviceCatalogueParams.refreshScope = util::getObjInt32OrDefault(params, "refreshScope", 1);
+      deviceCatalogueParams.fetchDataForUnknownDevicesInTheBackground = util::getObjBooleanOrDefault(params, "fetchDataForUnknownDevicesInTheBackground", false);
+      deviceCatalogueParams.onDeviceDataUpdated = nullptr;
+    }
   }
 
-  ThreadSafeCallback * getRemoteMmiCallback () {
-    return remoteMmiCallback;
+  bool getUseDeviceCatalogueParams() const {
+    return useDeviceCatalogueParams;
   }
 
-  ThreadSafeCallback * getDownloadFirmwareProgressCallback() {
-    return downloadFirmwareProgressCallback;
+  const std::string& getPreloadZipFile() const {
+    return preloadZipFile;
   }
 
-  ThreadSafeCallback * getUploadProgressCallback() {
-    return uploadProgressCallback;
+  DeviceCatalogue_params& getDeviceCatalogueParams() {
+    return deviceCatalogueParams;
   }
 
-  ThreadSafeCallback * getRegisterPairingListCallback() {
-    return registerPairingListCallback;
+  bool isInitializationStarted() {
+    return initializationStartedState;
   }
 
-  ThreadSafeCallback * getGNPButtonEventCallBack() {
-    return gNPButtonEventCallBack;
+  const std::string& getAppId() const {
+    return appId;
   }
 
-  ThreadSafeCallback * getDectInfoCallBack() {
-    return dectInfoCallback;
+  EventChannel * getEventChannel() {
+    return eventChannel;
   }
 
   std::string& getProxy() {
@@ -196,19 +149,7 @@ class StateJabraInitialize {
   // to make sure the node process won't block on exit).
   // Needs to be called from main thread.
   void done() {
-    releaseCallback(initializedCallback);
-    releaseCallback(firstScanDoneCallback);
-    releaseCallback(attachedCallback);
-    releaseCallback(deAttachedCallback);
-    releaseCallback(buttonInDataTranslatedCallback);
-    releaseCallback(devLogCallback);
-    releaseCallback(batteryStatusCallback);
-    releaseCallback(remoteMmiCallback);
-    releaseCallback(downloadFirmwareProgressCallback);
-    releaseCallback(uploadProgressCallback);
-    releaseCallback(registerPairingListCallback);
-    releaseCallback(gNPButtonEventCallBack);
-    releaseCallback(dectInfoCallback);
+    releaseEventChannel(eventChannel);
  
     // Re-allow init again.
     initializationStartedState = false;
@@ -228,19 +169,101 @@ static std::uint64_t getTimeSinceEpoc() {
  */
 static StateJabraInitialize state_Jabra_Initialize;
 
+/**
+ * Where a device event goes: To the event channel if javascript listens for that event on the device, and to the
+ * device event history if events of that type are kept. Posting functions are as for EventChannel.
+ */
+class DeviceEventSink {
+  public:
+    DeviceEventSink(unsigned short deviceId, NativeEventType type) : eventChannel(state_Jabra_Initialize.getEventChannel()),
+      recorded(DeviceEventHistory::instance().isRecorded(type)) {
+      if (eventChannel && !DeviceEventInterest::instance().isWanted(deviceId, type)) {
+        eventChannel = nullptr;
+      }
+    }
+
+    /**
+     * Does anything want the event? If not, skip preparing it.
+     */
+    explicit operator bool() const {
+      return eventChannel || recorded;
+    }
+
+    void post(NativeEventType type, unsigned short deviceId, EventChannel::arg_func_t argFunction) {
+      if (recorded) {
+        DeviceEventHistory::instance().add(deviceId, type, argFunction);
+      }
+      if (eventChannel) {
+        eventChannel->post(type, std::move(argFunction));
+      }
+    }
+
+    void post(const NativeEventRecord& record) {
+      if (recorded) {
+        DeviceEventHistory::instance().add(record);
+      }
+      if (eventChannel) {
+        eventChannel->post(record);
+      }
+    }
+
+    void postLatest(NativeEventType type, unsigned short deviceId, unsigned int subKind, EventChannel::arg_func_t argFunction) {
+      if (recorded) {
+        DeviceEventHistory::instance().add(deviceId, type, argFunction);
+      }
+      if (eventChannel) {
+        eventChannel->postLatest(type, deviceId, subKind, std::move(argFunction));
+      }
+    }
+
+    void postLatest(const NativeEventRecord& record, unsigned int subKind) {
+      if (recorded) {
+        DeviceEventHistory::instance().add(record);
+      }
+      if (eventChannel) {
+        eventChannel->postLatest(record, subKind);
+      }
+    }
+
+  private:
+    EventChannel * eventChannel;
+    const bool recorded;
+};
+
+/**
+ * Convert device info to the javascript DeviceInfo (as passed with attach events).
+ */
+static Napi::Object toNapiDeviceInfo(const Napi::Env& env, ObjectBuilder& result, const ManagedDeviceInfo& deviceInfo) {
+  result.set(PropertyKey::deviceID, Napi::Number::New(env, deviceInfo.deviceID));
+  result.set(PropertyKey::productID, Napi::Number::New(env, deviceInfo.productID));
+  result.set(PropertyKey::vendorID, Napi::Number::New(env, deviceInfo.vendorID));
+  result.set(PropertyKey::deviceName, Napi::String::New(env, deviceInfo.deviceName));
+
+  result.set(PropertyKey::usbDevicePath, Napi::String::New(env, deviceInfo.usbDevicePath));
+  result.set(PropertyKey::parentInstanceId, Napi::String::New(env, deviceInfo.parentInstanceId));
+
+  result.set(PropertyKey::errorStatus, Napi::Number::New(env, deviceInfo.errStatus));
+  result.set(PropertyKey::isDongleDevice, Napi::Boolean::New(env, deviceInfo.isDongle));
+  result.set(PropertyKey::dongleName, Napi::String::New(env, deviceInfo.dongleName));
+  result.set(PropertyKey::variant, Napi::String::New(env, deviceInfo.variant));
+  result.set(PropertyKey::ESN, Napi::String::New(env, deviceInfo.serialNumber));
+
+  result.set(PropertyKey::isInFirmwareUpdateMode, Napi::Boolean::New(env, deviceInfo.isInFirmwareUpdateMode));
+  result.set(PropertyKey::connectionType, Napi::Number::New(env, deviceInfo.deviceconnection));
+  result.set(PropertyKey::connectionId, Napi::Number::New(env, deviceInfo.connectionId));
+  result.set(PropertyKey::parentDeviceId, Napi::Number::New(env, deviceInfo.parentDeviceId));
+
+  return result.build();
+}
+
 /**
  * Implements a combination of Jabra_Initialize, Jabra_SetAppID and all Jabra_RegisterXXX 
  * event handler setup functions. The implementation creates it's own thread to call 
  * all Jabra SDK functions. 
  * 
- * Important tempoary implementation note:
- * Callbacks are currently managed using a 3rd party napi-thread-safe-callback
- * library as the node-addon-api does not yet provide a c++ api for
- * cross thread callbacks. This 3rd-party implementation is not as portable
- * or future-proof n-api. Hence, once a official ThreadSafeFunction
- * (https://github.com/nodejs/node-addon-api/pull/442) is released 
- * the implementation should switch to the official 
- *
+ * All events (including the result of the initialization) are delivered to
+ * javascript through a single EventChannel calling one dispatcher function
+ * with batches of events.
  */
 Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
@@ -254,29 +277,19 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
     return env.Null();
   }
 
-  if (util::verifyArguments(__func__, info, { util::STRING, 
-      util::FUNCTION, util::FUNCTION, util::FUNCTION, 
-      util::FUNCTION, util::FUNCTION, util::FUNCTION,
-      util::FUNCTION, util::FUNCTION, util::FUNCTION,
-      util::FUNCTION, util::FUNCTION, util::FUNCTION,
-      util::FUNCTION, util::OBJECT })) {
+  if (util::verifyArguments(__func__, info, { util::STRING, util::FUNCTION, util::OBJECT })) {
+
+    // libjabra is not loaded when the addon is required, but here (or by an earlier sdk call):
+    std::string loadError;
+    if (!jabralib::load(loadError)) {
+      Napi::Error::New(env, loadError).ThrowAsJavaScriptException();
+      return env.Null();
+    }
 
     int argNr = 0;
 
     std::string appId = info[argNr++].As<Napi::String>();
-    auto initializedCallback = new ThreadSafeCallback(info[argNr++].As<Napi::Function>());
-    auto firstScanDoneCallback = new ThreadSafeCallback(info[argNr++].As<Napi::Function>());
-    auto attachedCallback = new ThreadSafeCallback(info[argNr++].As<Napi::Function>());
-    auto deAttachedCallback = new ThreadSafeCallback(info[argNr++].As<Napi::Function>());
-    auto buttonInDataTranslatedCallback = new ThreadSafeCallback(info[argNr++].As<Napi::Function>());
-    auto devLogCallback = new ThreadSafeCallback(info[argNr++].As<Napi::Function>());
-    auto batteryStatusCallback = new ThreadSafeCallback(info[argNr++].As<Napi::Function>());
-    auto remoteMmiCallback = new ThreadSafeCallback(info[argNr++].As<Napi::Function>());
-    auto downloadFirmwareProgressCallback = new ThreadSafeCallback(info[argNr++].As<Napi::Function>());
-    auto uploadProgressCallback = new ThreadSafeCallback(info[argNr++].As<Napi::Function>());
-    auto registerPairingListCallback = new ThreadSafeCallback(info[argNr++].As<Napi::Function>());
-    auto gNPButtonEventCallBack = new ThreadSafeCallback(info[argNr++].As<Napi::Function>());
-    auto dectInfoCallback = new ThreadSafeCallback(info[argNr++].As<Napi::Function>());
+    Napi::Function eventDispatcher = info[argNr++].As<Napi::Function>();
 
     Napi::Object configParams = info[argNr++].As<Napi::Object>();
     
@@ -286,28 +299,63 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
     const bool blockAllNetworkAccess =  configParams.Has("blockAllNetworkAccess") ? (bool)configParams.Get("blockAllNetworkAccess").As<Napi::Boolean>() : false;
     const bool nonJabraDeviceDectection =  configParams.Has("nonJabraDeviceDectection") ? (bool)configParams.Get("nonJabraDeviceDectection").As<Napi::Boolean>() : false;
 
+    // Sizing of the dedicated executor used for all async sdk calls (0 = use defaults):
+    const int32_t sdkExecutorThreadCount = util::getObjInt32OrDefault(configParams, "sdkExecutorThreadCount", 0);
+    const int32_t sdkCallWatchdogThresholdMs = util::getObjInt32OrDefault(configParams, "sdkCallWatchdogThresholdMs", 0);
+    util::SdkExecutor::instance().configure(sdkExecutorThreadCount > 0 ? sdkExecutorThreadCount : 0,
+                                            sdkCallWatchdogThresholdMs > 0 ? sdkCallWatchdogThresholdMs : 0);
+
+    // Default timeout of async sdk calls without an explicit timeout (0 = none):
+    const int32_t sdkCallTimeoutMs = util::getObjInt32OrDefault(configParams, "sdkCallTimeoutMs", 0);
+    util::SdkExecutor::instance().setDefaultTimeout(sdkCallTimeoutMs > 0 ? sdkCallTimeoutMs : util::SdkExecutor::NO_TIMEOUT);
+
+    // Max free async workers kept for reuse per size class (0 = no pooling):
+    const int32_t sdkWorkerPoolCapacity = util::getObjInt32OrDefault(configParams, "sdkWorkerPoolCapacity", util::SdkWorkerPool::DEFAULT_CAPACITY);
+    util::SdkWorkerPool::instance().setCapacity(sdkWorkerPoolCapacity > 0 ? sdkWorkerPoolCapacity : 0);
+
+    // Max events queued for delivery to javascript before events are dropped:
+    const int32_t eventQueueCapacity = util::getObjInt32OrDefault(configParams, "eventQueueCapacity", 0);
+    // Deliver fixed-size events as packed records rather than javascript values:
+    const bool binaryEvents = util::getObjBooleanOrDefault(configParams, "binaryEvents", false);
+    auto eventChannel = new EventChannel(eventDispatcher, eventQueueCapacity > 0 ? eventQueueCapacity : EventChannel::DEFAULT_CAPACITY, binaryEvents);
+
+    // Recent events kept per device and event type for late subscribers:
+    if (configParams.Has("eventHistoryCapacity") && configParams.Get("eventHistoryCapacity").IsObject()) {
+      Napi::Object eventHistoryCapacity = configParams.Get("eventHistoryCapacity").As<Napi::Object>();
+      DeviceEventHistory::instance().configure(eventHistoryCapacity);
+    }
+
+    // Dev log field projection and raw dev log file:
+    DevLogDecoder::instance().configure(configParams);
+
+    // Attach events are prepared on the executor (posted to from the libjabra attach thread), so start it now:
+    util::SdkExecutor::instance().start(env);
+
+    // Identity prefetched before attach events (opt-in):
+    AttachPrefetch::instance().configure(configParams);
+
+    // Static device metadata persisted across runs (opt-in):
+    DeviceMetadataCache::instance().configure(configParams);
 
     state_Jabra_Initialize.set(env,
                                appId,
-                               initializedCallback,
-                               firstScanDoneCallback,
-                               attachedCallback,
-                               deAttachedCallback,
-                               buttonInDataTranslatedCallback,
-                               devLogCallback,
-                               batteryStatusCallback,
-                               remoteMmiCallback,
-                               downloadFirmwareProgressCallback,
-                               uploadProgressCallback,
-                               registerPairingListCallback,
-                               gNPButtonEventCallBack,
-                               dectInfoCallback,
+                               eventChannel,
                                proxy,
                                baseUrl_capabilities,
                                baseUrl_fw,
                                blockAllNetworkAccess,
                                nonJabraDeviceDectection);
 
+    // Device catalogue behaviour, f.x. a catalogue zip preloaded to speed up first attach of known devices:
+    if (configParams.Has("deviceCatalogue") && configParams.Get("deviceCatalogue").IsObject()) {
+      const Napi::Object deviceCatalogue = configParams.Get("deviceCatalogue").As<Napi::Object>();
+      state_Jabra_Initialize.setDeviceCatalogue(&deviceCatalogue);
+    } else {
+      state_Jabra_Initialize.setDeviceCatalogue(nullptr);
+    }
+
+    StartupTiming::instance().start();
+
     std::thread initThread([functionName](){
       try {                  
           ConfigParams_cloud configParams_cloud;
@@ -316,26 +364,55 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
           configParams_cloud.baseUrl_capabilities = state_Jabra_Initialize.getBaseUrl_capabilities().c_str();
           configParams_cloud.baseUrl_fw = state_Jabra_Initialize.getBaseUrl_fw().c_str();
 
+          // Read the catalogue zip in parallel with setting the app id, so it is in the os file cache when libjabra
+          // preloads it (and a missing file is found before it is passed on).
+          const std::string& preloadZipFile = state_Jabra_Initialize.getPreloadZipFile();
+          bool preloadZipFileReadable = false;
+          std::thread catalogueThread;
+          if (!preloadZipFile.empty()) {
+            catalogueThread = std::thread([&preloadZipFile, &preloadZipFileReadable]() {
+              std::ifstream zip(preloadZipFile, std::ios::in | std::ios::binary);
+              std::vector<char> buffer(64 * 1024);
+              while (zip.read(buffer.data(), buffer.size()) || zip.gcount() > 0) {
+                preloadZipFileReadable = true;
+              }
+              StartupTiming::instance().mark(StartupStage::CATALOGUE_READY);
+            });
+          }
+
+          LOG_DEBUG_(LOGINSTANCE) << "Calling Jabra_SetAppID";
+          Jabra_SetAppID(state_Jabra_Initialize.getAppId().c_str());
+          StartupTiming::instance().mark(StartupStage::APP_ID_SET);
+
+          if (catalogueThread.joinable()) {
+            catalogueThread.join();
+            if (!preloadZipFileReadable) {
+              LOG_WARNING_(LOGINSTANCE) << "Device catalogue zip " << preloadZipFile << " could not be read - not preloaded";
+            }
+          }
+
+          DeviceCatalogue_params& deviceCatalogueParams = state_Jabra_Initialize.getDeviceCatalogueParams();
+          deviceCatalogueParams.preloadZipFile = preloadZipFileReadable ? preloadZipFile.c_str() : nullptr;
+
           Config_params config;
-          config.deviceCatalogue_params = nullptr;
+          config.deviceCatalogue_params = state_Jabra_Initialize.getUseDeviceCatalogueParams() ? &deviceCatalogueParams : nullptr;
           config.cloudConfig_params = &configParams_cloud;
           config.reserved2 = nullptr;
 
           bool nonJabraDeviceDectection = state_Jabra_Initialize.getNonJabraDeviceDectection();
 
-          LOG_DEBUG_(LOGINSTANCE) << "Calling Jabra_SetAppID";
-          Jabra_SetAppID(state_Jabra_Initialize.getAppId().c_str());
-
           LOG_DEBUG_(LOGINSTANCE) << "Calling Jabra_Initialize";
           if (Jabra_InitializeV2([]() {  // First scan done.
+              const SdkCallbackScope callbackScope;
               try {
                 LOG_DEBUG_(LOGINSTANCE) << "First scan done";
+                StartupTiming::instance().mark(StartupStage::FIRST_SCAN_DONE);
 
                 auto eventTime = getTimeSinceEpoc();
 
-                auto firstScanCallback = state_Jabra_Initialize.getFirstScanDoneCallback();
-                if (firstScanCallback) {
-                  firstScanCallback->call([eventTime](Napi::Env env, std::vector<napi_value>& args) {
+                auto eventChannel = state_Jabra_Initialize.getEventChannel();
+                if (eventChannel) {
+                  eventChannel->post(NativeEventType::FIRST_SCAN_DONE, [eventTime](Napi::Env env, std::vector<napi_value>& args) {
                     args = { Napi::Number::New(env, eventTime) };
                   });            
                 }
@@ -347,41 +424,42 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
                 LOG_FATAL_(LOGINSTANCE) << errorMsg;
               }
             }, [](Jabra_DeviceInfo _deviceInfo) { // attached            
+              const SdkCallbackScope callbackScope;
               try {
                 LOG_DEBUG_(LOGINSTANCE) << "Device #" << _deviceInfo.deviceID << " attached";
+                StartupTiming::instance().mark(StartupStage::FIRST_ATTACH);
 
                 auto eventTime = getTimeSinceEpoc();
 
-                auto attachedCallback = state_Jabra_Initialize.getAttachedCallback();
-
-                if (attachedCallback) {
+                if (state_Jabra_Initialize.getEventChannel()) {
                   // Make safe copy to avoid refering to memeory freed by Jabra_FreeDeviceInfo below.
                   ManagedDeviceInfo deviceInfo(_deviceInfo);                
+                  // Devices in firmware update mode are not fully functional, so their capabilities are looked up on
+                  // demand instead and nothing is prefetched:
+                  const bool prepare = !_deviceInfo.isInFirmwareUpdateMode;
                   Jabra_FreeDeviceInfo(_deviceInfo);
 
-                  attachedCallback->call([deviceInfo, eventTime](Napi::Env env, std::vector<napi_value>& args) {
-                      Napi::Object result = Napi::Object::New(env);
-                      result.Set(Napi::String::New(env, "deviceID"), (Napi::Number::New(env, deviceInfo.deviceID)));
-                      result.Set(Napi::String::New(env, "productID"), (Napi::Number::New(env, deviceInfo.productID)));
-                      result.Set(Napi::String::New(env, "vendorID"), (Napi::Number::New(env, deviceInfo.vendorID)));
-                      result.Set(Napi::String::New(env, "deviceName"), (Napi::String::New(env, deviceInfo.deviceName)));
-
-                      result.Set(Napi::String::New(env, "usbDevicePath"), (Napi::String::New(env, deviceInfo.deviceName)));
-                      result.Set(Napi::String::New(env, "parentInstanceId"), (Napi::String::New(env, deviceInfo.deviceName)));
-
-                      result.Set(Napi::String::New(env, "errorStatus"), (Napi::Number::New(env, deviceInfo.errStatus)));
-                      result.Set(Napi::String::New(env, "isDongleDevice"), (Napi::Boolean::New(env, deviceInfo.isDongle)));
-                      result.Set(Napi::String::New(env, "dongleName"), (Napi::String::New(env, deviceInfo.dongleName)));
-                      result.Set(Napi::String::New(env, "variant"), (Napi::String::New(env, deviceInfo.variant)));
-                      result.Set(Napi::String::New(env, "ESN"), (Napi::String::New(env, deviceInfo.serialNumber)));
-
-                      result.Set(Napi::String::New(env, "isInFirmwareUpdateMode"), (Napi::Boolean::New(env, deviceInfo.isInFirmwareUpdateMode)));
-                      result.Set(Napi::String::New(env, "connectionType"), (Napi::Number::New(env, deviceInfo.deviceconnection)));
-                      result.Set(Napi::String::New(env, "connectionId"), (Napi::Number::New(env, deviceInfo.connectionId)));
-                      result.Set(Napi::String::New(env, "parentDeviceId"), (Napi::Number::New(env, deviceInfo.parentDeviceId)));
-
-                      args = { result, Napi::Number::New(env, eventTime) };
-                  });
+                  const uint64_t callbackEntryNs = SdkCallbackScope::getEntryTimeNs();
+                  auto post = [deviceInfo, eventTime, callbackEntryNs](std::shared_ptr<const PrefetchedIdentity> identity) {
+                    const SdkCallbackScope callbackScope(callbackEntryNs); // May be posted from an executor thread.
+                    auto eventChannel = state_Jabra_Initialize.getEventChannel();
+                    if (eventChannel) {
+                      eventChannel->post(NativeEventType::ATTACHED, [deviceInfo, eventTime, identity](Napi::Env env, std::vector<napi_value>& args) {
+                          const PropertyKeys keys(env);
+                          ObjectBuilder result(keys);
+                          args = { toNapiDeviceInfo(env, result, deviceInfo), Napi::Number::New(env, eventTime),
+                                   identity ? identity->toNapi(env, deviceInfo.deviceID) : env.Undefined() };
+                      });
+                    }
+                  };
+
+                  // The attach event waits for the static capabilities (from disk if the product and firmware were
+                  // seen before) and the identity, but the attach thread does not:
+                  if (prepare) {
+                    AttachPrefetch::instance().submit(deviceInfo.deviceID, deviceInfo.productID, post);
+                  } else {
+                    post(nullptr);
+                  }
                 }
 
                 LOG_VERBOSE_(LOGINSTANCE) << "Device attach callback handling finished";
@@ -393,17 +471,28 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
                 LOG_FATAL_(LOGINSTANCE) << errorMsg;
               }
             }, [](unsigned short deviceID) { // deattached 
+              const SdkCallbackScope callbackScope;
               try {
                 LOG_DEBUG_(LOGINSTANCE) << "Device #" << deviceID << " de-attached";
 
                 auto eventTime = getTimeSinceEpoc();
 
-                auto deAttachedCallback = state_Jabra_Initialize.getDeAttachedCallback();
-                if (deAttachedCallback) {
-                  deAttachedCallback->call([deviceID, eventTime](Napi::Env env, std::vector<napi_value>& args) {
-                    args = { Napi::Number::New(env, deviceID), Napi::Number::New(env, eventTime) };
-                  });
-                }
+                // After the attach event, if the device is still being prepared (so its metadata is not loaded again
+                // after it is forgotten):
+                const uint64_t callbackEntryNs = SdkCallbackScope::getEntryTimeNs();
+                AttachPrefetch::instance().cancel(deviceID, [deviceID, eventTime, callbackEntryNs]() {
+                  const SdkCallbackScope callbackScope(callbackEntryNs);
+                  DeviceCapabilityCache::instance().remove(deviceID);
+                  DeviceEventInterest::instance().remove(deviceID);
+                  DeviceEventHistory::instance().remove(deviceID);
+                  DeviceButtonCatalogue::instance().remove(deviceID);
+                  DeviceMetadataCache::instance().remove(deviceID);
+
+                  auto eventChannel = state_Jabra_Initialize.getEventChannel();
+                  if (eventChannel) {
+                    eventChannel->post(NativeEventRecord::detached(deviceID, eventTime));
+                  }
+                });
 
                 LOG_VERBOSE_(LOGINSTANCE) << "Device de-attach callback handling finished";
               } catch (const std::exception &e) {       
@@ -417,14 +506,13 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
                 // Ignore - not used.
             },
             [](unsigned short deviceID, Jabra_HidInput translatedInData, bool buttonInData) { // Buttons translated
+              const SdkCallbackScope callbackScope;
               try {
                 LOG_VERBOSE_(LOGINSTANCE) << "Device #" << deviceID << " button press " << translatedInData << ", " << buttonInData;
 
-                auto buttonInDataTranslatedCallback = state_Jabra_Initialize.getButtonInDataTranslatedCallback();
-                if (buttonInDataTranslatedCallback) {
-                  buttonInDataTranslatedCallback->call([deviceID, translatedInData, buttonInData](Napi::Env env, std::vector<napi_value>& args) {
-                      args = { Napi::Number::New(env, deviceID), Napi::Number::New(env, (int)translatedInData), Napi::Boolean::New(env, buttonInData) };
-                  });
+                DeviceEventSink eventSink(deviceID, NativeEventType::BUTTON_IN_DATA_TRANSLATED);
+                if (eventSink) {
+                  eventSink.post(NativeEventRecord::buttonInDataTranslated(deviceID, (int)translatedInData, buttonInData));
                 }
 
                 LOG_VERBOSE_(LOGINSTANCE) << "Device button press callback handling finished";
@@ -443,18 +531,21 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
             // Now that sdk is initialized, we should register all callbacks before we are done:
 
             Jabra_RegisterDevLogCallback([](unsigned short deviceID, char* _eventStr) {
+              const SdkCallbackScope callbackScope;
               try {
                 LOG_VERBOSE_(LOGINSTANCE) << "Jabra_RegisterDevLogCallback callback got eventStr " << _eventStr;
                 if (_eventStr) {
-                  auto devLogCallback = state_Jabra_Initialize.getDevLogCallback();
-
-                  // Make safe copy to avoid refering to memeory freed by Jabra_FreeString below.
-                  std::string eventStr(_eventStr);
-
-                  if (devLogCallback) {
-                    devLogCallback->call([deviceID, eventStr](Napi::Env env, std::vector<napi_value>& args) {
-                        args = { Napi::Number::New(env, deviceID), Napi::String::New(env, eventStr) };
-                    });
+                  DevLogDecoder::instance().write(_eventStr);
+
+                  DeviceEventSink eventSink(deviceID, NativeEventType::DEV_LOG);
+                  if (eventSink) {
+                    // Decode here rather than on the main thread (also avoids refering to memory freed by Jabra_FreeString below).
+                    auto event = std::make_shared<DevLogValue>();
+                    if (DevLogDecoder::instance().decode(_eventStr, *event)) {
+                      eventSink.post(NativeEventType::DEV_LOG, deviceID, [deviceID, event](Napi::Env env, std::vector<napi_value>& args) {
+                          args = { Napi::Number::New(env, deviceID), event->toNapi(env) };
+                      });
+                    }
                   }
                   Jabra_FreeString(_eventStr);
                 }
@@ -469,14 +560,19 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
             });
 
             Jabra_RegisterFirmwareProgressCallBack([](unsigned short deviceID, Jabra_FirmwareEventType type, Jabra_FirmwareEventStatus status, unsigned short percentage) {
+              const SdkCallbackScope callbackScope;
               try {
                 LOG_VERBOSE_(LOGINSTANCE) << "Jabra_RegisterFirmwareProgressCallBack callback got " << type << " " << status << " " << percentage;
 
-                auto downloadFirmwareProgressCallback = state_Jabra_Initialize.getDownloadFirmwareProgressCallback();
-                if (downloadFirmwareProgressCallback) {
-                  downloadFirmwareProgressCallback->call([deviceID, type, status, percentage](Napi::Env env, std::vector<napi_value>& args) {
-                      args = { Napi::Number::New(env, deviceID), Napi::Number::New(env, (int)type), Napi::Number::New(env, (int)status), Napi::Number::New(env, percentage) };
-                  });
+                DeviceEventSink eventSink(deviceID, NativeEventType::FIRMWARE_PROGRESS);
+                if (eventSink) {
+                  const NativeEventRecord record = NativeEventRecord::firmwareProgress(deviceID, (int)type, (int)status, percentage);
+                  if (status == InProgress) {
+                    eventSink.postLatest(record, (unsigned int)type);
+                  } else {
+                    // Completion and errors must always be delivered.
+                    eventSink.post(record);
+                  }
                 }
 
                 LOG_VERBOSE_(LOGINSTANCE) << "Jabra_RegisterFirmwareProgressCallBack callback handling finished";
@@ -491,14 +587,15 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
             });
 
             Jabra_RegisterPairingListCallback([](unsigned short deviceID, Jabra_PairingList *lst) {
+              const SdkCallbackScope callbackScope;
               try {
                 LOG_VERBOSE_(LOGINSTANCE) << "Jabra_RegisterPairingListCallback callback called with " << (lst!=nullptr ? std::to_string(lst->count) : "null") << " pairings";
                 if (lst != nullptr) {
-                  ManagedPairingList mlst(*lst);
+                  DeviceEventSink eventSink(deviceID, NativeEventType::PAIRING_LIST);
+                  if (eventSink) {
+                    ManagedPairingList mlst(*lst);
 
-                  auto registerPairingListCallback = state_Jabra_Initialize.getRegisterPairingListCallback();
-                  if (registerPairingListCallback) {
-                    registerPairingListCallback->call([deviceID, mlst](Napi::Env env, std::vector<napi_value>& args) {
+                    eventSink.post(NativeEventType::PAIRING_LIST, deviceID, [deviceID, mlst](Napi::Env env, std::vector<napi_value>& args) {
                         Napi::Object jlst = Napi::Object::New(env);
                         jlst.Set(Napi::String::New(env, "listType"), Napi::Number::New(env, mlst.listType));
 
@@ -539,66 +636,22 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
             });
 
             Jabra_RegisterForGNPButtonEvent([] (unsigned short deviceID, ButtonEvent *buttonEvent) {
+              const SdkCallbackScope callbackScope;
               try {
                 LOG_VERBOSE_(LOGINSTANCE) << "Jabra_RegisterForGNPButtonEvent callback called with " << (buttonEvent!=nullptr ? std::to_string(buttonEvent->buttonEventCount) : "null") << " button events";
 
-                // First unpack individual key/values into a managed structure that we can safely pass to the callback.
-                std::vector<ManagedButtonEventInfo> buttonInfos;
-                for (int i=0; i<buttonEvent->buttonEventCount; ++i) {
-                  const ButtonEventInfo src = buttonEvent->buttonEventInfo[i];
-
-                  const unsigned short buttonTypeKey = src.buttonTypeKey;
-                  const std::string buttonTypeValue = std::string(src.buttonTypeValue);
-
-                  for (int j=0; j<src.buttonEventTypeSize; ++j) {
-                    ManagedButtonEventInfo e = { buttonTypeKey, buttonTypeValue, src.buttonEventType[j].key, std::string(src.buttonEventType[j].value) };
-                    buttonInfos.push_back(e);
-                  }
-                }
+                DeviceEventSink eventSink(deviceID, NativeEventType::GNP_BUTTON);
+                if (eventSink && buttonEvent != nullptr) {
+                  // Only pass (buttonTypeKey, key) pairs - javascript gets the strings from the cached button catalogue.
+                  std::vector<int32_t> pairs;
+                  const uint32_t catalogueRevision = DeviceButtonCatalogue::instance().toPairs(deviceID, *buttonEvent, pairs);
 
-                auto gNPButtonEventCallBack = state_Jabra_Initialize.getGNPButtonEventCallBack();
-                if (gNPButtonEventCallBack) {
-                  gNPButtonEventCallBack->call([deviceID, buttonInfos](Napi::Env env, std::vector<napi_value>& args) {
-                      Napi::Array buttonEvents = Napi::Array::New(env);
-
-                      // Now repack individual key/value entries into a json structure similar to the orginal:
-                      std::unordered_map<unsigned short, uint32_t> targets;
-                      for (auto itr = buttonInfos.begin(); itr != buttonInfos.end(); itr++) {
-                        const ManagedButtonEventInfo& src = *itr;
-
-                        // Find out if there is there is already an entry for this buttontype, so we can
-                        // and add to that if it exist.
-                        if (targets.find(src.buttonTypeKey) == targets.end()) {
-                           Napi::Array buttonEventInfos = Napi::Array::New(env);
-                           
-                           Napi::Object o = Napi::Object::New(env);
-                           o.Set(Napi::String::New(env, "buttonTypeKey"), Napi::Number::New(env, src.buttonTypeKey));
-                           o.Set(Napi::String::New(env, "buttonTypeValue"), Napi::String::New(env, src.buttonTypeValue));
-                           o.Set(Napi::String::New(env, "buttonEventType"), buttonEventInfos);
-
-                           uint32_t buttonEventsIndex = buttonEvents.Length();
-                           buttonEvents.Set(buttonEventsIndex, o);
-                           targets.insert(std::pair<unsigned short, uint32_t>(src.buttonTypeKey, buttonEventsIndex)); 
-                        }
-
-                        int buttonEventsIndex = targets[src.buttonTypeKey]; // Should always succed.
-                        Napi::Value targetButtonEventInfo = buttonEvents.Get(buttonEventsIndex);
-
-                        if (!targetButtonEventInfo.IsUndefined()) {
-                          Napi::Object targetButtonEventInfoObj = targetButtonEventInfo.As<Napi::Object>();
-                          Napi::Array targetArray = targetButtonEventInfoObj.Get("buttonEventType").As<Napi::Array>();
-
-                          Napi::Object keyValue = Napi::Object::New(env);
-                          keyValue.Set(Napi::String::New(env, "key"), Napi::Number::New(env, src.key));
-                          keyValue.Set(Napi::String::New(env, "value"), Napi::String::New(env, src.value));
-
-                          targetArray.Set(targetArray.Length(), keyValue);
-                        } else { // We should not get here.
-                          LOG_ERROR_(LOGINSTANCE) << "Jabra_RegisterForGNPButtonEvent callback internal error - could not lookup target";
-                        }
+                  eventSink.post(NativeEventType::GNP_BUTTON, deviceID, [deviceID, pairs, catalogueRevision](Napi::Env env, std::vector<napi_value>& args) {
+                      Napi::Array jPairs = Napi::Array::New(env, pairs.size());
+                      for (size_t i = 0; i < pairs.size(); ++i) {
+                        jPairs.Set((uint32_t)i, Napi::Number::New(env, pairs[i]));
                       }
-
-                      args = { Napi::Number::New(env, deviceID), buttonEvents };
+                      args = { Napi::Number::New(env, deviceID), jPairs, Napi::Number::New(env, catalogueRevision) };
                   });
                 }
                 
@@ -614,15 +667,14 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
             });
 
             Jabra_RegisterBatteryStatusUpdateCallback([] (unsigned short deviceID, int levelInPercent, bool charging, bool batteryLow) {
+              const SdkCallbackScope callbackScope;
               try {
                 LOG_VERBOSE_(LOGINSTANCE) << "Jabra_RegisterBatteryStatusUpdateCallback callback got " << levelInPercent << " " << charging << " " << batteryLow;
 
-                auto batteryStatusCallback = state_Jabra_Initialize.getBatteryStatusCallback();
+                DeviceEventSink eventSink(deviceID, NativeEventType::BATTERY_STATUS);
 
-                if (batteryStatusCallback) {
-                  batteryStatusCallback->call([deviceID, levelInPercent, charging, batteryLow](Napi::Env env, std::vector<napi_value>& args) {
-                      args = { Napi::Number::New(env, deviceID), Napi::Number::New(env, levelInPercent), Napi::Boolean::New(env, charging), Napi::Boolean::New(env, batteryLow) };
-                  });
+                if (eventSink) {
+                  eventSink.postLatest(NativeEventRecord::batteryStatus(deviceID, levelInPercent, charging, batteryLow), 0);
                 }
 
                 LOG_VERBOSE_(LOGINSTANCE) << "Jabra_RegisterBatteryStatusUpdateCallback callback handling finished";
@@ -636,15 +688,14 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
             });  
            
             Jabra_RegisterRemoteMmiCallback([] (unsigned short deviceID, RemoteMmiType type, RemoteMmiInput action){
+              const SdkCallbackScope callbackScope;
               try {
                 LOG_VERBOSE_(LOGINSTANCE) << "Jabra_RegisterRemoteMmiCallback callback got " << type << " " << action;
 
-                auto remoteMmiCallback = state_Jabra_Initialize.getRemoteMmiCallback();
+                DeviceEventSink eventSink(deviceID, NativeEventType::REMOTE_MMI);
 
-                if (remoteMmiCallback) {
-                  remoteMmiCallback->call([deviceID, type, action](Napi::Env env, std::vector<napi_value>& args) {
-                    args = { Napi::Number::New(env, deviceID), Napi::Number::New(env, type), Napi::Number::New(env, action)};
-                  });
+                if (eventSink) {
+                  eventSink.post(NativeEventRecord::remoteMmi(deviceID, (int)type, (int)action));
                 }                
               } catch (const std::exception &e) {
                 const std::string errorMsg = "RegisterRemoteMmiCallback callback failed: " + std::string(e.what());
@@ -656,15 +707,20 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
             });
 
             Jabra_RegisterUploadProgress([] (unsigned short deviceID, Jabra_UploadEventStatus status, unsigned short percentage) {
+              const SdkCallbackScope callbackScope;
               try {
                 LOG_VERBOSE_(LOGINSTANCE) << "Jabra_RegisterUploadProgress got " << status << " " << percentage;
 
-                auto uploadProgressCallback = state_Jabra_Initialize.getUploadProgressCallback();
+                DeviceEventSink eventSink(deviceID, NativeEventType::UPLOAD_PROGRESS);
 
-                if (uploadProgressCallback) {
-                  uploadProgressCallback->call([deviceID, status, percentage](Napi::Env env, std::vector<napi_value>& args) {
-                      args = { Napi::Number::New(env, deviceID), Napi::Number::New(env, status), Napi::Number::New(env, percentage) };
-                  });
+                if (eventSink) {
+                  const NativeEventRecord record = NativeEventRecord::uploadProgress(deviceID, (int)status, percentage);
+                  if (status == Upload_InProgress) {
+                    eventSink.postLatest(record, 0);
+                  } else {
+                    // Completion and errors must always be delivered.
+                    eventSink.post(record);
+                  }
                 }
 
                 LOG_VERBOSE_(LOGINSTANCE) << "Jabra_RegisterUploadProgress callback handling finished";
@@ -678,55 +734,56 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
             });
 
             Jabra_RegisterDectInfoHandler([] (unsigned short deviceID, Jabra_DectInfo* dectInfo) {
+              const SdkCallbackScope callbackScope;
               try {
                 LOG_VERBOSE_(LOGINSTANCE) << "Jabra_RegisterDectInfoHandler got " << dectInfo;
 
-                auto dectInfoCallback = state_Jabra_Initialize.getDectInfoCallBack();
+                /*
+                    Jabra_DectInfo is a C struct with a bunch of numbers
+                    and a statically allocate array. It's safe to copy it
+                    this way.
+                */
+                const Jabra_DectInfo dectInfoStack = *dectInfo;
+                Jabra_FreeDectInfoStr(dectInfo);
 
-                if (dectInfoCallback) {
-                  /*
-                      Jabra_DectInfo is a C struct with a bunch of numbers
-                      and a statically allocate array. It's safe to copy it
-                      this way.
-                  */
-                  Jabra_DectInfo dectInfoStack = *dectInfo;
-                  Jabra_FreeDectInfoStr(dectInfo);
-
-                  dectInfoCallback->call([deviceID, dectInfoStack](Napi::Env env, std::vector<napi_value>& args) {
-                    Napi::Object dectInfoNapi = Napi::Object::New(env);
+                DeviceEventSink eventSink(deviceID, NativeEventType::DECT_INFO);
+                if (eventSink) {
+                  eventSink.postLatest(NativeEventType::DECT_INFO, deviceID, (unsigned int)dectInfoStack.DectType, [deviceID, dectInfoStack](Napi::Env env, std::vector<napi_value>& args) {
+                    const PropertyKeys keys(env);
+                    ObjectBuilder dectInfoNapi(keys);
 
                     Napi::Uint8Array rawData = Napi::Uint8Array::New(env, dectInfoStack.RawDataLen);
                     for (unsigned int k = 0; k < dectInfoStack.RawDataLen; ++k) {
                       rawData[k] = dectInfoStack.RawData[k];
                     }
-                    dectInfoNapi.Set(Napi::String::New(env, "rawData"), rawData);
+                    dectInfoNapi.set(PropertyKey::rawData, rawData);
 
                     switch (dectInfoStack.DectType) {
                       case DectDensity: {
                         const Jabra_DectInfoDensity& dectDensity = dectInfoStack.DectDensity;
-                        dectInfoNapi.Set(Napi::String::New(env, "kind"), Napi::String::New(env, "density"));
-                        dectInfoNapi.Set(Napi::String::New(env, "sumMeasuredRSSI"), Napi::Number::New(env, dectDensity.SumMeasuredRSSI));
-                        dectInfoNapi.Set(Napi::String::New(env, "maximumReferenceRSSI"), Napi::Number::New(env, dectDensity.MaximumReferenceRSSI));
-                        dectInfoNapi.Set(Napi::String::New(env, "numberMeasuredSlots"), Napi::Number::New(env, dectDensity.NumberMeasuredSlots));
-                        dectInfoNapi.Set(Napi::String::New(env, "dataAgeSeconds"), Napi::Number::New(env, dectDensity.DataAgeSeconds));
+                        dectInfoNapi.set(PropertyKey::kind, Napi::String::New(env, "density"));
+                        dectInfoNapi.set(PropertyKey::sumMeasuredRSSI, Napi::Number::New(env, dectDensity.SumMeasuredRSSI));
+                        dectInfoNapi.set(PropertyKey::maximumReferenceRSSI, Napi::Number::New(env, dectDensity.MaximumReferenceRSSI));
+                        dectInfoNapi.set(PropertyKey::numberMeasuredSlots, Napi::Number::New(env, dectDensity.NumberMeasuredSlots));
+                        dectInfoNapi.set(PropertyKey::dataAgeSeconds, Napi::Number::New(env, dectDensity.DataAgeSeconds));
                         break;
                       }
 
                       case DectErrorCount: {
                         const Jabra_DectErrorCount& dectError = dectInfoStack.DectErrorCount;
-                        dectInfoNapi.Set(Napi::String::New(env, "kind"), Napi::String::New(env, "errorCount"));
-                        dectInfoNapi.Set(Napi::String::New(env, "syncErrors"), Napi::Number::New(env, dectError.syncErrors));
-                        dectInfoNapi.Set(Napi::String::New(env, "aErrors"), Napi::Number::New(env, dectError.aErrors));
-                        dectInfoNapi.Set(Napi::String::New(env, "xErrors"), Napi::Number::New(env, dectError.xErrors));
-                        dectInfoNapi.Set(Napi::String::New(env, "zErrors"), Napi::Number::New(env, dectError.zErrors));
-                        dectInfoNapi.Set(Napi::String::New(env, "hubSyncErrors"), Napi::Number::New(env, dectError.hubSyncErrors));
-                        dectInfoNapi.Set(Napi::String::New(env, "hubAErrors"), Napi::Number::New(env, dectError.hubAErrors));
-                        dectInfoNapi.Set(Napi::String::New(env, "handoversCount"), Napi::Number::New(env, dectError.handoversCount));
+                        dectInfoNapi.set(PropertyKey::kind, Napi::String::New(env, "errorCount"));
+                        dectInfoNapi.set(PropertyKey::syncErrors, Napi::Number::New(env, dectError.syncErrors));
+                        dectInfoNapi.set(PropertyKey::aErrors, Napi::Number::New(env, dectError.aErrors));
+                        dectInfoNapi.set(PropertyKey::xErrors, Napi::Number::New(env, dectError.xErrors));
+                        dectInfoNapi.set(PropertyKey::zErrors, Napi::Number::New(env, dectError.zErrors));
+                        dectInfoNapi.set(PropertyKey::hubSyncErrors, Napi::Number::New(env, dectError.hubSyncErrors));
+                        dectInfoNapi.set(PropertyKey::hubAErrors, Napi::Number::New(env, dectError.hubAErrors));
+                        dectInfoNapi.set(PropertyKey::handoversCount, Napi::Number::New(env, dectError.handoversCount));
                         break;
                       }
                     }
 
-                    args = { Napi::Number::New(env, deviceID), dectInfoNapi };
+                    args = { Napi::Number::New(env, deviceID), dectInfoNapi.build() };
                   });
                 }
 
@@ -740,19 +797,23 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
               }
             });
 
-            // Finally, notify caller that init succeded:
-            auto initCallback = state_Jabra_Initialize.getInitializedCallback();
-            if (initCallback) {
-              initCallback->call([](Napi::Env env, std::vector<napi_value>& args) {
-                  args = { };
+            StartupTiming::instance().mark(StartupStage::INITIALIZED);
+
+            // Finally, notify caller that init succeded (with the startup timing so far):
+            auto eventChannel = state_Jabra_Initialize.getEventChannel();
+            if (eventChannel) {
+              eventChannel->post(NativeEventType::INITIALIZED, [](Napi::Env env, std::vector<napi_value>& args) {
+                  args = { env.Undefined(), StartupTiming::instance().toNapi(env) };
               });
             }
           } else { // Init failed.
             LOG_FATAL_(LOGINSTANCE) << "Jabra_Initialize failed";
 
-            auto initCallback = state_Jabra_Initialize.getInitializedCallback();
-            if (initCallback) {
-              initCallback->error("Could not initialize jabra sdk");
+            auto eventChannel = state_Jabra_Initialize.getEventChannel();
+            if (eventChannel) {
+              eventChannel->post(NativeEventType::INITIALIZED, [](Napi::Env env, std::vector<napi_value>& args) {
+                  args = { Napi::Error::New(env, "Could not initialize jabra sdk").Value() };
+              });
             }
           }
       } catch (const std::exception &e) {       
@@ -776,38 +837,98 @@ Napi::Value napi_Initialize(const Napi::CallbackInfo& info) {
 Napi::Value napi_UnInitialize(const Napi::CallbackInfo& info) {
   return util::JSyncWrapper<Napi::Value>(__func__, info, [](const char * const functionName, const Napi::CallbackInfo& info) -> Napi::Value {
     Napi::Env env = info.Env();
+    if (!jabralib::getStats().loaded) {
+      return Napi::Boolean::New(env, false); // Never initialized - do not load libjabra just to uninitialize it.
+    }
+    // No prefetch may call libjabra or post to the event channel once it is uninitialized and closed:
+    AttachPrefetch::instance().stop();
     bool retv = Jabra_Uninitialize();
     if (retv) {
       // Properly need to be called from main thread - so not sure this can be async if we should want this ?
       state_Jabra_Initialize.done();
+      DeviceCapabilityCache::instance().clear();
+      DeviceEventInterest::instance().clear();
+      DeviceEventHistory::instance().clear();
+      DevLogDecoder::instance().close();
+      DeviceButtonCatalogue::instance().clear();
+      DeviceMetadataCache::instance().clear();
     }
     return Napi::Boolean::New(env, retv);
   });
 }
 
+Napi::Value napi_GetAttachedDevices(const Napi::CallbackInfo& info) {
+  return util::JSyncWrapper<Napi::Value>(__func__, info, [](const char * const functionName, const Napi::CallbackInfo& info) -> Napi::Value {
+    const Napi::Env env = info.Env();
+
+    if (util::verifyArguments(functionName, info, {})) {
+      // Only reads the device list kept by libjabra, so it is cheap enough to call on the main thread.
+      std::vector<Jabra_DeviceInfo> deviceInfos(16);
+      int count;
+      for (;;) {
+        count = (int)deviceInfos.size();
+        Jabra_GetAttachedJabraDevices(&count, deviceInfos.data());
+        if (count < (int)deviceInfos.size()) {
+          break;
+        }
+        // Maybe more devices than room - free the infos and retry with more room.
+        for (int i = 0; i < count; ++i) {
+          Jabra_FreeDeviceInfo(deviceInfos[i]);
+        }
+        deviceInfos.resize(deviceInfos.size() * 2);
+      }
+
+      std::vector<ManagedDeviceInfo> managedDeviceInfos;
+      for (int i = 0; i < count; ++i) {
+        managedDeviceInfos.emplace_back(deviceInfos[i]);
+        Jabra_FreeDeviceInfo(deviceInfos[i]);
+      }
+
+      const PropertyKeys keys(env);
+      ObjectBuilder deviceInfo(keys);
+      Napi::Array result = Napi::Array::New(env, managedDeviceInfos.size());
+      for (size_t i = 0; i < managedDeviceInfos.size(); ++i) {
+        result.Set((uint32_t)i, toNapiDeviceInfo(env, deviceInfo, managedDeviceInfos[i]));
+      }
+      return result;
+    }
+
+    return env.Undefined();
+  });
+}
+
 Napi::Value napi_ConnectToJabraApplication(const Napi::CallbackInfo& info)
 {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::STRING, util::STRING, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::STRING, util::STRING}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const std::string guid = info[0].As<Napi::String>();
     const std::string softphoneName = info[1].As<Napi::String>();    
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<bool, Napi::Boolean>(
+    auto * const worker = new util::JAsyncWorker<bool, Napi::Boolean>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, guid, softphoneName](){              
         return Jabra_ConnectToJabraApplication(guid.c_str(), softphoneName.c_str());
       }, 
       [](const Napi::Env& env, const bool result) {
         return Napi::Boolean::New(env, result);
       }
-    ))->Queue();
+    );
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_DisconnectFromJabraApplication(const Napi::CallbackInfo& info)
@@ -829,26 +950,35 @@ Napi::Value napi_SetSoftphoneReady(const Napi::CallbackInfo& info)
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::BOOLEAN, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::BOOLEAN}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const bool isReady = info[0].As<Napi::Boolean>().ToBoolean();
-    Napi::Function javascriptResultCallback = info[1].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, isReady](){              
         Jabra_SetSoftphoneReady(isReady);
       }
-    ))->Queue();
+    );
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_IsSoftphoneInFocus(const Napi::CallbackInfo& info) 
 {
   const char * const functionName = __func__;
-  return util::SimpleAsyncFunction<Napi::Boolean, bool>(functionName, info, 
+  return util::SimpleAsyncFunction<Napi::Boolean, bool>(functionName, util::AsyncOptions::ReadOnly(), info, 
     [functionName]() {
       return Jabra_IsSoftphoneInFocus();
     }, 
@@ -863,13 +993,17 @@ Napi::Value napi_GetErrorString(const Napi::CallbackInfo& info)
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const Jabra_ReturnCode errorCode = (Jabra_ReturnCode)info[0].As<Napi::Number>().Uint32Value();  
-    Napi::Function javascriptResultCallback = info[1].As<Napi::Function>();
 
-    (new util::JAsyncWorker<const char *, Napi::String>(
+    auto * const worker = new util::JAsyncWorker<const char *, Napi::String>(
       functionName,
-      javascriptResultCallback,
+      env,
       [functionName, errorCode](){              
         const char * result = Jabra_GetReturnCodeString(errorCode);
 
@@ -889,15 +1023,20 @@ Napi::Value napi_GetErrorString(const Napi::CallbackInfo& info)
       [](const char * result) {
         // Assume error strings does not need to be freed.
       }
-    ))->Queue();
+    );
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_GetVersion(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleAsyncFunction<Napi::String, std::string>(functionName, info, [functionName]() {
+  return util::SimpleAsyncFunction<Napi::String, std::string>(functionName, util::AsyncOptions::ReadOnly(), info, [functionName]() {
     char buf[64];
     Jabra_ReturnCode retv;
     if ((retv = Jabra_GetVersion(&buf[0], sizeof(buf))) == Return_Ok) {
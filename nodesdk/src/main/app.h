@@ -4,6 +4,11 @@
 Napi::Value napi_Initialize(const Napi::CallbackInfo& info);
 Napi::Value napi_UnInitialize(const Napi::CallbackInfo& info);
 
+/**
+ * Get the DeviceInfo of all devices currently attached (according to libjabra) in one call.
+ */
+Napi::Value napi_GetAttachedDevices(const Napi::CallbackInfo& info);
+
 Napi::Value napi_ConnectToJabraApplication(const Napi::CallbackInfo& info);
 Napi::Value napi_DisconnectFromJabraApplication(const Napi::CallbackInfo& info);
 Napi::Value napi_SetSoftphoneReady(const Napi::CallbackInfo& info);
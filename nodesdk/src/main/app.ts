@@ -1,7 +1,9 @@
 import { SdkIntegration } from "./sdkintegration";
-import { AddonLogSeverity, DevLogData } from "./core-types";
+import { AddonLogSeverity, CallOptions } from "./core-types";
 import { isNodeJs, nameof } from './util';
 import { _JabraNativeAddonLog } from './logger';
+import { _withCallOptions } from './calloptions';
+import { _createNativeEventDispatcher, NativeEventHandlers } from './nativeevents';
 
 // Browser friendly type-only import:
 type _EventEmitter = import('events').EventEmitter;
@@ -23,7 +25,8 @@ if (isNodeJs()) {
 } 
 
 import { DeviceInfo, RCCStatus, ConfigInfo, ConfigParamsCloud, GenericConfigParams, DeviceCatalogueParams,
-         FirmwareInfoType, SettingType, DeviceSettings } from './core-types';
+         FirmwareInfoType, SettingType, DeviceSettings, NativeConfigParams, NativeMetrics,
+         BatchOperationDescriptor, BatchOperationResult, DeviceIdentity } from './core-types';
 
 import { enumAPIReturnCode, enumDeviceErrorStatus, enumDeviceBtnType, enumDeviceConnectionType,
          enumSettingDataType, enumSettingCtrlType, enumSettingLoadMode, enumFirmwareEventStatus,
@@ -32,8 +35,6 @@ import { enumAPIReturnCode, enumDeviceErrorStatus, enumDeviceBtnType, enumDevice
 
 import { MetaApi, ClassEntry, _getJabraApiMetaSync } from './meta';
 
-import * as util from 'util';
-
 import { DeviceType } from './device';
 
 // Singletons containing our top-level object and parameters.
@@ -42,7 +43,7 @@ import { DeviceType } from './device';
 let jabraApp: Promise<JabraType> | null = null;
 
 /** @internal */
-let jabraAppOptions: (ConfigParamsCloud & GenericConfigParams) | null = null;
+let jabraAppOptions: (ConfigParamsCloud & GenericConfigParams & NativeConfigParams) | null = null;
 
 /** @internal */
 let jabraAppID: string | null = null;
@@ -52,14 +53,18 @@ let jabraAppID: string | null = null;
  * @param appID The user should first register the app on [Jabra developer site](https://developer.jabra.com/) to get application id.
  * @param configCloudParams Optional configuration parameters for the sdk.
  * @param nonJabraDeviceDectection If true non Jabra and Jabra devices will be detected, false by default.
+ * @param nativeConfigParams Optional tuning parameters for the native part of the sdk integration.
  */
-export function createJabraApplication(appID: string, configCloudParams: ConfigParamsCloud = {}, nonJabraDeviceDectection: boolean = false): Promise<JabraType> {
+export function createJabraApplication(appID: string, configCloudParams: ConfigParamsCloud = {}, nonJabraDeviceDectection: boolean = false, nativeConfigParams: NativeConfigParams = {}): Promise<JabraType> {
     if (!isNodeJs()) {
         return Promise.reject(new Error("This createJabraApplication() function needs to run under NodeJs and not in a browser"));
     }
 
     let options = configCloudParams ? JSON.parse(JSON.stringify(configCloudParams)) : {};
     options!.nonJabraDeviceDectection = nonJabraDeviceDectection;
+    if (nativeConfigParams) {
+        Object.assign(options, JSON.parse(JSON.stringify(nativeConfigParams)));
+    }
 
     if (!jabraApp) {
         _JabraNativeAddonLog(AddonLogSeverity.info, "createJabraApplication", "Init - Creating new jabraApp");
@@ -91,6 +96,16 @@ export type JabraTypeEvents = 'attach' | 'detach' | 'firstScanDone';
 
 export const JabraEventsList: JabraTypeEvents[] = ['attach', 'detach', 'firstScanDone'];
 
+/**
+ * The devices attached when a snapshot was taken (see JabraType.getAttachedDevicesSnapshot).
+ */
+export interface AttachedDevicesSnapshot {
+    /* All attached devices. */
+    devices: DeviceType[];
+    /* Resolves (never rejects) with the identity of each device, in the same order, once prefetched. */
+    ready: Promise<DeviceIdentity[]>;
+}
+
 /** 
  * Main API class return by createJabraApplication.   
  */
@@ -115,7 +130,7 @@ export class JabraType implements MetaApi {
      * @internal 
      * @hidden
      **/
-    constructor(appID: string, configParams: ConfigParamsCloud & GenericConfigParams, resolve: (value: JabraType) => void, reject: (reason: Error) => void) {
+    constructor(appID: string, configParams: ConfigParamsCloud & GenericConfigParams & NativeConfigParams, resolve: (value: JabraType) => void, reject: (reason: Error) => void) {
         if (!isNodeJs()) {
             throw new Error("This JabraType constructor() function needs to run under NodeJs and not in a browser");
         }
@@ -129,176 +144,199 @@ export class JabraType implements MetaApi {
         this.deviceTypes = new Map<number, DeviceType>();
 
         this.firstScanForDevicesDonePromise = new Promise<void>(( firstScanForDevicesDoneResolve, firstScanForDevicesDoneReject ) => {
-            sdkIntegration.Initialize( appID, (err, success) => {
-                try {
-                    if (err) {
-                        let errObj = new Error("Initialization error " + err);
+            const eventHandlers: NativeEventHandlers = {
+                initialized: (err, startupTiming) => {
+                    try {
+                        if (err) {
+                            let errObj = new Error("Initialization error " + err);
+                            _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::success callback", err);
+                            reject(errObj);
+                            firstScanForDevicesDoneReject(errObj);
+                        } else {
+                            _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::success", (() => `native sdk initialized successfully with startupTiming=${JSON.stringify(startupTiming)}`));
+                            resolve(this);
+                        }
+                    } catch (err) {
+                        // Log but do not propagate js errors into native caller (or node process will be aborted):
                         _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::success callback", err);
-                        reject(errObj);
-                        firstScanForDevicesDoneReject(errObj);
-                    } else {
-                        _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::success", "native sdk initialized successfully");
-                        resolve(this);
                     }
-                } catch (err) {
-                    // Log but do not propagate js errors into native caller (or node process will be aborted):
-                    _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::success callback", err);
-                }
-            }, (event_time_ms) => {
-                try {
-                    _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::firstScanDone", (() =>`firstScanDone event received from native sdk with event_time_ms=${event_time_ms}`));
-                    this.eventEmitter.emit('firstScanDone', undefined);
-                    firstScanForDevicesDoneResolve();
-                } catch (err) {
-                    // Log but do not propagate js errors into native caller (or node process will be aborted):
-                    _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::firstScanDone callback", err);
-                }
-            }, (deviceData, event_time_ms) => {
-                try {
-                    _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::attach", (() =>`attach event received from native sdk with deviceData=${JSON.stringify(deviceData, null, 3)}, event_time_ms=${event_time_ms}`));
-                    let deviceType = new DeviceType(deviceData, event_time_ms);
-                    this.deviceTypes.set(deviceData.deviceID, deviceType);
-                    this.eventEmitter.emit('attach', deviceType);
-                } catch (err) {
-                    // Log but do not propagate js errors into native caller (or node process will be aborted):
-                    _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::attach callback", err);
-                }
-            }, (deviceId, event_time_ms) => {
-                try {
-                    _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::detach", (() =>`detach event received from native sdk with deviceId=${deviceId}, event_time_ms=${event_time_ms}`));
-                    let deviceType = this.deviceTypes.get(deviceId);
-                    if (deviceType) {
-                        // Assign to detached_time_ms even though it is formally a readonly because we don't want clients to change it.
-                        (deviceType.detached_time_ms as DeviceType['detached_time_ms']) = event_time_ms;
-                        this.deviceTypes.delete(deviceId);
-                        this.eventEmitter.emit('detach', deviceType);                        
-                    } else {
-                        _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::detach callback", "Could not lookup device with id " + deviceId);
+                },
+                firstScanDone: (event_time_ms) => {
+                    try {
+                        _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::firstScanDone", (() =>`firstScanDone event received from native sdk with event_time_ms=${event_time_ms}`));
+                        this.eventEmitter.emit('firstScanDone', undefined);
+                        firstScanForDevicesDoneResolve();
+                    } catch (err) {
+                        // Log but do not propagate js errors into native caller (or node process will be aborted):
+                        _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::firstScanDone callback", err);
                     }
-                } catch (err) {
-                    // Log but do not propagate js errors into native caller (or node process will be aborted):
-                    _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::detach callback", err);
-                }
-            }, (deviceId, translatedInData, buttonInData) => {
-                try {
-                    _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::buttonInDataTranslated", (() => `buttonInDataTranslated event received from native sdk with translatedInData=${translatedInData}, buttonInData=${buttonInData}`));
-                    let device = this.deviceTypes.get(deviceId);
-                    if (device) {
-                        device._eventEmitter.emit('btnPress', translatedInData, buttonInData);
-                    } else {
-                        _JabraNativeAddonLog(AddonLogSeverity.error, "buttonInDataTranslated callback", "Could not lookup device with id " + deviceId);
+                },
+                attached: (deviceData, event_time_ms, identity) => {
+                    try {
+                        _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::attach", (() =>`attach event received from native sdk with deviceData=${JSON.stringify(deviceData, null, 3)}, event_time_ms=${event_time_ms}, identity=${JSON.stringify(identity)}`));
+                        // If already taken from an attached devices snapshot, the same object is kept:
+                        const deviceType = this._getOrAddDeviceType(deviceData, event_time_ms, event_time_ms);
+                        deviceType._setPrefetchedIdentity(identity);
+                        this.eventEmitter.emit('attach', deviceType);
+                    } catch (err) {
+                        // Log but do not propagate js errors into native caller (or node process will be aborted):
+                        _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::attach callback", err);
                     }
-                } catch (err) {
-                    // Log but do not propagate js errors into native caller (or node process will be aborted):
-                    _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::buttonInDataTranslated callback", err)
-                }
-            }, (deviceId, jsonData) => {
-                try {
-                    _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onDevLogEvent", (() => `onDevLogEvent event received from native sdk with jsonData=${jsonData}`));
-                    let device = this.deviceTypes.get(deviceId);
-                    if (device) {
-                        const data = JSON.parse(jsonData);                        
-                        device._eventEmitter.emit('onDevLogEvent', data as DevLogData);
-                    } else {
-                        _JabraNativeAddonLog(AddonLogSeverity.error, "onDevLogEvent callback", "Could not lookup device with id " + deviceId);
+                },
+                detached: (deviceId, event_time_ms) => {
+                    try {
+                        _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::detach", (() =>`detach event received from native sdk with deviceId=${deviceId}, event_time_ms=${event_time_ms}`));
+                        let deviceType = this.deviceTypes.get(deviceId);
+                        if (deviceType) {
+                            // Assign to detached_time_ms even though it is formally a readonly because we don't want clients to change it.
+                            (deviceType.detached_time_ms as DeviceType['detached_time_ms']) = event_time_ms;
+                            this.deviceTypes.delete(deviceId);
+                            this.eventEmitter.emit('detach', deviceType);                        
+                        } else {
+                            _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::detach callback", "Could not lookup device with id " + deviceId);
+                        }
+                    } catch (err) {
+                        // Log but do not propagate js errors into native caller (or node process will be aborted):
+                        _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::detach callback", err);
                     }
-                } catch (err) {
-                    // Log but do not propagate js errors into native caller (or node process will be aborted):
-                    _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onDevLogEvent callback", err)
-                }
-            }, (deviceId, levelInPercent, isCharging, isBatteryLow) => {
-                try {
-                    _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onBatteryStatusUpdate", (() => `onBatteryStatusUpdate event received from native sdk with levelInPercent=${levelInPercent}, isCharging=${isCharging}, isBatteryLow=${isBatteryLow}`));
-                    let device = this.deviceTypes.get(deviceId);
-                    if (device) {
-                        device._eventEmitter.emit('onBatteryStatusUpdate', levelInPercent, isCharging, isBatteryLow);
-                    } else {
-                        _JabraNativeAddonLog(AddonLogSeverity.error, "onBatteryStatusUpdate callback", "Could not lookup device with id " + deviceId);
+                },
+                buttonInDataTranslated: (deviceId, translatedInData, buttonInData) => {
+                    try {
+                        _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::buttonInDataTranslated", (() => `buttonInDataTranslated event received from native sdk with translatedInData=${translatedInData}, buttonInData=${buttonInData}`));
+                        let device = this.deviceTypes.get(deviceId);
+                        if (device) {
+                            device._eventEmitter.emit('btnPress', translatedInData, buttonInData);
+                        } else {
+                            _JabraNativeAddonLog(AddonLogSeverity.error, "buttonInDataTranslated callback", "Could not lookup device with id " + deviceId);
+                        }
+                    } catch (err) {
+                        // Log but do not propagate js errors into native caller (or node process will be aborted):
+                        _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::buttonInDataTranslated callback", err)
                     }
-                } catch (err) {
-                    // Log but do not propagate js errors into native caller (or node process will be aborted):
-                    _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onBatteryStatusUpdate callback", err)
-                }
-            }, (deviceId, type, input) => {
-                try {
-                    _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onRemoteMmiEvent", (() => `onRemoteMmiEvent event received from native sdk with type=${type}, input=${input}`));
-                    let device = this.deviceTypes.get(deviceId);
-                    if (device) {
-                        device._eventEmitter.emit('onRemoteMmiEvent', type, input);
-                    } else {
-                        _JabraNativeAddonLog(AddonLogSeverity.error, "onRemoteMmiEvent callback", "Could not lookup device with id " + deviceId);
+                },
+                devLog: (deviceId, data) => {
+                    try {
+                        _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onDevLogEvent", (() => `onDevLogEvent event received from native sdk with data=${JSON.stringify(data)}`));
+                        let device = this.deviceTypes.get(deviceId);
+                        if (device) {
+                            // Already decoded natively.
+                            device._eventEmitter.emit('onDevLogEvent', data);
+                        } else {
+                            _JabraNativeAddonLog(AddonLogSeverity.error, "onDevLogEvent callback", "Could not lookup device with id " + deviceId);
+                        }
+                    } catch (err) {
+                        // Log but do not propagate js errors into native caller (or node process will be aborted):
+                        _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onDevLogEvent callback", err)
                     }
-                } catch (err) {
-                    // Log but do not propagate js errors into native caller (or node process will be aborted):
-                    _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onRemoteMmiEvent callback", err)
-                }
-            }, (deviceId, type, status, dwnFirmPercentage) => {
-                try {
-                    _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::downloadFirmwareProgress", (() => `downloadFirmwareProgress event received from native sdk with type=${type}, status=${status}, dwnFirmPercentage=${dwnFirmPercentage}`));
-                    let device = this.deviceTypes.get(deviceId);
-                    if (device) {
-                        device._eventEmitter.emit('downloadFirmwareProgress', type, status, dwnFirmPercentage);
-                    } else {
-                        _JabraNativeAddonLog(AddonLogSeverity.error, "downloadFirmwareProgress callback", "Could not lookup device with id " + deviceId);
+                },
+                batteryStatus: (deviceId, levelInPercent, isCharging, isBatteryLow) => {
+                    try {
+                        _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onBatteryStatusUpdate", (() => `onBatteryStatusUpdate event received from native sdk with levelInPercent=${levelInPercent}, isCharging=${isCharging}, isBatteryLow=${isBatteryLow}`));
+                        let device = this.deviceTypes.get(deviceId);
+                        if (device) {
+                            device._eventEmitter.emit('onBatteryStatusUpdate', levelInPercent, isCharging, isBatteryLow);
+                        } else {
+                            _JabraNativeAddonLog(AddonLogSeverity.error, "onBatteryStatusUpdate callback", "Could not lookup device with id " + deviceId);
+                        }
+                    } catch (err) {
+                        // Log but do not propagate js errors into native caller (or node process will be aborted):
+                        _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onBatteryStatusUpdate callback", err)
                     }
-                } catch (err) {
-                    // Log but do not propagate js errors into native caller (or node process will be aborted):
-                    _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::downloadFirmwareProgress callback", err)
-                }
-            }, (deviceId, status, percentage) => {
-                try {
-                    _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onUploadProgress", (() => `onUploadProgress event received from native sdk with status ${status}, percentage ${percentage}`));
-                    let device = this.deviceTypes.get(deviceId);
-                    if (device) {
-                        device._eventEmitter.emit('onUploadProgress', status, percentage);
-                    } else {
-                        _JabraNativeAddonLog(AddonLogSeverity.error, "onUploadProgress callback", "Could not lookup device with id " + deviceId);
+                },
+                remoteMmi: (deviceId, type, input) => {
+                    try {
+                        _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onRemoteMmiEvent", (() => `onRemoteMmiEvent event received from native sdk with type=${type}, input=${input}`));
+                        let device = this.deviceTypes.get(deviceId);
+                        if (device) {
+                            device._eventEmitter.emit('onRemoteMmiEvent', type, input);
+                        } else {
+                            _JabraNativeAddonLog(AddonLogSeverity.error, "onRemoteMmiEvent callback", "Could not lookup device with id " + deviceId);
+                        }
+                    } catch (err) {
+                        // Log but do not propagate js errors into native caller (or node process will be aborted):
+                        _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onRemoteMmiEvent callback", err)
                     }
-                } catch (err) {
-                    // Log but do not propagate js errors into native caller (or node process will be aborted):
-                    _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onUploadProgress callback", err)
-                }
-            }, (deviceId, pairedListInfo) => {
-                try {
-                    _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onBTParingListChange", (() => `onBTParingListChange event received from native sdk with pairedListInfo ${JSON.stringify(pairedListInfo, null, 3)}`));
-                    let device = this.deviceTypes.get(deviceId);
-                    if (device) {
-                        device._eventEmitter.emit('onBTParingListChange', pairedListInfo);
-                    } else {
-                        _JabraNativeAddonLog(AddonLogSeverity.error, "onBTParingListChange callback", "Could not lookup device with id " + deviceId);
+                },
+                firmwareProgress: (deviceId, type, status, dwnFirmPercentage) => {
+                    try {
+                        _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::downloadFirmwareProgress", (() => `downloadFirmwareProgress event received from native sdk with type=${type}, status=${status}, dwnFirmPercentage=${dwnFirmPercentage}`));
+                        let device = this.deviceTypes.get(deviceId);
+                        if (device) {
+                            device._eventEmitter.emit('downloadFirmwareProgress', type, status, dwnFirmPercentage);
+                        } else {
+                            _JabraNativeAddonLog(AddonLogSeverity.error, "downloadFirmwareProgress callback", "Could not lookup device with id " + deviceId);
+                        }
+                    } catch (err) {
+                        // Log but do not propagate js errors into native caller (or node process will be aborted):
+                        _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::downloadFirmwareProgress callback", err)
                     }
-                } catch (err) {
-                    // Log but do not propagate js errors into native caller (or node process will be aborted):
-                    _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onBTParingListChange callback", err)
-                }
-            }, (deviceId, buttonEvents) => {
-                try {
-                    _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onGNPBtnEvent", (() => `onGNPBtnEvent event received from native sdk with buttonEvents=${buttonEvents}`));
-                    let device = this.deviceTypes.get(deviceId);
-                    if (device) {
-                        device._eventEmitter.emit('onGNPBtnEvent', buttonEvents);
-                    } else {
-                        _JabraNativeAddonLog(AddonLogSeverity.error, "onGNPBtnEventChange callback", "Could not lookup device with id " + deviceId);
+                },
+                uploadProgress: (deviceId, status, percentage) => {
+                    try {
+                        _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onUploadProgress", (() => `onUploadProgress event received from native sdk with status ${status}, percentage ${percentage}`));
+                        let device = this.deviceTypes.get(deviceId);
+                        if (device) {
+                            device._eventEmitter.emit('onUploadProgress', status, percentage);
+                        } else {
+                            _JabraNativeAddonLog(AddonLogSeverity.error, "onUploadProgress callback", "Could not lookup device with id " + deviceId);
+                        }
+                    } catch (err) {
+                        // Log but do not propagate js errors into native caller (or node process will be aborted):
+                        _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onUploadProgress callback", err)
                     }
-                } catch (err) {
-                    // Log but do not propagate js errors into native caller (or node process will be aborted):
-                    _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onGNPBtnEventChange callback", err)
-                }
-            }, (deviceId, dectInfo) => {
-                try {
-                    _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onDectInfoEvent", (() => `onDectInfoEvent event received from native sdk with dectInfo=${dectInfo}`));
-                    let device = this.deviceTypes.get(deviceId);
-                    if (device) {
-                        device._eventEmitter.emit('onDectInfoEvent', dectInfo);
-                    } else {
-                        _JabraNativeAddonLog(AddonLogSeverity.error, "onDectInfoEvent callback", "Could not lookup device with id " + deviceId);
+                },
+                pairingList: (deviceId, pairedListInfo) => {
+                    try {
+                        _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onBTParingListChange", (() => `onBTParingListChange event received from native sdk with pairedListInfo ${JSON.stringify(pairedListInfo, null, 3)}`));
+                        let device = this.deviceTypes.get(deviceId);
+                        if (device) {
+                            device._eventEmitter.emit('onBTParingListChange', pairedListInfo);
+                        } else {
+                            _JabraNativeAddonLog(AddonLogSeverity.error, "onBTParingListChange callback", "Could not lookup device with id " + deviceId);
+                        }
+                    } catch (err) {
+                        // Log but do not propagate js errors into native caller (or node process will be aborted):
+                        _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onBTParingListChange callback", err)
+                    }
+                },
+                gnpButton: (deviceId, buttonPairs, catalogueRevision) => {
+                    try {
+                        _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onGNPBtnEvent", (() => `onGNPBtnEvent event received from native sdk with buttonPairs=${buttonPairs}, catalogueRevision=${catalogueRevision}`));
+                        let device = this.deviceTypes.get(deviceId);
+                        if (device) {
+                            device._eventEmitter.emit('onGNPBtnEvent', device._resolveGnpButtonEvents(buttonPairs, catalogueRevision));
+                        } else {
+                            _JabraNativeAddonLog(AddonLogSeverity.error, "onGNPBtnEventChange callback", "Could not lookup device with id " + deviceId);
+                        }
+                    } catch (err) {
+                        // Log but do not propagate js errors into native caller (or node process will be aborted):
+                        _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onGNPBtnEventChange callback", err)
+                    }
+                },
+                dectInfo: (deviceId, dectInfo) => {
+                    try {
+                        _JabraNativeAddonLog(AddonLogSeverity.verbose, "JabraType::constructor::onDectInfoEvent", (() => `onDectInfoEvent event received from native sdk with dectInfo=${dectInfo}`));
+                        let device = this.deviceTypes.get(deviceId);
+                        if (device) {
+                            device._eventEmitter.emit('onDectInfoEvent', dectInfo);
+                        } else {
+                            _JabraNativeAddonLog(AddonLogSeverity.error, "onDectInfoEvent callback", "Could not lookup device with id " + deviceId);
+                        }
+                    } catch (err) {
+                        // Log but do not propagate js errors into native caller (or node process will be aborted):
+                        _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onDectInfoEvent callback", err);
                     }
-                } catch (err) {
-                    // Log but do not propagate js errors into native caller (or node process will be aborted):
-                    _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor::onDectInfoEvent callback", err);
                 }
-            },
-            configParams);  
+            };
+
+            try {
+                sdkIntegration.Initialize(appID, _createNativeEventDispatcher(eventHandlers), configParams);
+            } catch (err) {
+                // F.x. if the Jabra SDK library could not be loaded:
+                _JabraNativeAddonLog(AddonLogSeverity.error, "JabraType::constructor", err);
+                reject(err);
+                firstScanForDevicesDoneReject(err);
+            }
         });
     }
 
@@ -339,16 +377,101 @@ export class JabraType implements MetaApi {
         return result;
     }
 
+    /**
+     * Get all currently attached Jabra devices in one call, directly from the Jabra SDK rather than from
+     * attach events delivered so far, so a UI can render all devices at once at startup. Devices not
+     * reported by an attach event yet are included (their later attach event passes the same DeviceType,
+     * updated with the device info and attach time of the event).
+     * 
+     * The identity (ESN, firmware version and supported features) of all devices is prefetched in a single
+     * native batch, and the returned ready promise resolves once it is done.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the prefetch.
+     * @returns {AttachedDevicesSnapshot} - The attached devices and the ready promise.
+     */
+    getAttachedDevicesSnapshot(options?: CallOptions): AttachedDevicesSnapshot {
+        _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getAttachedDevicesSnapshot.name, "called");
+        const snapshot_time_ms = Date.now();
+        const devices = sdkIntegration.GetAttachedDevices().map((deviceInfo) => this._getOrAddDeviceType(deviceInfo, snapshot_time_ms));
+        _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getAttachedDevicesSnapshot.name, "returned", devices);
+        return { devices, ready: this._prefetchIdentities(devices, options) };
+    }
+
+    /**
+     * Get the DeviceType of an attached device. The known one is only reused (and its device info updated) if it is
+     * the same device, as device IDs may be reused. A different device known by the same ID was missed detaching, so
+     * it is reported as detached and replaced by a new DeviceType.
+     *
+     * @param attached_time_ms - Attach time of a new DeviceType.
+     * @param event_time_ms - Time of the attach event, if from one - also updates the attach time of a known device.
+     *
+     * @internal
+     * @hidden
+     */
+    private _getOrAddDeviceType(deviceInfo: DeviceInfo, attached_time_ms: number, event_time_ms?: number): DeviceType {
+        const known = this.deviceTypes.get(deviceInfo.deviceID);
+        if (known) {
+            if (known._isSameDevice(deviceInfo)) {
+                known._updateDeviceInfo(deviceInfo, event_time_ms);
+                return known;
+            }
+
+            _JabraNativeAddonLog(AddonLogSeverity.warning, this._getOrAddDeviceType.name, "Replacing device with reused id " + deviceInfo.deviceID);
+            // Assign to detached_time_ms even though it is formally a readonly because we don't want clients to change it.
+            (known.detached_time_ms as DeviceType['detached_time_ms']) = attached_time_ms;
+            this.deviceTypes.delete(deviceInfo.deviceID);
+            this.eventEmitter.emit('detach', known);
+        }
+
+        const deviceType = new DeviceType(deviceInfo, attached_time_ms);
+        this.deviceTypes.set(deviceInfo.deviceID, deviceType);
+        return deviceType;
+    }
+
+    /**
+     * Fetch the identity of devices - ESN and firmware version with one batch, and supported features from
+     * the native capability cache.
+     *
+     * @internal
+     * @hidden
+     */
+    private _prefetchIdentities(devices: DeviceType[], options?: CallOptions): Promise<DeviceIdentity[]> {
+        const operations: BatchOperationDescriptor[] = [];
+        for (const device of devices) {
+            operations.push({ deviceId: device.deviceID, operation: 'GetESN' }, { deviceId: device.deviceID, operation: 'GetFirmwareVersion' });
+        }
+
+        const batch = operations.length > 0 ? this.executeBatchAsync(operations, options) : Promise.resolve<BatchOperationResult[]>([]);
+        const features = Promise.all(devices.map((device) => device.getSupportedFeaturesAsync(options).then(
+            (supportedFeatures): BatchOperationResult => ({ result: supportedFeatures }),
+            (error): BatchOperationResult => ({ error }))));
+
+        return Promise.all([batch, features]).then(([batchResults, featureResults]) => devices.map((device, i) => {
+            const esn = batchResults[2 * i];
+            const firmwareVersion = batchResults[2 * i + 1];
+            return {
+                deviceID: device.deviceID,
+                ESN: esn.result,
+                firmwareVersion: firmwareVersion.result,
+                supportedFeatures: featureResults[i].result,
+                error: esn.error || firmwareVersion.error || featureResults[i].error
+            };
+        }), (error) => devices.map((device) => ({ deviceID: device.deviceID, error }))).then((identities) => {
+            _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getAttachedDevicesSnapshot.name, "identities prefetched", identities);
+            return identities;
+        });
+    }
+
     /**
      * Integrates softphone app to Jabra applications like Jabra Direct(JD) and Jabra Suite for Mac(JMS).
      * @param {string} guid Client unique ID.
      * @param {string} softphoneName Name of the application to be shown in JD or JMS.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`. 
      * - Returns `true` if softphone app integrates to Jabra application, `false` otherwise.
      */   
-    connectToJabraApplicationAsync(guid: string, softphoneName: string): Promise<boolean> {
+    connectToJabraApplicationAsync(guid: string, softphoneName: string, options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.connectToJabraApplicationAsync.name, "called with ", guid, softphoneName);
-        return util.promisify(sdkIntegration.ConnectToJabraApplication)(guid, softphoneName).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.ConnectToJabraApplication(guid, softphoneName, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.connectToJabraApplicationAsync.name, "returned", result);
             return result;
         });
@@ -356,11 +479,12 @@ export class JabraType implements MetaApi {
 
     /**
      * Disconnects connected from Jabra applications.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`. 
      */
-    disconnectFromJabraApplicationAsync(): Promise<void> {
+    disconnectFromJabraApplicationAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.disconnectFromJabraApplicationAsync.name, "called");        
-        return util.promisify(sdkIntegration.DisconnectFromJabraApplication)().then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.DisconnectFromJabraApplication(nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.disconnectFromJabraApplicationAsync.name, "returned");
         });
     }
@@ -368,23 +492,25 @@ export class JabraType implements MetaApi {
     /**
      * Sets the softphone to Ready. Currently applicable for only Jabra Direct.
      * @param {boolean} isReady Sets the softphone readiness state.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    setSoftphoneReadyAsync(isReady: boolean): Promise<void> {
+    setSoftphoneReadyAsync(isReady: boolean, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setSoftphoneReadyAsync.name, "called with", isReady);
-        return util.promisify(sdkIntegration.SetSoftphoneReady)(isReady).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetSoftphoneReady(isReady, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setSoftphoneReadyAsync.name, "returned");
         });
     }
 
     /**
      * Indicates whether the softphone is in focus.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - Returns `true` if softphone is in focus, `false` otherwise.
      */
-    isSoftphoneInFocusAsync(): Promise<boolean> {
+    isSoftphoneInFocusAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isSoftphoneInFocusAsync.name, "called"); 
-        return util.promisify(sdkIntegration.IsSoftphoneInFocus)().then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsSoftphoneInFocus(nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isSoftphoneInFocusAsync.name, "returned with", result);
             return result;
         });
@@ -402,11 +528,12 @@ export class JabraType implements MetaApi {
 
     /**
      * Get the SDK version.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<string, JabraError>} - Resolve SDK version `string` if successful otherwise Reject with `error`.
      */
-    getSDKVersionAsync(): Promise<string> {
+    getSDKVersionAsync(options?: CallOptions): Promise<string> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSDKVersionAsync.name, "called");
-        return util.promisify(sdkIntegration.GetVersion)().then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetVersion(nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSDKVersionAsync.name, "returned with", result);
             return result;
         });
@@ -415,16 +542,49 @@ export class JabraType implements MetaApi {
     /**
      * Get return error string from a previously returned SDK error status.
      * @param {number} errStatusCode Status code of the error from the Jabra Device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<string, JabraError>} - Resolve Error String `string` if successful otherwise Reject with `error`.
     */
-    getErrorStringAsync(errStatusCode: number): Promise<string> {
+    getErrorStringAsync(errStatusCode: number, options?: CallOptions): Promise<string> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getErrorStringAsync.name, "called"); 
-        return util.promisify(sdkIntegration.GetErrorString)(errStatusCode).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetErrorString(errStatusCode, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getErrorStringAsync.name, "returned with", result);
             return result;
         });
     }
 
+    /**
+     * Get native diagnostics, such as the state of the executor running async sdk calls and
+     * counters for calls reported as stuck. For troubleshooting and performance tuning only.
+     * @returns {Promise<NativeMetrics, JabraError>} - Resolve `NativeMetrics` if successful otherwise Reject with `error`.
+     */
+    getNativeMetricsAsync(): Promise<NativeMetrics> {
+        _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getNativeMetricsAsync.name, "called");
+        try {
+            const result = sdkIntegration.GetNativeMetrics();
+            _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getNativeMetricsAsync.name, "returned with", result);
+            return Promise.resolve(result);
+        } catch (err) {
+            return Promise.reject(err);
+        }
+    }
+
+    /**
+     * Run many device operations (f.x. refreshing battery, serial number, firmware version and feature flags
+     * of devices) in one native call. Operations for the same device are executed in the given order.
+     * @param {BatchOperationDescriptor[]} operations - Operations to execute.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
+     * @returns {Promise<BatchOperationResult[], JabraError>} - Resolve with a `result` or an `error` per operation (in 
+     * the same order as the operations) if successful otherwise Reject with `error`.
+     */
+    executeBatchAsync(operations: BatchOperationDescriptor[], options?: CallOptions): Promise<BatchOperationResult[]> {
+        _JabraNativeAddonLog(AddonLogSeverity.verbose, this.executeBatchAsync.name, "called with", operations);
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.ExecuteBatch(operations, nativeOptions)).then((result) => {
+            _JabraNativeAddonLog(AddonLogSeverity.verbose, this.executeBatchAsync.name, "returned with", result);
+            return result;
+        });
+    }
+
     /** 
      * Internal function for N-API experimentation only - it may be removed/changed at 
      * any time without warning - do not call.
@@ -0,0 +1,354 @@
+#include "attachprefetch.h"
+#include "capabilities.h"
+#include "metadatacache.h"
+#include "sdkexecutor.h"
+
+#include <algorithm>
+
+/**
+ * Names of the prefetch items in the attachPrefetch config param and in the prefetched identity.
+ */
+static const std::pair<PrefetchItem, const char *> itemNames[] = {
+  { PrefetchItem::ESN, "ESN" },
+  { PrefetchItem::FIRMWARE_VERSION, "firmwareVersion" },
+  { PrefetchItem::SKU, "sku" },
+  { PrefetchItem::HW_AND_CONFIG_VERSION, "hwAndConfigVersion" },
+  { PrefetchItem::MULTI_ESN, "multiESN" },
+  { PrefetchItem::BATTERY_STATUS, "batteryStatus" },
+  { PrefetchItem::IMAGE_THUMBNAIL_PATH, "deviceImageThumbnailPath" }
+};
+
+static bool has(uint32_t items, PrefetchItem item) {
+  return (items & static_cast<uint32_t>(item)) != 0;
+}
+
+Napi::Object PrefetchedIdentity::toNapi(const Napi::Env& env, unsigned short deviceId) const {
+  Napi::Object result = Napi::Object::New(env);
+
+  result.Set(Napi::String::New(env, "deviceID"), Napi::Number::New(env, deviceId));
+  if (has(fetched, PrefetchItem::ESN)) {
+    result.Set(Napi::String::New(env, "ESN"), Napi::String::New(env, esn));
+  }
+  if (has(fetched, PrefetchItem::FIRMWARE_VERSION)) {
+    result.Set(Napi::String::New(env, "firmwareVersion"), Napi::String::New(env, firmwareVersion));
+  }
+  if (has(fetched, PrefetchItem::SKU)) {
+    result.Set(Napi::String::New(env, "sku"), Napi::String::New(env, sku));
+  }
+  if (has(fetched, PrefetchItem::HW_AND_CONFIG_VERSION)) {
+    result.Set(Napi::String::New(env, "hwVersion"), Napi::Number::New(env, hwVersion));
+    result.Set(Napi::String::New(env, "configVersion"), Napi::Number::New(env, configVersion));
+  }
+  if (has(fetched, PrefetchItem::MULTI_ESN)) {
+    Napi::Object jMultiEsn = Napi::Object::New(env);
+    for (const auto& entry : multiEsn) {
+      jMultiEsn.Set(Napi::Number::New(env, entry.first), Napi::String::New(env, entry.second));
+    }
+    result.Set(Napi::String::New(env, "multiESN"), jMultiEsn);
+  }
+  if (has(fetched, PrefetchItem::BATTERY_STATUS)) {
+    // As GetBatteryStatus:
+    Napi::Object jBatteryStatus = Napi::Object::New(env);
+    jBatteryStatus.Set(Napi::String::New(env, "levelInPercent"), Napi::Number::New(env, batteryLevelInPercent));
+    jBatteryStatus.Set(Napi::String::New(env, "charging"), Napi::Boolean::New(env, batteryCharging));
+    jBatteryStatus.Set(Napi::String::New(env, "batteryLow"), Napi::Boolean::New(env, batteryLow));
+    result.Set(Napi::String::New(env, "batteryStatus"), jBatteryStatus);
+  }
+  if (has(fetched, PrefetchItem::IMAGE_THUMBNAIL_PATH)) {
+    result.Set(Napi::String::New(env, "deviceImageThumbnailPath"), Napi::String::New(env, imageThumbnailPath));
+  }
+  if (!error.empty()) {
+    result.Set(Napi::String::New(env, "error"), Napi::Error::New(env, error).Value());
+  }
+  result.Set(Napi::String::New(env, "prefetchMs"), Napi::Number::New(env, prefetchMs));
+
+  return result;
+}
+
+/**
+ * Runs a prefetch on the strand of the device.
+ */
+class AttachPrefetch::PrefetchTask : public util::SdkTask {
+  public:
+    explicit PrefetchTask(const std::shared_ptr<Job>& job) : job(job) {}
+
+    const char * name() const override {
+      return "AttachPrefetch";
+    }
+
+    int strand() const override {
+      return job->deviceId;
+    }
+
+    void run() override {
+      AttachPrefetch::instance().run(job);
+    }
+
+    void complete() override {}
+
+  private:
+    const std::shared_ptr<Job> job;
+};
+
+AttachPrefetch& AttachPrefetch::instance() {
+  static AttachPrefetch prefetch;
+  return prefetch;
+}
+
+AttachPrefetch::AttachPrefetch() : items(0), stopped(false), prefetchedCount(0), failedCount(0), cancelledCount(0) {
+}
+
+void AttachPrefetch::configure(Napi::Object& config) {
+  uint32_t configured = 0;
+  if (config.Has("attachPrefetch") && config.Get("attachPrefetch").IsArray()) {
+    Napi::Array attachPrefetch = config.Get("attachPrefetch").As<Napi::Array>();
+    for (uint32_t i = 0; i < attachPrefetch.Length(); ++i) {
+      const std::string name = attachPrefetch.Get(i).ToString().Utf8Value();
+      const auto found = std::find_if(std::begin(itemNames), std::end(itemNames), [&name](const std::pair<PrefetchItem, const char *>& item) {
+        return name == item.second;
+      });
+      if (found != std::end(itemNames)) {
+        configured |= static_cast<uint32_t>(found->first);
+      } else {
+        LOG_WARNING_(LOGINSTANCE) << "AttachPrefetch: ignoring unknown attachPrefetch item " << name;
+      }
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  items = configured;
+  stopped = false;
+}
+
+void AttachPrefetch::submit(unsigned short deviceId, unsigned short productId, DeliverFunction deliver) {
+  const auto job = std::make_shared<Job>(Job{ deviceId, productId, std::move(deliver) });
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (stopped) {
+      return; // Uninitializing.
+    }
+    queue.push_back(job);
+  }
+  util::SdkExecutor::instance().post(new PrefetchTask(job));
+}
+
+void AttachPrefetch::cancel(unsigned short deviceId, std::function<void()> detached) {
+  std::vector<std::shared_ptr<Job>> cancelled;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto job = queue.begin(); job != queue.end(); ) {
+      if ((*job)->deviceId == deviceId) {
+        cancelled.push_back(std::move(*job));
+        job = queue.erase(job);
+      } else {
+        ++job;
+      }
+    }
+    cancelledCount += cancelled.size();
+
+    if (running.count(deviceId) > 0) {
+      // Called by the prefetch task once the attach is delivered (cancelled jobs are queued after the running one):
+      detachedWhileRunning[deviceId].push_back([cancelled, detached]() {
+        for (const auto& job : cancelled) {
+          job->deliver(nullptr);
+        }
+        detached();
+      });
+      return;
+    }
+  }
+
+  for (const auto& job : cancelled) {
+    job->deliver(nullptr);
+  }
+  detached();
+}
+
+void AttachPrefetch::stop() {
+  std::unique_lock<std::mutex> lock(mutex);
+  stopped = true;
+  queue.clear(); // Their tasks find nothing to do.
+  idle.wait(lock, [this]() { return running.empty(); });
+  detachedWhileRunning.clear();
+}
+
+void AttachPrefetch::run(const std::shared_ptr<Job>& job) {
+  uint32_t wanted;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto queued = std::find(queue.begin(), queue.end(), job);
+    if (queued == queue.end()) {
+      return; // Delivered on detach, or dropped by stop().
+    }
+    queue.erase(queued);
+    running.insert(job->deviceId); // Only one at a time, as all prefetches of a device run on its strand.
+    wanted = items;
+  }
+
+  // Static capabilities first, as javascript may rely on them as soon as it learns about the device:
+  try {
+    DeviceMetadataCache::instance().loadDevice(job->deviceId, job->productId);
+  } catch (const std::exception& e) {
+    LOG_ERROR_(LOGINSTANCE) << "AttachPrefetch: metadata of device #" << job->deviceId << " could not be loaded: " << e.what();
+  }
+
+  std::shared_ptr<const PrefetchedIdentity> identity;
+  if (wanted != 0) {
+    try {
+      identity = fetch(job->deviceId, wanted);
+    } catch (const std::exception& e) {
+      LOG_ERROR_(LOGINSTANCE) << "AttachPrefetch: prefetch of device #" << job->deviceId << " failed: " << e.what();
+    }
+  }
+
+  try {
+    job->deliver(identity);
+  } catch (const std::exception& e) {
+    LOG_ERROR_(LOGINSTANCE) << "AttachPrefetch: delivery for device #" << job->deviceId << " failed: " << e.what();
+  }
+
+  // Post detaches that happened meanwhile before the device can be prefetched again:
+  for (;;) {
+    std::vector<std::function<void()>> detaches;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      const auto found = detachedWhileRunning.find(job->deviceId);
+      if (found == detachedWhileRunning.end()) {
+        running.erase(job->deviceId);
+        if (wanted != 0) {
+          ++prefetchedCount;
+          if (!identity || !identity->error.empty()) {
+            ++failedCount;
+          }
+        }
+        if (running.empty()) {
+          idle.notify_all();
+        }
+        return;
+      }
+      detaches = std::move(found->second);
+      detachedWhileRunning.erase(found);
+    }
+    for (const auto& detached : detaches) {
+      try {
+        detached();
+      } catch (const std::exception& e) {
+        LOG_ERROR_(LOGINSTANCE) << "AttachPrefetch: detach of device #" << job->deviceId << " failed: " << e.what();
+      }
+    }
+  }
+}
+
+std::shared_ptr<const PrefetchedIdentity> AttachPrefetch::fetch(unsigned short deviceId, uint32_t wanted) {
+  const uint64_t startNs = util::monotonicTimeNs();
+
+  std::shared_ptr<PrefetchedIdentity> identity = std::make_shared<PrefetchedIdentity>();
+  identity->fetched = 0;
+  identity->hwVersion = 0;
+  identity->configVersion = 0;
+  identity->batteryLevelInPercent = 0;
+  identity->batteryCharging = false;
+  identity->batteryLow = false;
+
+  const auto fetched = [&identity](PrefetchItem item) {
+    identity->fetched |= static_cast<uint32_t>(item);
+  };
+  const auto failed = [&identity, deviceId](const char * functionName, const std::string& reason) {
+    LOG_WARNING_(LOGINSTANCE) << "AttachPrefetch: " << functionName << " failed for device #" << deviceId << ": " << reason;
+    if (identity->error.empty()) {
+      identity->error = std::string(functionName) + " failed with " + reason;
+    }
+  };
+
+  Jabra_ReturnCode retv;
+  if (has(wanted, PrefetchItem::ESN)) {
+    char esn[64];
+    if ((retv = Jabra_GetESN(deviceId, &esn[0], sizeof(esn))) == Return_Ok) {
+      identity->esn = esn;
+      fetched(PrefetchItem::ESN);
+    } else {
+      failed("Jabra_GetESN", "Jabra_SDK error " + std::to_string(retv));
+    }
+  }
+
+  if (has(wanted, PrefetchItem::FIRMWARE_VERSION)) {
+    char firmwareVersion[64];
+    if ((retv = Jabra_GetFirmwareVersion(deviceId, &firmwareVersion[0], sizeof(firmwareVersion))) == Return_Ok) {
+      identity->firmwareVersion = firmwareVersion;
+      fetched(PrefetchItem::FIRMWARE_VERSION);
+    } else {
+      failed("Jabra_GetFirmwareVersion", "Jabra_SDK error " + std::to_string(retv));
+    }
+  }
+
+  if (has(wanted, PrefetchItem::SKU)) {
+    char sku[64];
+    if ((retv = Jabra_GetSku(deviceId, &sku[0], sizeof(sku))) == Return_Ok) {
+      identity->sku = sku;
+      fetched(PrefetchItem::SKU);
+    } else {
+      failed("Jabra_GetSku", "Jabra_SDK error " + std::to_string(retv));
+    }
+  }
+
+  if (has(wanted, PrefetchItem::HW_AND_CONFIG_VERSION)) {
+    if ((retv = Jabra_GetHwAndConfigVersion(deviceId, &identity->hwVersion, &identity->configVersion)) == Return_Ok) {
+      fetched(PrefetchItem::HW_AND_CONFIG_VERSION);
+    } else {
+      failed("Jabra_GetHwAndConfigVersion", "Jabra_SDK error " + std::to_string(retv));
+    }
+  }
+
+  if (has(wanted, PrefetchItem::MULTI_ESN)) {
+    if (Map_Int_String * const multiEsn = Jabra_GetMultiESN(deviceId)) {
+      for (int i = 0; i < multiEsn->length; ++i) {
+        identity->multiEsn.emplace_back(multiEsn->entries[i].key, multiEsn->entries[i].value ? multiEsn->entries[i].value : "");
+      }
+      Jabra_FreeMap(multiEsn);
+      fetched(PrefetchItem::MULTI_ESN);
+    } else {
+      failed("Jabra_GetMultiESN", "no result");
+    }
+  }
+
+  if (has(wanted, PrefetchItem::BATTERY_STATUS)) {
+    // Devices without a battery are not an error (the capability is cached at attach):
+    bool supported = true;
+    DeviceCapabilityCache::instance().get(deviceId, DeviceCapability::BATTERY_STATUS, supported);
+    if (supported) {
+      if ((retv = Jabra_GetBatteryStatus(deviceId, &identity->batteryLevelInPercent, &identity->batteryCharging, &identity->batteryLow)) == Return_Ok) {
+        fetched(PrefetchItem::BATTERY_STATUS);
+      } else if (retv != Not_Supported) {
+        failed("Jabra_GetBatteryStatus", "Jabra_SDK error " + std::to_string(retv));
+      }
+    }
+  }
+
+  if (has(wanted, PrefetchItem::IMAGE_THUMBNAIL_PATH)) {
+    if (char * const path = Jabra_GetDeviceImageThumbnailPath(deviceId)) {
+      identity->imageThumbnailPath = path;
+      Jabra_FreeString(path);
+      fetched(PrefetchItem::IMAGE_THUMBNAIL_PATH);
+    } else {
+      failed("Jabra_GetDeviceImageThumbnailPath", "no result");
+    }
+  }
+
+  const uint64_t endNs = util::monotonicTimeNs();
+  latency.add(startNs, endNs);
+  identity->prefetchMs = (double)(endNs - startNs) / 1000000.0;
+
+  LOG_VERBOSE_(LOGINSTANCE) << "AttachPrefetch: prefetched identity of device #" << deviceId << " in " << identity->prefetchMs << " ms";
+  return identity;
+}
+
+AttachPrefetchStats AttachPrefetch::getStats() {
+  AttachPrefetchStats stats;
+  std::lock_guard<std::mutex> lock(mutex);
+  stats.items = items;
+  stats.prefetched = prefetchedCount;
+  stats.failed = failedCount;
+  stats.cancelled = cancelledCount;
+  stats.latency = latency.getSnapshot();
+  return stats;
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "stdafx.h"
+#include "latencyhistogram.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Parts of the device identity that can be prefetched when a device is attached (bit flags).
+ */
+enum class PrefetchItem : uint32_t {
+  ESN = 1 << 0,
+  FIRMWARE_VERSION = 1 << 1,
+  SKU = 1 << 2,
+  HW_AND_CONFIG_VERSION = 1 << 3,
+  MULTI_ESN = 1 << 4,
+  BATTERY_STATUS = 1 << 5,
+  IMAGE_THUMBNAIL_PATH = 1 << 6
+};
+
+/**
+ * Identity of a device fetched from libjabra when it was attached. Only the configured items are set, and only
+ * if they could be fetched (see fetched).
+ */
+struct PrefetchedIdentity {
+  uint32_t fetched;                              // PrefetchItem flags of the items fetched successfully.
+  std::string esn;
+  std::string firmwareVersion;
+  std::string sku;
+  unsigned short hwVersion;
+  unsigned short configVersion;
+  std::vector<std::pair<int, std::string>> multiEsn; // (component, ESN)
+  int batteryLevelInPercent;
+  bool batteryCharging;
+  bool batteryLow;
+  std::string imageThumbnailPath;
+  std::string error;                             // First error, if any item could not be fetched.
+  double prefetchMs;
+
+  /**
+   * Convert to { ESN, firmwareVersion, sku, hwVersion, configVersion, multiESN, batteryStatus,
+   * deviceImageThumbnailPath, error, prefetchMs } (items not fetched are left out).
+   */
+  Napi::Object toNapi(const Napi::Env& env, unsigned short deviceId) const;
+};
+
+/**
+ * Counters of the attach prefetching (for diagnostics only).
+ */
+struct AttachPrefetchStats {
+  uint32_t items;    // PrefetchItem flags configured (0 = disabled).
+  uint64_t prefetched;
+  uint64_t failed;   // Prefetches where at least one item could not be fetched.
+  uint64_t cancelled; // Detached before the prefetch started.
+  util::LatencyHistogramSnapshot latency;
+};
+
+/**
+ * Prepares attached devices before their attach event is posted: Loads their static metadata (capabilities and button
+ * catalogue, see DeviceMetadataCache) and prefetches an opt-in, configurable device identity (ESN, firmware version,
+ * SKU etc.), so it can be passed with the attach event instead of javascript asking for each part separately
+ * afterwards.
+ *
+ * Each prefetch is a task on the strand of the device (see SdkExecutor), so devices attached in bursts (f.x. headsets
+ * of a DECT base) are prefetched concurrently without holding up the libjabra attach thread, while the prefetch of a
+ * device is serialized with all other calls for it.
+ *
+ * Thread-safe: Configured and stopped on the node main thread, and used from the libjabra attach/detach callback
+ * threads and executor threads.
+ */
+class AttachPrefetch {
+  public:
+    /**
+     * Called with the prefetched identity, or nullptr if no identity is configured or the device was detached before
+     * it was prefetched.
+     */
+    typedef std::function<void(std::shared_ptr<const PrefetchedIdentity>)> DeliverFunction;
+
+    static AttachPrefetch& instance();
+
+    /**
+     * Set the items to prefetch from the native config params (attachPrefetch: item names), and accept prefetches
+     * again after stop(). The SdkExecutor must be started.
+     */
+    void configure(Napi::Object& config);
+
+    bool isEnabled() const {
+      return items != 0;
+    }
+
+    /**
+     * Load the metadata and prefetch the identity (if enabled) of an attached device in a task on its strand, which
+     * then calls deliver. Dropped once stopped.
+     */
+    void submit(unsigned short deviceId, unsigned short productId, DeliverFunction deliver);
+
+    /**
+     * A device was detached: Deliver its queued prefetch without identity right away, and call detached once its
+     * attach has been delivered (at once, unless it is being prefetched), so the attach event is always posted before
+     * the detach event. Never waits for libjabra calls.
+     */
+    void cancel(unsigned short deviceId, std::function<void()> detached);
+
+    /**
+     * Stop prefetching (on uninitialize, before Jabra_Uninitialize): Drop all queued prefetches and wait for running
+     * ones to be delivered, so no prefetch calls libjabra or delivers once this returns.
+     */
+    void stop();
+
+    AttachPrefetchStats getStats();
+
+  private:
+    class PrefetchTask;
+
+    struct Job {
+      unsigned short deviceId;
+      unsigned short productId;
+      DeliverFunction deliver;
+    };
+
+    AttachPrefetch();
+    AttachPrefetch(const AttachPrefetch&) = delete;
+    AttachPrefetch& operator=(const AttachPrefetch&) = delete;
+
+    /**
+     * Run a prefetch on an executor thread, unless it was cancelled or dropped meanwhile.
+     */
+    void run(const std::shared_ptr<Job>& job);
+    std::shared_ptr<const PrefetchedIdentity> fetch(unsigned short deviceId, uint32_t wanted);
+
+    std::atomic<uint32_t> items;
+
+    // Guards everything below.
+    std::mutex mutex;
+    std::condition_variable idle; // Notified when no device is being prefetched.
+    bool stopped;
+    std::deque<std::shared_ptr<Job>> queue; // Submitted, but not started yet.
+    std::set<unsigned short> running;       // Devices being prefetched.
+    std::unordered_map<unsigned short, std::vector<std::function<void()>>> detachedWhileRunning;
+    uint64_t prefetchedCount;
+    uint64_t failedCount;
+    uint64_t cancelledCount;
+    util::LatencyHistogram latency;
+};
@@ -0,0 +1,442 @@
+#include "batch.h"
+
+#include <chrono>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Plain (napi free) value passed to or returned from a batch operation.
+ */
+struct BatchScalar {
+  enum Kind { UNDEFINED, BOOLEAN, NUMBER, STRING };
+
+  Kind kind;
+  bool boolean;
+  double number;
+  std::string string;
+
+  BatchScalar() : kind(UNDEFINED), boolean(false), number(0), string() {}
+
+  static BatchScalar Boolean(bool value) {
+    BatchScalar result;
+    result.kind = BOOLEAN;
+    result.boolean = value;
+    return result;
+  }
+
+  static BatchScalar Number(double value) {
+    BatchScalar result;
+    result.kind = NUMBER;
+    result.number = value;
+    return result;
+  }
+
+  static BatchScalar String(const std::string& value) {
+    BatchScalar result;
+    result.kind = STRING;
+    result.string = value;
+    return result;
+  }
+};
+
+/**
+ * Result of a batch operation - a scalar or (if fields are non-empty) a flat object.
+ */
+struct BatchValue : public BatchScalar {
+  std::vector<std::pair<std::string, BatchScalar>> fields;
+
+  BatchValue() : BatchScalar(), fields() {}
+  BatchValue(const BatchScalar& scalar) : BatchScalar(scalar), fields() {}
+};
+
+typedef std::vector<BatchScalar> BatchArgs;
+typedef BatchValue (*BatchWorkFunc)(const char * const operationName, unsigned short deviceId, const BatchArgs& args);
+
+/**
+ * A named operation that can be used in a batch. Work is executed on an executor thread.
+ */
+struct BatchOperation {
+  std::vector<BatchScalar::Kind> argumentKinds;
+  BatchWorkFunc work;
+};
+
+/**
+ * A batch descriptor after parsing on the main thread and (after execution) its outcome.
+ */
+struct BatchItem {
+  unsigned short deviceId;
+  std::string operationName;
+  const BatchOperation * operation; // Null if the descriptor could not be parsed (see errorMessage).
+  BatchArgs args;
+  BatchValue result;
+  std::string errorMessage;
+  Jabra_ReturnCode errorCode;
+
+  BatchItem() : deviceId(0), operationName(), operation(nullptr), args(), result(), errorMessage(), errorCode(Return_Ok) {}
+};
+
+static BatchValue getBatteryStatus(const char * const operationName, unsigned short deviceId, const BatchArgs& args) {
+  int levelInPercent;
+  bool charging;
+  bool batteryLow;
+  Jabra_ReturnCode retv;
+  if ((retv = Jabra_GetBatteryStatus(deviceId, &levelInPercent, &charging, &batteryLow)) != Return_Ok) {
+    throw util::JabraReturnCodeException(operationName, retv);
+  }
+
+  // Same fields as GetBatteryStatus.
+  BatchValue result;
+  result.fields.push_back(std::make_pair("levelInPercent", BatchScalar::Number(levelInPercent)));
+  result.fields.push_back(std::make_pair("charging", BatchScalar::Boolean(charging)));
+  result.fields.push_back(std::make_pair("batteryLow", BatchScalar::Boolean(batteryLow)));
+  return result;
+}
+
+static BatchValue getESN(const char * const operationName, unsigned short deviceId, const BatchArgs& args) {
+  char esn[64];
+  Jabra_ReturnCode retv;
+  if ((retv = Jabra_GetESN(deviceId, &esn[0], sizeof(esn))) != Return_Ok) {
+    throw util::JabraReturnCodeException(operationName, retv);
+  }
+  return BatchScalar::String(esn);
+}
+
+static BatchValue getFirmwareVersion(const char * const operationName, unsigned short deviceId, const BatchArgs& args) {
+  char buf[64];
+  Jabra_ReturnCode retv;
+  if ((retv = Jabra_GetFirmwareVersion(deviceId, &buf[0], sizeof(buf))) != Return_Ok) {
+    throw util::JabraReturnCodeException(operationName, retv);
+  }
+  return BatchScalar::String(buf);
+}
+
+static BatchValue setBusyLightStatus(const char * const operationName, unsigned short deviceId, const BatchArgs& args) {
+  Jabra_ReturnCode retv;
+  if ((retv = Jabra_SetBusylightStatus(deviceId, args[0].boolean)) != Return_Ok) {
+    throw util::JabraReturnCodeException(operationName, retv);
+  }
+  return BatchValue();
+}
+
+static BatchValue enableEqualizer(const char * const operationName, unsigned short deviceId, const BatchArgs& args) {
+  Jabra_ReturnCode retv;
+  if ((retv = Jabra_EnableEqualizer(deviceId, args[0].boolean)) != Return_Ok) {
+    throw util::JabraReturnCodeException(operationName, retv);
+  }
+  return BatchValue();
+}
+
+/**
+ * Operations supported in batches (named as the corresponding native functions they mirror).
+ */
+static const std::unordered_map<std::string, BatchOperation>& batchOperations() {
+  static const std::unordered_map<std::string, BatchOperation> operations = {
+    { "GetBatteryStatus", { {}, getBatteryStatus } },
+    { "GetESN", { {}, getESN } },
+    { "GetFirmwareVersion", { {}, getFirmwareVersion } },
+    { "GetBusyLightStatus", { {}, [](const char * const, unsigned short deviceId, const BatchArgs&) { return BatchValue(BatchScalar::Boolean(Jabra_GetBusylightStatus(deviceId))); } } },
+    { "SetBusyLightStatus", { { BatchScalar::BOOLEAN }, setBusyLightStatus } },
+    { "IsFeatureSupported", { { BatchScalar::NUMBER }, [](const char * const, unsigned short deviceId, const BatchArgs& args) { return BatchValue(BatchScalar::Boolean(Jabra_IsFeatureSupported(deviceId, (DeviceFeature)(int)args[0].number))); } } },
+    { "IsEqualizerSupported", { {}, [](const char * const, unsigned short deviceId, const BatchArgs&) { return BatchValue(BatchScalar::Boolean(Jabra_IsEqualizerSupported(deviceId))); } } },
+    { "IsEqualizerEnabled", { {}, [](const char * const, unsigned short deviceId, const BatchArgs&) { return BatchValue(BatchScalar::Boolean(Jabra_IsEqualizerEnabled(deviceId))); } } },
+    { "EnableEqualizer", { { BatchScalar::BOOLEAN }, enableEqualizer } },
+    { "IsRingerSupported", { {}, [](const char * const, unsigned short deviceId, const BatchArgs&) { return BatchValue(BatchScalar::Boolean(Jabra_IsRingerSupported(deviceId))); } } },
+    { "IsOffHookSupported", { {}, [](const char * const, unsigned short deviceId, const BatchArgs&) { return BatchValue(BatchScalar::Boolean(Jabra_IsOffHookSupported(deviceId))); } } },
+    { "IsMuteSupported", { {}, [](const char * const, unsigned short deviceId, const BatchArgs&) { return BatchValue(BatchScalar::Boolean(Jabra_IsMuteSupported(deviceId))); } } },
+    { "IsHoldSupported", { {}, [](const char * const, unsigned short deviceId, const BatchArgs&) { return BatchValue(BatchScalar::Boolean(Jabra_IsHoldSupported(deviceId))); } } },
+    { "IsOnlineSupported", { {}, [](const char * const, unsigned short deviceId, const BatchArgs&) { return BatchValue(BatchScalar::Boolean(Jabra_IsOnlineSupported(deviceId))); } } },
+    { "IsBusyLightSupported", { {}, [](const char * const, unsigned short deviceId, const BatchArgs&) { return BatchValue(BatchScalar::Boolean(Jabra_IsBusylightSupported(deviceId))); } } }
+  };
+  return operations;
+}
+
+/**
+ * Parse a javascript {deviceId, operation, args} descriptor. Problems are reported as an item error.
+ */
+static BatchItem toBatchItem(const Napi::Value& value) {
+  BatchItem item;
+
+  if (!value.IsObject()) {
+    item.errorMessage = "Batch descriptor is not an object";
+    return item;
+  }
+
+  const Napi::Object descriptor = value.As<Napi::Object>();
+  const Napi::Value deviceId = descriptor.Get("deviceId");
+  const Napi::Value operation = descriptor.Get("operation");
+  const Napi::Value args = descriptor.Get("args");
+
+  if (!deviceId.IsNumber() || !operation.IsString()) {
+    item.errorMessage = "Batch descriptor requires a numeric deviceId and an operation name";
+    return item;
+  }
+
+  item.deviceId = (unsigned short)(deviceId.As<Napi::Number>().Int32Value());
+  item.operationName = operation.As<Napi::String>();
+
+  const auto& operations = batchOperations();
+  const auto found = operations.find(item.operationName);
+  if (found == operations.end()) {
+    item.errorMessage = "Unsupported batch operation " + item.operationName;
+    return item;
+  }
+
+  const BatchOperation& batchOperation = found->second;
+  const uint32_t argCount = args.IsArray() ? args.As<Napi::Array>().Length() : 0;
+  if ((!args.IsArray() && !args.IsUndefined()) || argCount != batchOperation.argumentKinds.size()) {
+    item.errorMessage = "Wrong number of arguments to batch operation " + item.operationName + " (expected #" + std::to_string(batchOperation.argumentKinds.size()) + ")";
+    return item;
+  }
+
+  for (uint32_t i = 0; i < argCount; ++i) {
+    const Napi::Value arg = args.As<Napi::Array>()[i];
+    switch (batchOperation.argumentKinds[i]) {
+      case BatchScalar::BOOLEAN:
+        if (arg.IsBoolean()) {
+          item.args.push_back(BatchScalar::Boolean(arg.As<Napi::Boolean>().Value()));
+          continue;
+        }
+        break;
+      case BatchScalar::NUMBER:
+        if (arg.IsNumber()) {
+          item.args.push_back(BatchScalar::Number(arg.As<Napi::Number>().DoubleValue()));
+          continue;
+        }
+        break;
+      case BatchScalar::STRING:
+        if (arg.IsString()) {
+          item.args.push_back(BatchScalar::String(arg.As<Napi::String>()));
+          continue;
+        }
+        break;
+      default:
+        break;
+    }
+
+    item.errorMessage = "Wrong type of argument to batch operation " + item.operationName + " #" + std::to_string(i);
+    item.args.clear();
+    return item;
+  }
+
+  item.operation = &batchOperation;
+  return item;
+}
+
+static Napi::Value toNapiValue(const Napi::Env& env, const BatchScalar& value) {
+  switch (value.kind) {
+    case BatchScalar::BOOLEAN: return Napi::Boolean::New(env, value.boolean);
+    case BatchScalar::NUMBER: return Napi::Number::New(env, value.number);
+    case BatchScalar::STRING: return Napi::String::New(env, value.string);
+    default: return env.Undefined();
+  }
+}
+
+static Napi::Value toNapiValue(const Napi::Env& env, const BatchValue& value) {
+  if (value.fields.empty()) {
+    return toNapiValue(env, static_cast<const BatchScalar&>(value));
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  for (const auto& field : value.fields) {
+    result.Set(Napi::String::New(env, field.first), toNapiValue(env, field.second));
+  }
+  return result;
+}
+
+static Napi::Array toNapiResults(const Napi::Env& env, const std::vector<BatchItem>& done) {
+  Napi::Array napiResult = Napi::Array::New(env, done.size());
+  for (size_t i = 0; i < done.size(); ++i) {
+    const BatchItem& item = done[i];
+    Napi::Object entry = Napi::Object::New(env);
+    if (item.errorMessage.empty()) {
+      entry.Set(Napi::String::New(env, "result"), toNapiValue(env, item.result));
+    } else {
+      Napi::Error error = Napi::Error::New(env, item.errorMessage);
+      if (item.errorCode != Return_Ok) {
+        error.Set(Napi::String::New(env, "code"), Napi::Number::New(env, (int)item.errorCode));
+      }
+      entry.Set(Napi::String::New(env, "error"), error.Value());
+    }
+    napiResult[(uint32_t)i] = entry;
+  }
+  return napiResult;
+}
+
+/**
+ * A batch being executed, with its promise settled once all its per-device tasks are complete (or as soon as one is
+ * abandoned). Used on the node main thread only, except for items, which each BatchDeviceTask updates for its own
+ * indices only.
+ */
+struct BatchJoin {
+  Napi::Env env;
+  Napi::AsyncContext asyncContext;
+  napi_deferred deferred; // Null once settled.
+  std::vector<BatchItem> items;
+  size_t remaining;       // Device tasks not complete yet.
+
+  BatchJoin(const Napi::Env& env, const char * const functionName, std::vector<BatchItem> items)
+    : env(env), asyncContext(env, functionName), deferred(nullptr), items(std::move(items)), remaining(0) {}
+
+  void settle(napi_value value, bool resolve) {
+    if (!deferred) {
+      return;
+    }
+    const napi_status status = resolve ? napi_resolve_deferred(env, deferred, value) : napi_reject_deferred(env, deferred, value);
+    deferred = nullptr;
+    if (status != napi_ok) {
+      throw Napi::Error::New(env);
+    }
+  }
+};
+
+/**
+ * The operations of a batch for one device, run on the strand of that device so they stay in order with all other
+ * calls for it.
+ */
+class BatchDeviceTask : public util::SdkTask {
+  public:
+    BatchDeviceTask(const char * const functionName, const std::shared_ptr<BatchJoin>& join, unsigned short deviceId,
+                    const util::CallOptions& callOptions, const std::chrono::steady_clock::time_point& deadline)
+      : functionName(functionName), join(join), deviceId(deviceId), indices(), callOptions(callOptions), deadlineValue(deadline),
+        skipped(false), skipReason(util::SdkAbandonReason::TIMEOUT) {}
+
+    /**
+     * Add the item at an index of the batch (items are run in the order added).
+     */
+    void add(size_t index) {
+      indices.push_back(index);
+    }
+
+    const char * name() const override {
+      return functionName;
+    }
+
+    int strand() const override {
+      return deviceId;
+    }
+
+    std::chrono::steady_clock::time_point deadline() const override {
+      return deadlineValue;
+    }
+
+    int cancellationId() const override {
+      return callOptions.cancellationId;
+    }
+
+    void run() override {
+      for (const size_t index : indices) {
+        BatchItem& item = join->items[index];
+
+        try {
+          item.result = item.operation->work(item.operationName.c_str(), item.deviceId, item.args);
+        } catch (const util::JabraReturnCodeException& e) {
+          item.errorMessage = e.what();
+          item.errorCode = e.getJabraApiReturnCode();
+        } catch (const std::exception& e) {
+          item.errorMessage = std::string(functionName) + " " + item.operationName + " -> " + e.what();
+        } catch (...) {
+          item.errorMessage = std::string(functionName) + " " + item.operationName + " -> unknown failure";
+        }
+
+        if (!item.errorMessage.empty()) {
+          LOG_ERROR_(LOGINSTANCE) << item.errorMessage;
+        }
+      }
+    }
+
+    void skip(util::SdkAbandonReason reason) override {
+      skipped = true;
+      skipReason = reason;
+    }
+
+    void abandon(util::SdkAbandonReason reason) override {
+      Napi::HandleScope scope(join->env);
+      Napi::CallbackScope callbackScope(join->env, join->asyncContext);
+      join->settle(util::AbandonedError(join->env, functionName, reason).Value(), false);
+    }
+
+    void complete() override {
+      Napi::HandleScope scope(join->env);
+      Napi::CallbackScope callbackScope(join->env, join->asyncContext);
+
+      if (skipped) {
+        join->settle(util::AbandonedError(join->env, functionName, skipReason).Value(), false);
+      }
+      if (--join->remaining == 0) {
+        join->settle(toNapiResults(join->env, join->items), true);
+      }
+    }
+
+  private:
+    const char * const functionName;
+    const std::shared_ptr<BatchJoin> join;
+    const unsigned short deviceId;
+    std::vector<size_t> indices;
+    const util::CallOptions callOptions;
+    const std::chrono::steady_clock::time_point deadlineValue;
+    bool skipped;
+    util::SdkAbandonReason skipReason;
+};
+
+Napi::Value napi_ExecuteBatch(const Napi::CallbackInfo& info) {
+  const char * const functionName = __func__;
+  Napi::Env env = info.Env();
+
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::ARRAY}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
+    const Napi::Array descriptors = info[0].As<Napi::Array>();
+
+    std::vector<BatchItem> items;
+    items.reserve(descriptors.Length());
+    for (uint32_t i = 0; i < descriptors.Length(); ++i) {
+      items.push_back(toBatchItem(descriptors[i]));
+    }
+
+    auto join = std::make_shared<BatchJoin>(env, functionName, std::move(items));
+    napi_value promise;
+    if (napi_create_promise(env, &join->deferred, &promise) != napi_ok) {
+      throw Napi::Error::New(env);
+    }
+
+    // Same deadline as an async worker of the NORMAL class (see SdkAsyncWorker::Queue) for all devices:
+    util::SdkExecutor& executor = util::SdkExecutor::instance();
+    const unsigned int timeoutMs = callOptions.hasTimeout ? callOptions.timeoutMs : executor.getDefaultTimeout();
+    const auto deadline = timeoutMs != util::SdkExecutor::NO_TIMEOUT ? std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs)
+                                                                       : std::chrono::steady_clock::time_point::max();
+
+    // One task per device on the strand of the device, so the operations of each device are run in list order and in
+    // order with all other calls for the device, while different devices are still run in parallel:
+    std::vector<BatchDeviceTask *> tasks;
+    std::unordered_map<unsigned short, BatchDeviceTask *> deviceTasks;
+    for (size_t i = 0; i < join->items.size(); ++i) {
+      const BatchItem& item = join->items[i];
+      if (!item.operation) {
+        continue;
+      }
+      BatchDeviceTask *& task = deviceTasks[item.deviceId];
+      if (!task) {
+        task = new BatchDeviceTask(functionName, join, item.deviceId, callOptions, deadline);
+        tasks.push_back(task);
+      }
+      task->add(i);
+    }
+
+    if (tasks.empty()) {
+      join->settle(toNapiResults(env, join->items), true);
+    } else {
+      join->remaining = tasks.size();
+      for (BatchDeviceTask * task : tasks) {
+        executor.submit(env, task);
+      }
+    }
+
+    return Napi::Value(env, promise);
+  }
+
+  return util::RejectedPromise(env, functionName);
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "stdafx.h"
+
+/**
+ * Run a list of {deviceId, operation, args} descriptors in one native call. The operations of each device are run
+ * in list order as one task on the strand of the device (so in order with all other calls for it). Returns a promise
+ * with an array of {result} / {error} per descriptor, settled once the operations of all devices are done.
+ */
+Napi::Value napi_ExecuteBatch(const Napi::CallbackInfo& info);
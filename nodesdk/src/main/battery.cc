@@ -1,4 +1,5 @@
 #include "battery.h"
+#include "capabilities.h"
 
 #include <string.h>
 #include <limits.h>
@@ -20,7 +21,7 @@ class BatteryStatusDto
 
 Napi::Value napi_GetBatteryStatus(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Object, BatteryStatusDto>(functionName, info, 
+  return util::SimpleDeviceAsyncFunction<Napi::Object, BatteryStatusDto>(functionName, util::AsyncOptions::ReadOnly(), info, 
     [functionName](unsigned short deviceId) {
       int levelInPercent;
       bool charging;
@@ -50,21 +51,5 @@ Napi::Value napi_GetBatteryStatus(const Napi::CallbackInfo& info) {
 }
 
 Napi::Value napi_IsBatteryStatusSupported(const Napi::CallbackInfo& info) {
-  const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(functionName, info, 
-    [functionName](unsigned short deviceId) {
-      // Not sure how this was implemented in the previous wrapper implementation
-      int levelInPercent;
-      bool charging;
-      bool batteryLow;
-      Jabra_ReturnCode retv;
-      if ((retv = Jabra_GetBatteryStatus(deviceId, &levelInPercent, &charging, &batteryLow)) == Return_Ok) {
-        return true;
-      }
-      return false;
-    }, 
-    [](const Napi::Env& env, const bool cppResult) { 
-        return Napi::Boolean::New(env, cppResult);
-      }
-  );
-}
\ No newline at end of file
+  return CachedCapabilityFunction(__func__, DeviceCapability::BATTERY_STATUS, info);
+}
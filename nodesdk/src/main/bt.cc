@@ -1,4 +1,5 @@
 #include "bt.h"
+#include "capabilities.h"
 #include <stdlib.h>
 
 // Utility that coverts a hex string to a hex array for BT.
@@ -24,16 +25,20 @@ Napi::Value napi_ConnectNewDevice(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::STRING, util::BOOLEAN, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING, util::STRING, util::BOOLEAN}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     std::string deviceName = info[1].As<Napi::String>();
     const std::string deviceBTAddr = info[2].As<Napi::String>();
     const bool isConnected = info[3].As<Napi::Boolean>().ToBoolean();
-    const Napi::Function javascriptResultCallback = info[4].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, deviceName, deviceBTAddr, isConnected](){ 
         Jabra_PairedDevice pDevice;
         pDevice.deviceName = (char *)deviceName.c_str(); // This ought to be safe as Jabra_ConnectNewDevice should not change this.
@@ -45,26 +50,36 @@ Napi::Value napi_ConnectNewDevice(const Napi::CallbackInfo& info) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_ConnectPairedDevice(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::STRING, util::BOOLEAN, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING, util::STRING, util::BOOLEAN}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     std::string deviceName = info[1].As<Napi::String>();
     std::string deviceBTAddr = info[2].As<Napi::String>();
     bool isConnected = info[3].As<Napi::Boolean>().ToBoolean();
-    Napi::Function javascriptResultCallback = info[4].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, deviceName, deviceBTAddr, isConnected](){ 
         Jabra_PairedDevice pDevice;
         pDevice.deviceName = (char *)deviceName.c_str(); // Hopefully this is safe as Jabra_ConnectPairedDevice should not change this.
@@ -76,10 +91,16 @@ Napi::Value napi_ConnectPairedDevice(const Napi::CallbackInfo& info) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_DisconnectBTDevice(const Napi::CallbackInfo& info) {
@@ -97,16 +118,20 @@ Napi::Value napi_DisconnectPairedDevice(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::STRING, util::BOOLEAN, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING, util::STRING, util::BOOLEAN}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     std::string deviceName = info[1].As<Napi::String>();
     std::string deviceBTAddr = info[2].As<Napi::String>();
     bool isConnected = info[3].As<Napi::Boolean>().ToBoolean();
-    Napi::Function javascriptResultCallback = info[4].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, deviceName, deviceBTAddr, isConnected](){ 
         Jabra_PairedDevice pDevice;
         pDevice.deviceName = (char *)deviceName.c_str(); // Hopefully this is safe as Jabra_DisConnectPairedDevice should not change this.
@@ -118,16 +143,22 @@ Napi::Value napi_DisconnectPairedDevice(const Napi::CallbackInfo& info) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 
 Napi::Value napi_GetAutoPairing(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(functionName, info, 
+  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(functionName, util::AsyncOptions::ReadOnly(), info, 
     [functionName](unsigned short deviceId) {
       bool autoParing = Jabra_GetAutoPairing(deviceId);
       return autoParing;
@@ -149,16 +180,7 @@ Napi::Value napi_SetAutoPairing(const Napi::CallbackInfo& info) {
 }
 
 Napi::Value napi_IsPairingListSupported(const Napi::CallbackInfo& info) {
-  const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(functionName, info, 
-    [functionName](unsigned short deviceId) {
-      bool pairingListSupported = Jabra_IsPairingListSupported(deviceId);
-      return pairingListSupported;
-    }, 
-    [](const Napi::Env& env, const bool cppResult) { 
-        return Napi::Boolean::New(env, cppResult);
-      }
-  );
+  return CachedCapabilityFunction(__func__, DeviceCapability::PAIRING_LIST, info);
 }
 
 Napi::Value napi_GetPairingList(const Napi::CallbackInfo& info) {
@@ -250,7 +272,7 @@ Napi::Value napi_ConnectBTDevice(const Napi::CallbackInfo& info) {
 
 Napi::Value napi_GetConnectedBTDeviceName(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::String, std::string>(functionName, info, [functionName](unsigned short deviceId) {
+  return util::SimpleDeviceAsyncFunction<Napi::String, std::string>(functionName, util::AsyncOptions::ReadOnly(), info, [functionName](unsigned short deviceId) {
     if (char * result = Jabra_GetConnectedBTDeviceName(deviceId)) {
       std::string managedResult(result);
       Jabra_FreeString(result);
@@ -266,16 +288,20 @@ Napi::Value napi_ClearPairedDevice(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::STRING, util::BOOLEAN, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING, util::STRING, util::BOOLEAN}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     std::string deviceName = info[1].As<Napi::String>();
     const std::string deviceBTAddr = info[2].As<Napi::String>();
     const bool isConnected = info[3].As<Napi::Boolean>().ToBoolean();
-    const Napi::Function javascriptResultCallback = info[4].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, deviceName, deviceBTAddr, isConnected](){ 
         Jabra_PairedDevice pDevice;
         pDevice.deviceName = (char *)deviceName.c_str(); // This ought to be safe as Jabra_ClearPairedDevice should not change this.
@@ -287,10 +313,16 @@ Napi::Value napi_ClearPairedDevice(const Napi::CallbackInfo& info) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_GetSearchDeviceList(const Napi::CallbackInfo& info) {
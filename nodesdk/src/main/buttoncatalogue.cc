@@ -0,0 +1,132 @@
+#include "buttoncatalogue.h"
+#include "propertykeys.h"
+
+#include <algorithm>
+
+DeviceButtonCatalogue& DeviceButtonCatalogue::instance() {
+  static DeviceButtonCatalogue catalogue;
+  return catalogue;
+}
+
+bool DeviceButtonCatalogue::merge(Entry& entry, const ButtonEvent& buttonEvent) {
+  bool added = false;
+
+  for (int i = 0; i < buttonEvent.buttonEventCount; ++i) {
+    const ButtonEventInfo& src = buttonEvent.buttonEventInfo[i];
+
+    auto buttonType = std::find_if(entry.buttonTypes.begin(), entry.buttonTypes.end(), [&src](const ButtonType& t) {
+      return t.key == src.buttonTypeKey;
+    });
+    if (buttonType == entry.buttonTypes.end()) {
+      entry.buttonTypes.push_back({ src.buttonTypeKey, src.buttonTypeValue ? src.buttonTypeValue : "", {} });
+      buttonType = entry.buttonTypes.end() - 1;
+      added = true;
+    }
+
+    for (int j = 0; j < src.buttonEventTypeSize; ++j) {
+      const ButtonEventType& srcEvent = src.buttonEventType[j];
+      auto& events = buttonType->events;
+      if (std::none_of(events.begin(), events.end(), [&srcEvent](const std::pair<unsigned short, std::string>& e) { return e.first == srcEvent.key; })) {
+        events.emplace_back(srcEvent.key, srcEvent.value ? srcEvent.value : "");
+        added = true;
+      }
+    }
+  }
+
+  return added;
+}
+
+std::vector<DeviceButtonCatalogue::ButtonType> DeviceButtonCatalogue::load(unsigned short deviceId) {
+  Entry entry = { 1, {} };
+
+  if (ButtonEvent * const buttonEvent = Jabra_GetSupportedButtonEvents(deviceId)) {
+    merge(entry, *buttonEvent);
+    Jabra_FreeButtonEvents(buttonEvent);
+  }
+
+  LOG_VERBOSE_(LOGINSTANCE) << "Cached " << entry.buttonTypes.size() << " button types of device #" << deviceId;
+
+  set(deviceId, entry.buttonTypes);
+  return entry.buttonTypes;
+}
+
+void DeviceButtonCatalogue::set(unsigned short deviceId, const std::vector<ButtonType>& buttonTypes) {
+  std::lock_guard<std::mutex> lock(mutex);
+  entries[deviceId] = { 1, buttonTypes };
+}
+
+void DeviceButtonCatalogue::remove(unsigned short deviceId) {
+  std::lock_guard<std::mutex> lock(mutex);
+  entries.erase(deviceId);
+}
+
+void DeviceButtonCatalogue::clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  entries.clear();
+}
+
+uint32_t DeviceButtonCatalogue::toPairs(unsigned short deviceId, const ButtonEvent& buttonEvent, std::vector<int32_t>& pairs) {
+  for (int i = 0; i < buttonEvent.buttonEventCount; ++i) {
+    const ButtonEventInfo& src = buttonEvent.buttonEventInfo[i];
+    for (int j = 0; j < src.buttonEventTypeSize; ++j) {
+      pairs.push_back(src.buttonTypeKey);
+      pairs.push_back(src.buttonEventType[j].key);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  Entry& entry = entries[deviceId]; // Revision 0 if the catalogue was never loaded - bumped below.
+  if (merge(entry, buttonEvent) || entry.revision == 0) {
+    ++entry.revision;
+    LOG_DEBUG_(LOGINSTANCE) << "Button catalogue of device #" << deviceId << " extended to revision " << entry.revision;
+  }
+  return entry.revision;
+}
+
+Napi::Object DeviceButtonCatalogue::get(const Napi::Env& env, unsigned short deviceId) const {
+  const PropertyKeys keys(env);
+  ObjectBuilder jButtonType(keys), jEvent(keys);
+
+  Napi::Array jButtonTypes = Napi::Array::New(env);
+  uint32_t revision = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto found = entries.find(deviceId);
+    if (found != entries.end()) {
+      revision = found->second.revision;
+      uint32_t i = 0;
+      for (const ButtonType& buttonType : found->second.buttonTypes) {
+        Napi::Array jEvents = Napi::Array::New(env, buttonType.events.size());
+        uint32_t j = 0;
+        for (const auto& event : buttonType.events) {
+          jEvent.set(PropertyKey::key, Napi::Number::New(env, event.first));
+          jEvent.set(PropertyKey::value, Napi::String::New(env, event.second));
+          jEvents.Set(j++, jEvent.build());
+        }
+
+        jButtonType.set(PropertyKey::buttonTypeKey, Napi::Number::New(env, buttonType.key));
+        jButtonType.set(PropertyKey::buttonTypeValue, Napi::String::New(env, buttonType.value));
+        jButtonType.set(PropertyKey::buttonEventType, jEvents);
+        jButtonTypes.Set(i++, jButtonType.build());
+      }
+    }
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set(Napi::String::New(env, "revision"), Napi::Number::New(env, revision));
+  result.Set(Napi::String::New(env, "buttons"), jButtonTypes);
+  return result;
+}
+
+Napi::Value napi_GetButtonCatalogue(const Napi::CallbackInfo& info) {
+  return util::JSyncWrapper<Napi::Value>(__func__, info, [](const char * const functionName, const Napi::CallbackInfo& info) -> Napi::Value {
+    const Napi::Env env = info.Env();
+
+    if (util::verifyArguments(functionName, info, {util::NUMBER})) {
+      const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
+      return DeviceButtonCatalogue::instance().get(env, deviceId);
+    }
+
+    return env.Undefined();
+  });
+}
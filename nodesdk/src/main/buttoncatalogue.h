@@ -0,0 +1,88 @@
+#pragma once
+
+#include "stdafx.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Per-device catalogue of GNP button types and button events (as returned by Jabra_GetSupportedButtonEvents), loaded
+ * once when a device is attached and dropped when it is detached.
+ *
+ * GNP button presses are delivered to javascript as (buttonTypeKey, key) integer pairs only, which javascript resolves
+ * against its copy of the catalogue, instead of copying and rebuilding all button strings for every press. Presses of
+ * buttons missing from the catalogue (f.x. if it could not be loaded) are added to it, bumping its revision, so
+ * javascript knows to fetch it again.
+ *
+ * Thread-safe: Filled from sdk executor threads and the libjabra button callback thread and read on the node main thread.
+ */
+class DeviceButtonCatalogue {
+  public:
+    /**
+     * A button type and its button events (key, value).
+     */
+    struct ButtonType {
+      unsigned short key;
+      std::string value;
+      std::vector<std::pair<unsigned short, std::string>> events;
+    };
+
+    static DeviceButtonCatalogue& instance();
+
+    /**
+     * Query libjabra for the supported button events of a newly attached device and cache them. Returns what was
+     * cached.
+     */
+    std::vector<ButtonType> load(unsigned short deviceId);
+
+    /**
+     * Cache the supported button events of a newly attached device known from elsewhere (see DeviceMetadataCache).
+     */
+    void set(unsigned short deviceId, const std::vector<ButtonType>& buttonTypes);
+
+    /**
+     * Drop the catalogue of a detached device.
+     */
+    void remove(unsigned short deviceId);
+
+    /**
+     * Drop all catalogues (on uninitialize).
+     */
+    void clear();
+
+    /**
+     * Get the (buttonTypeKey, key) pairs of a button event from libjabra (flattened into pairs), adding any buttons not
+     * in the catalogue of the device yet. Returns the resulting catalogue revision.
+     */
+    uint32_t toPairs(unsigned short deviceId, const ButtonEvent& buttonEvent, std::vector<int32_t>& pairs);
+
+    /**
+     * Get the catalogue of a device as { revision, buttons } with buttons as returned by GetSupportedButtonEvents.
+     * Must be called from the node main thread.
+     */
+    Napi::Object get(const Napi::Env& env, unsigned short deviceId) const;
+
+  private:
+    struct Entry {
+      uint32_t revision;
+      std::vector<ButtonType> buttonTypes;
+    };
+
+    DeviceButtonCatalogue() {}
+    DeviceButtonCatalogue(const DeviceButtonCatalogue&) = delete;
+    DeviceButtonCatalogue& operator=(const DeviceButtonCatalogue&) = delete;
+
+    /**
+     * Add the button types and events of a libjabra button event to a catalogue. Returns true if anything was added.
+     */
+    static bool merge(Entry& entry, const ButtonEvent& buttonEvent);
+
+    mutable std::mutex mutex;
+    std::unordered_map<unsigned short, Entry> entries;
+};
+
+/**
+ * GetButtonCatalogue(deviceId) - see DeviceButtonCatalogue::get.
+ */
+Napi::Value napi_GetButtonCatalogue(const Napi::CallbackInfo& info);
@@ -2,7 +2,7 @@
 
 Napi::Value napi_SetHold(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncBoolSetter(functionName, info, [functionName](unsigned short deviceId, bool enable) {
+  return util::SimpleDeviceAsyncBoolSetter(functionName, util::AsyncOptions::CallControl(), info, [functionName](unsigned short deviceId, bool enable) {
         const Jabra_ReturnCode result = Jabra_SetHold(deviceId, enable);
         if (result != Return_Ok) {
           throw util::JabraReturnCodeException(functionName, result);
@@ -12,7 +12,7 @@ Napi::Value napi_SetHold(const Napi::CallbackInfo& info) {
 
 Napi::Value napi_GetBusyLightStatus(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(functionName, info, [functionName](unsigned short deviceId) {
+  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(functionName, util::AsyncOptions::ReadOnly(), info, [functionName](unsigned short deviceId) {
     bool status = Jabra_GetBusylightStatus(deviceId);
     return status;
   }, [](const Napi::Env& env, bool cppResult) {  return Napi::Boolean::New(env, cppResult); });
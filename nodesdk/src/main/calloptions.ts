@@ -0,0 +1,50 @@
+import { SdkIntegration } from "./sdkintegration";
+import { CallOptions, NativeCallOptions } from "./core-types";
+import { isNodeJs } from './util';
+
+/** @internal */
+let sdkIntegration: SdkIntegration;
+
+// @ts-ignore
+if (isNodeJs()) { 
+    // These statements should be executed under nodejs only to avoid browserfy problems:
+    let bindings = require('bindings');
+    sdkIntegration = bindings('sdkintegration');
+}
+
+/** @internal */
+let nextCancellationId = 1;
+
+/**
+ * Call a promise based native function with the native form of (optional) call options. 
+ * 
+ * A signal is mapped to a cancellation id that is cancelled natively when the signal is
+ * aborted. The abort listener is removed again once the call has settled.
+ * 
+ * @internal 
+ * @hidden
+ */
+export function _withCallOptions<T>(options: CallOptions | undefined, call: (nativeOptions?: NativeCallOptions) => Promise<T>): Promise<T> {
+    if (!options) {
+        return call();
+    }
+
+    const signal = options.signal;
+    if (!signal || signal.aborted) {
+        return call({ timeoutMs: options.timeoutMs, aborted: signal ? signal.aborted : undefined });
+    }
+
+    const cancellationId = nextCancellationId;
+    nextCancellationId = nextCancellationId < 0x7fffffff ? nextCancellationId + 1 : 1;
+
+    const onAbort = () => sdkIntegration.CancelCall(cancellationId);
+    signal.addEventListener('abort', onAbort);
+
+    return call({ timeoutMs: options.timeoutMs, cancellationId }).then((result) => {
+        signal.removeEventListener('abort', onAbort);
+        return result;
+    }, (err) => {
+        signal.removeEventListener('abort', onAbort);
+        throw err;
+    });
+}
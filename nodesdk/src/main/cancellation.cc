@@ -0,0 +1,13 @@
+#include "cancellation.h"
+
+Napi::Value napi_CancelCall(const Napi::CallbackInfo& info) {
+  return util::JSyncWrapper<Napi::Value>(__func__, info, [](const char * const functionName, const Napi::CallbackInfo& info) -> Napi::Value {
+    const Napi::Env env = info.Env();
+
+    if (util::verifyArguments(functionName, info, {util::NUMBER})) {
+      util::SdkExecutor::instance().cancel(info[0].As<Napi::Number>().Int32Value());
+    }
+
+    return env.Undefined();
+  });
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "stdafx.h"
+
+/**
+ * Cancel (abandon) all outstanding async calls made with the given cancellation id in their call options.
+ * Their promises/callbacks get an AbortError right away.
+ */
+Napi::Value napi_CancelCall(const Napi::CallbackInfo& info);
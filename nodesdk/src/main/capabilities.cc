@@ -0,0 +1,115 @@
+#include "capabilities.h"
+
+DeviceCapabilityCache& DeviceCapabilityCache::instance() {
+  static DeviceCapabilityCache cache;
+  return cache;
+}
+
+bool DeviceCapabilityCache::query(unsigned short deviceId, DeviceCapability capability) {
+  switch (capability) {
+    case DeviceCapability::GN_HID_STD_HID: return Jabra_IsGnHidStdHidSupported(deviceId);
+    case DeviceCapability::RINGER: return Jabra_IsRingerSupported(deviceId);
+    case DeviceCapability::OFF_HOOK: return Jabra_IsOffHookSupported(deviceId);
+    case DeviceCapability::ONLINE: return Jabra_IsOnlineSupported(deviceId);
+    case DeviceCapability::MUTE: return Jabra_IsMuteSupported(deviceId);
+    case DeviceCapability::HOLD: return Jabra_IsHoldSupported(deviceId);
+    case DeviceCapability::BUSYLIGHT: return Jabra_IsBusylightSupported(deviceId);
+    case DeviceCapability::SET_DATE_TIME: return Jabra_IsSetDateTimeSupported(deviceId);
+    case DeviceCapability::EQUALIZER: return Jabra_IsEqualizerSupported(deviceId);
+    case DeviceCapability::BATTERY_STATUS: {
+      // No dedicated libjabra function, so supported if a battery status can be read.
+      int levelInPercent;
+      bool charging;
+      bool batteryLow;
+      return Jabra_GetBatteryStatus(deviceId, &levelInPercent, &charging, &batteryLow) == Return_Ok;
+    }
+    case DeviceCapability::PAIRING_LIST: return Jabra_IsPairingListSupported(deviceId);
+    case DeviceCapability::FACTORY_RESET: return Jabra_IsFactoryResetSupported(deviceId);
+    case DeviceCapability::UPLOAD_RINGTONE: return Jabra_IsUploadRingtoneSupported(deviceId);
+    case DeviceCapability::UPLOAD_IMAGE: return Jabra_IsUploadImageSupported(deviceId);
+    default: return false;
+  }
+}
+
+DeviceCapabilityCache::Capabilities DeviceCapabilityCache::load(unsigned short deviceId) {
+  Capabilities entry;
+
+  for (size_t i = 0; i < DEVICE_CAPABILITY_COUNT; ++i) {
+    const DeviceCapability capability = static_cast<DeviceCapability>(i);
+    entry.supported[i] = query(deviceId, capability);
+    // A battery status read may fail temporarily (f.x. headset out of range of its dongle), so only trust positive answers.
+    entry.known[i] = entry.supported[i] || capability != DeviceCapability::BATTERY_STATUS;
+  }
+
+  unsigned int featureCount = 0;
+  if (const DeviceFeature * const featureList = Jabra_GetSupportedFeatures(deviceId, &featureCount)) {
+    entry.features.assign(featureList, featureList + featureCount);
+    Jabra_FreeSupportedFeatures(featureList);
+  }
+
+  LOG_VERBOSE_(LOGINSTANCE) << "Cached capabilities and " << entry.features.size() << " supported features of device #" << deviceId;
+
+  set(deviceId, entry);
+  return entry;
+}
+
+void DeviceCapabilityCache::set(unsigned short deviceId, const Capabilities& capabilities) {
+  std::lock_guard<std::mutex> lock(mutex);
+  entries[deviceId] = capabilities;
+}
+
+void DeviceCapabilityCache::remove(unsigned short deviceId) {
+  std::lock_guard<std::mutex> lock(mutex);
+  entries.erase(deviceId);
+}
+
+void DeviceCapabilityCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  entries.clear();
+}
+
+bool DeviceCapabilityCache::get(unsigned short deviceId, DeviceCapability capability, bool& supported) const {
+  const size_t index = static_cast<size_t>(capability);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  const auto found = entries.find(deviceId);
+  if (found == entries.end() || !found->second.known[index]) {
+    return false;
+  }
+
+  supported = found->second.supported[index];
+  return true;
+}
+
+bool DeviceCapabilityCache::getFeatures(unsigned short deviceId, std::vector<DeviceFeature>& features) const {
+  std::lock_guard<std::mutex> lock(mutex);
+  const auto found = entries.find(deviceId);
+  if (found == entries.end()) {
+    return false;
+  }
+
+  features = found->second.features;
+  return true;
+}
+
+Napi::Value CachedCapabilityFunction(const char * const callerFunctionName, DeviceCapability capability, const Napi::CallbackInfo &info) {
+  Napi::Env env = info.Env();
+
+  util::CallOptions callOptions;
+  if (!util::verifyArgumentsWithCallOptions(callerFunctionName, info, {util::NUMBER}, callOptions)) {
+    return util::RejectedPromise(env, callerFunctionName);
+  }
+  if (callOptions.aborted) {
+    return util::AbortedPromise(env, callerFunctionName);
+  }
+
+  const unsigned short deviceId = info[0].As<Napi::Number>().Int32Value();
+  bool supported;
+  if (DeviceCapabilityCache::instance().get(deviceId, capability, supported)) {
+    return util::ResolvedPromise(env, Napi::Boolean::New(env, supported));
+  }
+
+  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(callerFunctionName, util::AsyncOptions::ReadOnly(), info, [capability](unsigned short deviceId) {
+    return DeviceCapabilityCache::query(deviceId, capability);
+  }, [](const Napi::Env& env, bool cppResult) { return Napi::Boolean::New(env, cppResult); });
+}
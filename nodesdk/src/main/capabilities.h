@@ -0,0 +1,104 @@
+#pragma once
+
+#include "stdafx.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Static device capabilities (answers to the Jabra_Is*Supported functions) that can not change while a
+ * device stays attached.
+ */
+enum class DeviceCapability {
+    GN_HID_STD_HID = 0,
+    RINGER,
+    OFF_HOOK,
+    ONLINE,
+    MUTE,
+    HOLD,
+    BUSYLIGHT,
+    SET_DATE_TIME,
+    EQUALIZER,
+    BATTERY_STATUS,
+    PAIRING_LIST,
+    FACTORY_RESET,
+    UPLOAD_RINGTONE,
+    UPLOAD_IMAGE
+};
+
+const size_t DEVICE_CAPABILITY_COUNT = 14;
+
+/**
+ * Per-device cache of capabilities and supported features, filled once when a device is attached and
+ * dropped when it is detached, so capability queries can be answered without calling libjabra.
+ *
+ * Thread-safe: Filled from sdk executor threads (when devices are attached) and read on the node main thread.
+ */
+class DeviceCapabilityCache {
+  public:
+    /**
+     * Cached capabilities and supported features of a device.
+     */
+    struct Capabilities {
+        bool known[DEVICE_CAPABILITY_COUNT];
+        bool supported[DEVICE_CAPABILITY_COUNT];
+        std::vector<DeviceFeature> features;
+    };
+
+    static DeviceCapabilityCache& instance();
+
+    /**
+     * Query libjabra for all capabilities of a newly attached device and cache them. Returns what was cached.
+     */
+    Capabilities load(unsigned short deviceId);
+
+    /**
+     * Cache capabilities of a newly attached device known from elsewhere (see DeviceMetadataCache).
+     */
+    void set(unsigned short deviceId, const Capabilities& capabilities);
+
+    /**
+     * Drop cached capabilities of a detached device.
+     */
+    void remove(unsigned short deviceId);
+
+    /**
+     * Drop all cached capabilities (on uninitialize).
+     */
+    void clear();
+
+    /**
+     * Get a cached capability. Returns false if it is not cached.
+     */
+    bool get(unsigned short deviceId, DeviceCapability capability, bool& supported) const;
+
+    /**
+     * Get cached supported features. Returns false if they are not cached.
+     */
+    bool getFeatures(unsigned short deviceId, std::vector<DeviceFeature>& features) const;
+
+    /**
+     * Ask libjabra directly (uncached) - may block, so never call on the node main thread.
+     */
+    static bool query(unsigned short deviceId, DeviceCapability capability);
+
+  private:
+    DeviceCapabilityCache() {}
+    DeviceCapabilityCache(const DeviceCapabilityCache&) = delete;
+    DeviceCapabilityCache& operator=(const DeviceCapabilityCache&) = delete;
+
+    mutable std::mutex mutex;
+    std::unordered_map<unsigned short, Capabilities> entries;
+};
+
+/**
+ * Does all the skeleton work for a Is*Supported function taking a deviceid as sole argument. Resolves the
+ * returned promise immediately from the DeviceCapabilityCache, or (if the device is not cached) asks libjabra
+ * asynchronously like SimpleDeviceAsyncFunction.
+ *
+ * @callerFunctionName Thread-invariant name of function calling this code used for documentation (should generally be called with __func__).
+ * @capability The capability to get.
+ * @info The javascript n-api function parameter informaton.
+ */
+Napi::Value CachedCapabilityFunction(const char * const callerFunctionName, DeviceCapability capability, const Napi::CallbackInfo &info);
@@ -3,7 +3,7 @@
  * and the internal sdk integration.
  */
 
-import { enumDeviceConnectionType, enumSettingCtrlType, enumSettingDataType, enumAPIReturnCode, enumBTPairedListType, enumRemoteMmiSequence } from './jabra-enums';
+import { enumDeviceConnectionType, enumSettingCtrlType, enumSettingDataType, enumAPIReturnCode, enumBTPairedListType, enumRemoteMmiSequence, enumDeviceFeature } from './jabra-enums';
 
 /**
  * The type of error returned from rejected Jabra API promises.
@@ -74,10 +74,166 @@ export interface GenericConfigParams {
     nonJabraDeviceDectection: boolean,
 }
 
+/**
+ * Optional tuning parameters for the native part of the sdk integration.
+ */
+export interface NativeConfigParams {
+    /**
+     * Number of threads in the dedicated native executor that runs all async sdk calls
+     * (isolated from the libuv threadpool used by node for fs, dns, crypto etc.). Defaults to 4.
+     */
+    sdkExecutorThreadCount?: number,
+
+    /**
+     * Async sdk calls running for longer than this are reported (logged and counted in
+     * native metrics) as stuck. Defaults to 10000 ms.
+     */
+    sdkCallWatchdogThresholdMs?: number,
+
+    /**
+     * Default timeout for async sdk calls that are not given an explicit timeout (see CallOptions).
+     * Timed out calls reject with a `TimeoutError`. Does not apply to firmware updates and file
+     * transfers. Defaults to no timeout.
+     */
+    sdkCallTimeoutMs?: number,
+
+    /**
+     * Max number of finished async worker objects kept for reuse per size class, so frequent calls
+     * do not allocate new ones. 0 disables pooling. Defaults to 32.
+     */
+    sdkWorkerPoolCapacity?: number,
+
+    /**
+     * Max number of events (button presses, battery status etc.) queued for delivery to javascript.
+     * When full, status events (battery, firmware/upload progress and dect info) replace the
+     * oldest queued event, while other events are dropped. Defaults to 1024.
+     */
+    eventQueueCapacity?: number,
+
+    /**
+     * Deliver fixed-size events (button presses, battery status, remote MMI, firmware/upload
+     * progress and detach) from native code as packed binary records instead of javascript values,
+     * avoiding per-event allocations for applications handling many button presses. Event
+     * handlers get the same arguments either way. Defaults to false.
+     */
+    binaryEvents?: boolean,
+
+    /**
+     * Number of recent events kept natively per device for each device event type (keyed by device
+     * event name, f.x. `{ btnPress: 32, onRemoteMmiEvent: 8 }`), so late subscribers can catch up with
+     * DeviceType.getEventHistoryAsync(). 0 keeps none. Defaults to 16 btnPress, 1 onBatteryStatusUpdate
+     * and 2 onDectInfoEvent events (none of other types).
+     */
+    eventHistoryCapacity?: { [deviceEvent: string]: number },
+
+    /**
+     * Only keep these fields (f.x. `["ESN", "Seq.No", "TX Acoustic Logging Level"]`) of the dev log
+     * events passed to onDevLogEvent listeners. Dev log events are decoded natively either way.
+     * Defaults to all fields.
+     */
+    devLogFields?: string[],
+
+    /**
+     * Append all raw dev log events (one json object per line) natively to this file, whether or not
+     * there are onDevLogEvent listeners. Defaults to no file.
+     */
+    devLogFile?: string,
+
+    /**
+     * Size at which the dev log file is rotated (devLogFile -> devLogFile.1 -> devLogFile.2 ...).
+     * Defaults to 10 MB.
+     */
+    devLogFileMaxSizeBytes?: number,
+
+    /**
+     * Number of rotated dev log files kept besides the current one. Defaults to 3.
+     */
+    devLogFileCount?: number,
+
+    /**
+     * Device catalogue behaviour. Setting preloadZipFile to a catalogue zip shipped with the
+     * application lets libjabra know known devices at first attach without fetching their data from
+     * the cloud - the zip is read in parallel with the rest of the sdk bootstrap. Defaults to the
+     * libjabra defaults (no preload zip, refresh at startup and connect after 30 s).
+     */
+    deviceCatalogue?: Partial<DeviceCatalogueParams>,
+
+    /**
+     * Parts of the device identity to fetch natively when a device is attached, before the attach
+     * event is emitted. The result is available as DeviceType.prefetchedIdentity, saving a round trip
+     * per part. Devices attached together are prefetched concurrently on the native executor (see
+     * sdkExecutorThreadCount). Defaults to none (attach events are emitted right away).
+     */
+    attachPrefetch?: AttachPrefetchItem[],
+
+    /**
+     * Directory (created if missing) for a persistent cache of static device metadata - capabilities,
+     * supported features, button events and settings schema - shared by all devices with the same
+     * product ID and firmware version. Lets later runs skip fetching it from the device at attach.
+     * Defaults to no cache.
+     */
+    metadataCacheDir?: string,
+
+    /**
+     * Size above which the least recently used files in metadataCacheDir are removed. Defaults to 16 MB.
+     */
+    metadataCacheMaxSizeBytes?: number,
+}
+
+/**
+ * Parts of the device identity that can be prefetched when a device is attached (see the
+ * attachPrefetch native config parameter).
+ */
+export type AttachPrefetchItem = 'ESN' | 'firmwareVersion' | 'sku' | 'hwAndConfigVersion' | 'multiESN' |
+                                 'batteryStatus' | 'deviceImageThumbnailPath';
+
+/**
+ * Minimal subset of the DOM/node AbortSignal used for cancelling calls - an AbortController signal
+ * can be passed directly.
+ */
+export interface AbortSignalLike {
+    readonly aborted: boolean;
+    addEventListener(type: 'abort', listener: () => void): void;
+    removeEventListener(type: 'abort', listener: () => void): void;
+}
+
+/**
+ * Optional per-call options for async device/sdk calls.
+ * 
+ * A call that has not been started when it times out or is cancelled is never sent to the device. A
+ * call that is already running can not be interrupted, but its promise is rejected right away and the
+ * late result is discarded.
+ */
+export interface CallOptions {
+    /**
+     * Reject with a `TimeoutError` if the call has not completed within this time. Overrides the
+     * sdkCallTimeoutMs default - 0 disables the timeout.
+     */
+    timeoutMs?: number;
+
+    /**
+     * Reject with an `AbortError` when the signal is aborted.
+     */
+    signal?: AbortSignalLike;
+}
+
+/**
+ * Call options as passed to native code.
+ * 
+ * @internal 
+ * @hidden
+ */
+export interface NativeCallOptions {
+    timeoutMs?: number;
+    cancellationId?: number;
+    aborted?: boolean;
+}
+
 export interface DeviceCatalogueParams {
     preloadZipFile: string,
     delayInSecondsBeforeStartingRefresh: number,
     refreshAtConnect: boolean,
+    refreshAtStartup: boolean,
     refreshScope: number,
     fetchDataForUnknownDevicesInTheBackground: boolean,
 }
@@ -106,6 +262,29 @@ export interface DeviceInfo {
     parentDeviceId?: number; // Not currently exposed in js so marked as optional.
 }
 
+/**
+ * Identity of an attached device, prefetched for the attached devices snapshot
+ * (see JabraType.getAttachedDevicesSnapshot) or when the device was attached (see the
+ * attachPrefetch native config parameter). Only the parts prefetched are set.
+ */
+export interface DeviceIdentity {
+    deviceID: number;
+    ESN?: string;
+    firmwareVersion?: string;
+    supportedFeatures?: enumDeviceFeature[];
+    sku?: string;
+    hwVersion?: number;
+    configVersion?: number;
+    /* ESN of each component of the device (f.x. both earbuds and the cradle), by component. */
+    multiESN?: { [component: number]: string };
+    batteryStatus?: { levelInPercent: number, charging: boolean, batteryLow: boolean };
+    deviceImageThumbnailPath?: string;
+    /* Time spent prefetching natively at attach. */
+    prefetchMs?: number;
+    /* The first error, if any part of the identity could not be fetched. */
+    error?: JabraError;
+}
+
 /** 
  * Device attach/detach timing information.
  **/
@@ -175,6 +354,37 @@ export interface DeviceSettings {
   settingInfo: Array<SettingType>;
 };
 
+/**
+ * A setting without its current value (see DeviceType.getSettingsSchemaAsync).
+ */
+export type SettingSchemaType = Omit<SettingType, 'currValue'>;
+
+/**
+ * The static part of a device's settings, the same for all devices with the same product ID and
+ * firmware version.
+ */
+export interface DeviceSettingsSchema {
+  /* Changes when the settings of the device change, f.x. after a settings manifest update. 0 if not cached natively. */
+  revision: number;
+  errStatus?: enumAPIReturnCode;
+  settingInfo: Array<SettingSchemaType>;
+};
+
+/**
+ * Current values of a device's settings, indexed by the position of each setting in settingInfo of
+ * the schema with revision schemaRevision (see DeviceType.getSettingValuesAsync).
+ */
+export interface DeviceSettingValues {
+  schemaRevision: number;
+  errStatus?: enumAPIReturnCode;
+  /* currValue of byte settings, -1 for string settings and settings without a value (or not fetched). */
+  values: Int16Array;
+  /* currValue of string settings by index. */
+  stringValues: { [index: number]: string };
+  /* isSettingProtectionEnabled of each setting (1 or 0). */
+  protectionEnabled: Uint8Array;
+};
+
 export interface PairedListInfo  { 
     listType: enumBTPairedListType;
     pairedDevice: Array<{ deviceName: string, deviceBTAddr: string, isConnected: boolean }>;
@@ -297,3 +507,225 @@ export interface ZoomLimits {
     /* The minimum amount that the value needs to change for it to have any effect. */
     stepSize: number;
 }
+
+/**
+ * Time calls of a priority class spent queued before being started.
+ */
+export interface NativeQueueWaitMetrics {
+    count: number;
+    averageMs: number;
+    maxMs: number;
+}
+
+/**
+ * Latency histogram - count, average and max as for NativeQueueWaitMetrics plus counts per power of two
+ * microsecond bucket: buckets[0] counts latencies below 1 us, buckets[i] latencies from 2^(i-1) up to 2^i us
+ * and the last bucket everything longer.
+ */
+export interface NativeLatencyHistogram extends NativeQueueWaitMetrics {
+    buckets: number[];
+}
+
+/**
+ * Latencies of an event type, measured with monotonic timestamps.
+ */
+export interface NativeEventLatencyMetrics {
+    /* From entering the Jabra SDK callback to the event being queued (event conversion etc.). */
+    sdk: NativeLatencyHistogram;
+    /* From the event being queued to the batch being passed to javascript (a busy event loop shows here). */
+    queue: NativeLatencyHistogram;
+    /* From entering the Jabra SDK callback to the batch being passed to javascript. */
+    total: NativeLatencyHistogram;
+}
+
+/**
+ * State and counters of the native executor running async sdk calls.
+ */
+export interface NativeExecutorMetrics {
+    threadCount: number;
+    /* Extra threads reserved for call-control commands (ringer, hook, mute, hold). */
+    callControlThreadCount: number;
+    watchdogThresholdMs: number;
+    /* Calls waiting for a free executor thread. */
+    queued: number;
+    /* Calls currently running. */
+    running: number;
+    submitted: number;
+    completed: number;
+    /* Total number of calls reported by the watchdog as running longer than watchdogThresholdMs. */
+    stuckCallsReported: number;
+    /* Read-only calls that shared the result of an identical call in flight instead of calling the sdk. */
+    coalesced: number;
+    /* Devices with calls queued or running on their serial strand. */
+    activeStrands: number;
+    /* Calls rejected because their timeout expired. */
+    timedOut: number;
+    /* Calls rejected because they were cancelled. */
+    cancelled: number;
+    /* Timed out or cancelled calls that were never sent to the device as they had not been started. */
+    skipped: number;
+    /* Queue wait per priority class. */
+    queueWait: { callControl: NativeQueueWaitMetrics, normal: NativeQueueWaitMetrics, bulk: NativeQueueWaitMetrics };
+    /* Calls currently running longer than watchdogThresholdMs. */
+    stuckCalls: Array<{ name: string, runningMs: number }>;
+}
+
+/**
+ * State and counters of the native pool of reusable async worker objects.
+ */
+export interface NativeWorkerPoolMetrics {
+    /* Max free workers kept per size class (0 = pooling disabled). */
+    capacity: number;
+    /* Free workers currently kept for reuse. */
+    pooled: number;
+    /* Calls that reused a pooled worker. */
+    hits: number;
+    /* Calls that had to allocate a new worker. */
+    misses: number;
+    /* Finished workers freed because the pool was full. */
+    discarded: number;
+}
+
+/**
+ * Counters of the native channel delivering events (attach, button presses etc.) to javascript.
+ */
+export interface NativeEventMetrics {
+    /* Events received from the sdk. */
+    posted: number;
+    /* Events delivered to javascript. */
+    delivered: number;
+    /* Javascript calls made to deliver the events (each delivering a batch of events). */
+    batches: number;
+    /* Largest number of events delivered in a single batch. */
+    maxBatchSize: number;
+    /* Status events (battery, progress etc.) replaced by a newer event of the same kind before being delivered. */
+    coalesced: number;
+    /* Events delivered as binary records (see binaryEvents). */
+    binaryRecords: number;
+    /* Device events dropped natively because the device had no javascript listeners for them. */
+    filtered: number;
+    /* Events dropped per event type because the event queue was full (see eventQueueCapacity). */
+    dropped: { [eventType: string]: number };
+    /* Latencies per event type (only event types seen so far). */
+    latency: { [eventType: string]: NativeEventLatencyMetrics };
+}
+
+/**
+ * Counters of the native dev log event handling.
+ */
+export interface NativeDevLogMetrics {
+    /* Dev log events decoded for javascript listeners. */
+    decoded: number;
+    /* Dev log events dropped because they were not json objects. */
+    decodeErrors: number;
+    /* Dev log events written to the dev log file (see devLogFile). */
+    fileWrites: number;
+    fileBytes: number;
+    fileRotations: number;
+    /* Failures to open or write the dev log file. */
+    fileErrors: number;
+}
+
+/**
+ * Milliseconds from the start of sdk initialization until each startup milestone (only milestones
+ * reached so far). catalogueReadyMs is only set when a device catalogue preload zip is configured.
+ */
+export interface NativeStartupMetrics {
+    appIdSetMs?: number;
+    catalogueReadyMs?: number;
+    initializedMs?: number;
+    firstScanDoneMs?: number;
+    firstAttachMs?: number;
+}
+
+/**
+ * Loading of the Jabra SDK library, which only happens at initialization (or the first sdk call).
+ */
+export interface NativeLibraryMetrics {
+    loaded: boolean;
+    /* The library loaded (or attempted). Empty if not loaded yet. */
+    file: string;
+    loadMs: number;
+    /* Sdk functions looked up in the library so far (each is looked up on first use only). */
+    resolvedFunctions: number;
+    resolveMs: number;
+    /* Why the library could not be loaded. */
+    error?: string;
+}
+
+/**
+ * Counters of the native identity prefetching at attach (see the attachPrefetch native config parameter).
+ */
+export interface NativeAttachPrefetchMetrics {
+    enabled: boolean;
+    prefetched: number;
+    /* Prefetches where some part of the identity could not be fetched. */
+    failed: number;
+    /* Devices detached before they were prefetched. */
+    cancelled: number;
+    latency: NativeLatencyHistogram;
+}
+
+/**
+ * Counters of the persistent device metadata cache (see the metadataCacheDir native config parameter).
+ */
+export interface NativeMetadataCacheMetrics {
+    enabled: boolean;
+    directory: string;
+    maxSizeBytes: number;
+    /* Total size and number of cache files as of the last write. */
+    sizeBytes: number;
+    fileCount: number;
+    /* Attached devices whose metadata was read from disk. */
+    hits: number;
+    /* Attached devices whose metadata was fetched from the device (and then written to disk). */
+    misses: number;
+    /* Cache files dropped as corrupt or written by another format version. */
+    corrupt: number;
+    writes: number;
+    writeErrors: number;
+    /* Cache files removed to stay within maxSizeBytes. */
+    evicted: number;
+    hitLatency: NativeLatencyHistogram;
+    missLatency: NativeLatencyHistogram;
+}
+
+/**
+ * Native diagnostics - for troubleshooting and performance tuning only.
+ */
+export interface NativeMetrics {
+    executor: NativeExecutorMetrics;
+    workerPool: NativeWorkerPoolMetrics;
+    events: NativeEventMetrics;
+    devLog: NativeDevLogMetrics;
+    startup: NativeStartupMetrics;
+    library: NativeLibraryMetrics;
+    attachPrefetch: NativeAttachPrefetchMetrics;
+    metadataCache: NativeMetadataCacheMetrics;
+}
+
+/**
+ * Operations supported in batches (see JabraType.executeBatchAsync). They are named
+ * after, and return the same results as, the corresponding async device methods.
+ */
+export type BatchOperationName = 'GetBatteryStatus' | 'GetESN' | 'GetFirmwareVersion' | 'GetBusyLightStatus' | 
+    'SetBusyLightStatus' | 'IsFeatureSupported' | 'IsEqualizerSupported' | 'IsEqualizerEnabled' | 'EnableEqualizer' |
+    'IsRingerSupported' | 'IsOffHookSupported' | 'IsMuteSupported' | 'IsHoldSupported' | 'IsOnlineSupported' | 'IsBusyLightSupported';
+
+/**
+ * One operation of a batch. Args are only required for setters ('SetBusyLightStatus', 'EnableEqualizer'
+ * take a boolean) and 'IsFeatureSupported' (takes an enumDeviceFeature).
+ */
+export interface BatchOperationDescriptor {
+    deviceId: number;
+    operation: BatchOperationName;
+    args?: Array<boolean | number | string>;
+}
+
+/**
+ * Outcome of one operation of a batch - either a result or an error.
+ */
+export interface BatchOperationResult {
+    result?: any;
+    error?: JabraError;
+}
@@ -1,6 +1,9 @@
 #include "device.h"
+#include "capabilities.h"
 #include "napiutil.h"
+#include "propertykeys.h"
 #include <string.h>
+#include <algorithm>
 
 // ----------------------------------------- Helper functions ------------------------------------------------
 
@@ -15,7 +18,7 @@ static Napi::Object makePoint2D(const Napi::Env& env, const uint16_t x, const ui
 
 Napi::Value napi_GetDeviceImagePath(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::String, std::string>(functionName, info, [functionName](unsigned short deviceId) {
+  return util::SimpleDeviceAsyncFunction<Napi::String, std::string>(functionName, util::AsyncOptions::ReadOnly(), info, [functionName](unsigned short deviceId) {
     if (char * result = Jabra_GetDeviceImagePath(deviceId)) {
       std::string managedResult(result);
       Jabra_FreeString(result);
@@ -31,7 +34,7 @@ Napi::Value napi_GetDeviceImagePath(const Napi::CallbackInfo& info) {
 
 Napi::Value napi_GetDeviceImageThumbnailPath(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::String, std::string>(functionName, info, [functionName](unsigned short deviceId) {
+  return util::SimpleDeviceAsyncFunction<Napi::String, std::string>(functionName, util::AsyncOptions::ReadOnly(), info, [functionName](unsigned short deviceId) {
     if (char * result = Jabra_GetDeviceImageThumbnailPath(deviceId)) {
       std::string managedResult(result);
       Jabra_FreeString(result);
@@ -44,16 +47,12 @@ Napi::Value napi_GetDeviceImageThumbnailPath(const Napi::CallbackInfo& info) {
 }
 
 Napi::Value napi_IsGnHidStdHidSupported(const Napi::CallbackInfo& info) {
-  const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(functionName, info, [](unsigned short deviceId) {
-    bool retv = Jabra_IsGnHidStdHidSupported(deviceId);
-    return retv;
-  }, [](const Napi::Env& env, bool cppResult) {  return Napi::Boolean::New(env, cppResult); });
+  return CachedCapabilityFunction(__func__, DeviceCapability::GN_HID_STD_HID, info);
 }
 
 Napi::Value napi_GetHidWorkingState(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Number, Jabra_HidState>(functionName, info, [functionName](unsigned short deviceId) {
+  return util::SimpleDeviceAsyncFunction<Napi::Number, Jabra_HidState>(functionName, util::AsyncOptions::ReadOnly(), info, [functionName](unsigned short deviceId) {
     Jabra_ReturnCode retv;
     Jabra_HidState state;
     if ((retv = Jabra_GetHidWorkingState(deviceId, &state)) == Return_Ok) {
@@ -69,37 +68,43 @@ Napi::Value napi_SetHidWorkingState(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const Jabra_HidState state = (Jabra_HidState)(info[1].As<Napi::Number>().Int32Value());
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, state](){ 
         Jabra_ReturnCode retv;                       
         if ((retv = Jabra_SetHidWorkingState(deviceId, state)) != Return_Ok) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_IsRingerSupported(const Napi::CallbackInfo& info) {
-  const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(functionName, info, [](unsigned short deviceId) {
-    bool retv = Jabra_IsRingerSupported(deviceId);
-    return retv;
-  }, [](const Napi::Env& env, bool cppResult) {  return Napi::Boolean::New(env, cppResult); });
+  return CachedCapabilityFunction(__func__, DeviceCapability::RINGER, info);
 }
 
 Napi::Value napi_SetRinger(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncBoolSetter(functionName, info, [functionName](unsigned short deviceId, bool enable) {
+  return util::SimpleDeviceAsyncBoolSetter(functionName, util::AsyncOptions::CallControl(), info, [functionName](unsigned short deviceId, bool enable) {
         const Jabra_ReturnCode result = Jabra_SetRinger(deviceId, enable);
         if (result != Return_Ok) {
           throw util::JabraReturnCodeException(functionName, result);
@@ -108,17 +113,13 @@ Napi::Value napi_SetRinger(const Napi::CallbackInfo& info) {
 }
 
 Napi::Value napi_IsOffHookSupported(const Napi::CallbackInfo& info) {
-  const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(functionName, info, [](unsigned short deviceId) {
-    bool retv = Jabra_IsOffHookSupported(deviceId);
-    return retv;
-  }, [](const Napi::Env& env, bool cppResult) {  return Napi::Boolean::New(env, cppResult); });
+  return CachedCapabilityFunction(__func__, DeviceCapability::OFF_HOOK, info);
 }
 
 
 Napi::Value napi_SetOffHook(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncBoolSetter(functionName, info, [functionName](unsigned short deviceId, bool enable) {
+  return util::SimpleDeviceAsyncBoolSetter(functionName, util::AsyncOptions::CallControl(), info, [functionName](unsigned short deviceId, bool enable) {
         const Jabra_ReturnCode result = Jabra_SetOffHook(deviceId, enable);
         if (result != Return_Ok) {
           throw util::JabraReturnCodeException(functionName, result);
@@ -127,121 +128,139 @@ Napi::Value napi_SetOffHook(const Napi::CallbackInfo& info) {
 }
 
 Napi::Value napi_IsOnlineSupported(const Napi::CallbackInfo& info) {
-  const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, info, [](unsigned short deviceId) {
-    bool retv = Jabra_IsOnlineSupported(deviceId);
-    return retv;
-  }, [](const Napi::Env& env, bool cppResult) {  return Napi::Boolean::New(env, cppResult); });
+  return CachedCapabilityFunction(__func__, DeviceCapability::ONLINE, info);
 }
 
 Napi::Value napi_IsMuteSupported(const Napi::CallbackInfo& info) {
-  const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, info, [](unsigned short deviceId) {
-    bool retv = Jabra_IsMuteSupported(deviceId);
-    return retv;
-  }, [](const Napi::Env& env, bool cppResult) {  return Napi::Boolean::New(env, cppResult); });
+  return CachedCapabilityFunction(__func__, DeviceCapability::MUTE, info);
 }
 
 Napi::Value napi_IsHoldSupported(const Napi::CallbackInfo& info) {
-  const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, info, [](unsigned short deviceId) {
-    bool retv = Jabra_IsHoldSupported(deviceId);
-    return retv;
-  }, [](const Napi::Env& env, bool cppResult) {  return Napi::Boolean::New(env, cppResult); });
+  return CachedCapabilityFunction(__func__, DeviceCapability::HOLD, info);
 }
 
 Napi::Value napi_IsBusyLightSupported(const Napi::CallbackInfo& info) {
-  const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, info, [](unsigned short deviceId) {
-    bool retv = Jabra_IsBusylightSupported(deviceId);
-    return retv;
-  }, [](const Napi::Env& env, bool cppResult) {  return Napi::Boolean::New(env, cppResult); });
+  return CachedCapabilityFunction(__func__, DeviceCapability::BUSYLIGHT, info);
 }
 
 Napi::Value napi_UploadRingtone(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const std::string fileName = info[1].As<Napi::String>();
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, fileName](){ 
         Jabra_ReturnCode retv;                       
         if ((retv = Jabra_UploadRingtone(deviceId, fileName.c_str())) != Return_Ok) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetPriority(util::SdkPriority::BULK);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_UploadWavRingtone(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const std::string fileName = info[1].As<Napi::String>();
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, fileName](){ 
         Jabra_ReturnCode retv;                       
         if ((retv = Jabra_UploadWavRingtone(deviceId, fileName.c_str())) != Return_Ok) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetPriority(util::SdkPriority::BULK);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_UploadImage(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const std::string fileName = info[1].As<Napi::String>();
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, fileName](){ 
         Jabra_ReturnCode retv;                       
         if ((retv = Jabra_UploadImage(deviceId, fileName.c_str())) != Return_Ok) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetPriority(util::SdkPriority::BULK);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_GetNamedAsset(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const std::string assetName = info[1].As<Napi::String>();
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<CNamedAsset*, Napi::Object>(
+    auto * const worker = new util::JAsyncWorker<CNamedAsset*, Napi::Object>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, assetName](){ 
         Jabra_ReturnCode retv;
         CNamedAsset* asset = nullptr;
@@ -251,84 +270,94 @@ Napi::Value napi_GetNamedAsset(const Napi::CallbackInfo& info) {
         return asset;
       },
       [](const Napi::Env& env, CNamedAsset* asset) {
-        Napi::Object jResult = Napi::Object::New(env);
+        const PropertyKeys keys(env);
+        ObjectBuilder jResult(keys), jElement(keys), jSingleMetaData(keys);
 
         Napi::Array jElements = Napi::Array::New(env);
 
         if (asset != nullptr) {
           for (unsigned int i=0; i<asset->element_count; ++i) {
             CAssetElement src = asset->elements[i];
-            Napi::Object jElement = Napi::Object::New(env);
-            jElement.Set(Napi::String::New(env, "url"), Napi::String::New(env, src.url ? src.url : ""));
-            jElement.Set(Napi::String::New(env, "mime"), Napi::String::New(env, src.mime ? src.mime : ""));
-            jElements.Set(i, jElement);
+            jElement.set(PropertyKey::url, Napi::String::New(env, src.url ? src.url : ""));
+            jElement.set(PropertyKey::mime, Napi::String::New(env, src.mime ? src.mime : ""));
+            jElements.Set(i, jElement.build());
           }
         }
 
-        jResult.Set(Napi::String::New(env, "elements"), jElements);
+        jResult.set(PropertyKey::elements, jElements);
 
         Napi::Array jMetadata = Napi::Array::New(env);
         if (asset != nullptr) {
           for (unsigned int i=0; i<asset->metadata_count; ++i) {
             CAssetMetadata src = asset->metadata[i];
-            Napi::Object jSingleMetaData = Napi::Object::New(env);
-            jSingleMetaData.Set(Napi::String::New(env, "name"), Napi::String::New(env, src.name ? src.name : ""));
-            jSingleMetaData.Set(Napi::String::New(env, "value"), Napi::String::New(env, src.value ? src.value : ""));
-            jMetadata.Set(i, jSingleMetaData);
+            jSingleMetaData.set(PropertyKey::name, Napi::String::New(env, src.name ? src.name : ""));
+            jSingleMetaData.set(PropertyKey::value, Napi::String::New(env, src.value ? src.value : ""));
+            jMetadata.Set(i, jSingleMetaData.build());
           }
         }
 
-        jResult.Set(Napi::String::New(env, "metadata"), jMetadata);
+        jResult.set(PropertyKey::metadata, jMetadata);
 
-        return jResult;
+        return jResult.build();
       },
       [](CNamedAsset* asset) {
         if (asset != nullptr) {
           Jabra_FreeAsset(asset);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_GetSupportedButtonEvents(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
-    Napi::Function javascriptResultCallback = info[1].As<Napi::Function>();
 
-    (new util::JAsyncWorker<ButtonEvent*, Napi::Object>(
+    auto * const worker = new util::JAsyncWorker<ButtonEvent*, Napi::Object>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId](){ 
         ButtonEvent* buttonEvent = nullptr;
         buttonEvent = Jabra_GetSupportedButtonEvents(deviceId);
         return buttonEvent;
       },
       [](const Napi::Env& env, ButtonEvent* buttonEvent) {
+        const PropertyKeys keys(env);
+        ObjectBuilder jElement(keys), newElement(keys);
 
         Napi::Array jElements = Napi::Array::New(env);
 
         if (buttonEvent != nullptr) { 
           for ( int i=0; i<buttonEvent->buttonEventCount; ++i) {
             ButtonEventInfo btnEventInfo = buttonEvent->buttonEventInfo[i];
-            Napi::Object jElement = Napi::Object::New(env);
-            jElement.Set(Napi::String::New(env, "buttonTypeKey"), Napi::Number::New(env, btnEventInfo.buttonTypeKey));
-            jElement.Set(Napi::String::New(env, "buttonTypeValue"), Napi::String::New(env, btnEventInfo.buttonTypeValue ? btnEventInfo.buttonTypeValue : ""));
+            jElement.set(PropertyKey::buttonTypeKey, Napi::Number::New(env, btnEventInfo.buttonTypeKey));
+            jElement.set(PropertyKey::buttonTypeValue, Napi::String::New(env, btnEventInfo.buttonTypeValue ? btnEventInfo.buttonTypeValue : ""));
             Napi::Array newElements = Napi::Array::New(env);
             for (unsigned int j=0; j<(unsigned int)btnEventInfo.buttonEventTypeSize; ++j) {
               ButtonEventType btnEventTypeInfo = btnEventInfo.buttonEventType[j];
-              Napi::Object newElement = Napi::Object::New(env);
-              newElement.Set(Napi::String::New(env, "key"), Napi::Number::New(env, btnEventTypeInfo.key));
-              newElement.Set(Napi::String::New(env, "value"), Napi::String::New(env, btnEventTypeInfo.value ? btnEventTypeInfo.value : ""));
+              newElement.set(PropertyKey::key, Napi::Number::New(env, btnEventTypeInfo.key));
+              newElement.set(PropertyKey::value, Napi::String::New(env, btnEventTypeInfo.value ? btnEventTypeInfo.value : ""));
               
-              newElements.Set(j, newElement);
+              newElements.Set(j, newElement.build());
             }
-            jElements.Set(i, jElement);
+            jElement.set(PropertyKey::buttonEventType, newElements);
+            jElements.Set(i, jElement.build());
           }
         }
         return jElements;
@@ -339,16 +368,22 @@ Napi::Value napi_GetSupportedButtonEvents(const Napi::CallbackInfo& info) {
           Jabra_FreeButtonEvents(buttonEvent);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
   
 }
 
 Napi::Value napi_SetMute(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncBoolSetter(functionName, info, [functionName](unsigned short deviceId, bool enable) {
+  return util::SimpleDeviceAsyncBoolSetter(functionName, util::AsyncOptions::CallControl(), info, [functionName](unsigned short deviceId, bool enable) {
         const Jabra_ReturnCode result = Jabra_SetMute(deviceId, enable);
         if (result != Return_Ok) {
           throw util::JabraReturnCodeException(functionName, result);
@@ -357,49 +392,57 @@ Napi::Value napi_SetMute(const Napi::CallbackInfo& info) {
 }
 
 Napi::Value napi_IsSetDateTimeSupported(const Napi::CallbackInfo& info) {
-  const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, info, [](unsigned short deviceId) {
-    bool retv = Jabra_IsSetDateTimeSupported(deviceId);
-    return retv;
-  }, [](const Napi::Env& env, bool cppResult) {  return Napi::Boolean::New(env, cppResult); });
+  return CachedCapabilityFunction(__func__, DeviceCapability::SET_DATE_TIME, info);
 }
 
 Napi::Value napi_IsFeatureSupported(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const DeviceFeature feature = (DeviceFeature)(info[1].As<Napi::Number>().Int32Value());
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<bool, Napi::Boolean>(
+    std::vector<DeviceFeature> features;
+    if (DeviceCapabilityCache::instance().getFeatures(deviceId, features)) {
+      const bool supported = std::find(features.begin(), features.end(), feature) != features.end();
+      return util::ResolvedPromise(env, Napi::Boolean::New(env, supported));
+    }
+
+    auto * const worker = new util::JAsyncWorker<bool, Napi::Boolean>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, feature](){ 
         return Jabra_IsFeatureSupported(deviceId, feature);
       },
       [](const Napi::Env& env, const bool result) {
         return Napi::Boolean::New(env, result);
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 
 Napi::Value napi_IsEqualizerSupported(const Napi::CallbackInfo& info) {
-  const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, info, [](unsigned short deviceId) {
-    bool retv = Jabra_IsEqualizerSupported(deviceId);
-    return retv;
-  }, [](const Napi::Env& env, bool cppResult) {  return Napi::Boolean::New(env, cppResult); });
+  return CachedCapabilityFunction(__func__, DeviceCapability::EQUALIZER, info);
 }
 
 Napi::Value napi_IsEqualizerEnabled(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, info, [](unsigned short deviceId) {
+  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, util::AsyncOptions::ReadOnly(), info, [](unsigned short deviceId) {
     bool retv = Jabra_IsEqualizerEnabled(deviceId);
     return retv;
   }, [](const Napi::Env& env, bool cppResult) {  return Napi::Boolean::New(env, cppResult); });
@@ -419,7 +462,12 @@ Napi::Value napi_SetEqualizerParameters(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::ARRAY, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::ARRAY}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());   
     Napi::Array bands =info[1].As<Napi::Array>();
 
@@ -429,11 +477,9 @@ Napi::Value napi_SetEqualizerParameters(const Napi::CallbackInfo& info) {
       managedBands[i] = bands.Get(i).ToNumber().FloatValue();
     }
 
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
-
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, managedBands](){ 
         Jabra_ReturnCode retv;       
         float * bands = const_cast<float*>(managedBands.data()); // Should be safe as SDK ought not to change data.
@@ -442,64 +488,90 @@ Napi::Value napi_SetEqualizerParameters(const Napi::CallbackInfo& info) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_SetTimestamp(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const uint32_t newTime = (unsigned int)(info[1].As<Napi::Number>().Int32Value());//Int64Value() should be used once Jabra sdk supports it.
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName,deviceId,newTime](){ 
         Jabra_ReturnCode retv;   
         if ((retv = Jabra_SetTimestamp(deviceId, newTime)) != Return_Ok) {                    
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_PlayRingTone(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::NUMBER, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::NUMBER, util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const uint8_t level = (unsigned short)(info[1].As<Napi::Number>().Int32Value());
     const uint8_t type = (unsigned short)(info[2].As<Napi::Number>().Int32Value());
-    Napi::Function javascriptResultCallback = info[3].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName,deviceId,level,type](){ 
         Jabra_ReturnCode retv;   
         if ((retv = Jabra_PlayRingtone(deviceId,level,type)) != Return_Ok) {                    
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_GetESN(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::String, std::string>(functionName, info, 
+  return util::SimpleDeviceAsyncFunction<Napi::String, std::string>(functionName, util::AsyncOptions::ReadOnly(), info, 
     [functionName](unsigned short deviceId) {
       char esn[64];
       Jabra_ReturnCode retv;
@@ -518,13 +590,17 @@ Napi::Value napi_GetESN(const Napi::CallbackInfo& info) {
 Napi::Value napi_GetTimestamp(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
-    Napi::Function javascriptResultCallback = info[1].As<Napi::Function>();
 
-    (new util::JAsyncWorker<uint32_t, Napi::Number>(
+    auto * const worker = new util::JAsyncWorker<uint32_t, Napi::Number>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId](){ 
         Jabra_ReturnCode retv;  
         uint32_t result;
@@ -536,15 +612,21 @@ Napi::Value napi_GetTimestamp(const Napi::CallbackInfo& info) {
       [](const Napi::Env& env, const uint32_t cppResult) {  
         return Napi::Number::New(env, cppResult); 
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_GetAudioFileParametersForUpload(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Object, Jabra_AudioFileParams >(functionName, info, 
+  return util::SimpleDeviceAsyncFunction<Napi::Object, Jabra_AudioFileParams >(functionName, util::AsyncOptions::ReadOnly(), info, 
     [functionName](unsigned short deviceId) {
       return Jabra_GetAudioFileParametersForUpload(deviceId);
     },
@@ -562,7 +644,7 @@ Napi::Value napi_GetAudioFileParametersForUpload(const Napi::CallbackInfo& info)
 
 Napi::Value napi_GetSecureConnectionMode(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Number, Jabra_SecureConnectionMode>(functionName, info, [functionName](unsigned short deviceId) {
+  return util::SimpleDeviceAsyncFunction<Napi::Number, Jabra_SecureConnectionMode>(functionName, util::AsyncOptions::ReadOnly(), info, [functionName](unsigned short deviceId) {
     Jabra_ReturnCode retv;
     Jabra_SecureConnectionMode secureConnectionModes;
     if ((retv = Jabra_GetSecureConnectionMode(deviceId, &secureConnectionModes)) == Return_Ok) {
@@ -587,7 +669,7 @@ Napi::Value napi_RebootDevice(const Napi::CallbackInfo& info) {
 
 Napi::Value napi_GetWizardMode(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Number, WizardModes>(functionName, info, [functionName](unsigned short deviceId) {
+  return util::SimpleDeviceAsyncFunction<Napi::Number, WizardModes>(functionName, util::AsyncOptions::ReadOnly(), info, [functionName](unsigned short deviceId) {
     Jabra_ReturnCode retv;
     WizardModes wizardModes;
     if ((retv = Jabra_GetWizardMode(deviceId, &wizardModes)) == Return_Ok) {
@@ -603,24 +685,34 @@ Napi::Value napi_SetWizardMode(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const WizardModes modes = (WizardModes)(info[1].As<Napi::Number>().Int32Value());
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId,modes](){ 
         Jabra_ReturnCode retv;                       
         if ((retv = Jabra_SetWizardMode(deviceId,modes)) != Return_Ok) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 /**
@@ -696,16 +788,20 @@ static void Custom_FreeButtonEvent(ButtonEvent* buttonEvent) {
 Napi::Value doGetReleaseButtonFocus(const Napi::CallbackInfo& info, const char * const functionName, const GetReleaseButtonFocusEnum getOrRelease) {
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::ARRAY, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::ARRAY}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     Napi::Array btnEvents = info[1].As<Napi::Array>();
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
     ButtonEvent *rawButtonEvent = toButtonEventCType(btnEvents);
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName,
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, rawButtonEvent, getOrRelease](){
         Jabra_ReturnCode retv;
         if (getOrRelease == GetReleaseButtonFocusEnum::GET_FOCUS) { 
@@ -724,10 +820,16 @@ Napi::Value doGetReleaseButtonFocus(const Napi::CallbackInfo& info, const char *
           Custom_FreeButtonEvent(rawButtonEvent);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_GetButtonFocus(const Napi::CallbackInfo& info) {
@@ -743,7 +845,12 @@ Napi::Value napi_SetDatetime(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::OBJECT, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::OBJECT}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
 
     Napi::Object dateTimeJsObj = info[1].As<Napi::Object>();
@@ -757,75 +864,101 @@ Napi::Value napi_SetDatetime(const Napi::CallbackInfo& info) {
     dateTime.year = util::getObjInt32OrDefault(dateTimeJsObj, "year", 0);
     dateTime.wday = util::getObjInt32OrDefault(dateTimeJsObj, "wday", 0);    
 
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
-
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName,
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, dateTime](){ 
         Jabra_ReturnCode retv;                       
         if ((retv = Jabra_SetDateTime(deviceId, &dateTime)) != Return_Ok) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
+}
+
+static Napi::Array toNapiFeatureArray(const Napi::Env& env, const DeviceFeature * const featureList, unsigned int featureCount) {
+  Napi::Array jElements = Napi::Array::New(env);
+
+  if (featureList != nullptr) { 
+    for (unsigned int i=0; i<featureCount; ++i) {
+      Napi::Number feature = Napi::Number::New(env, (uint32_t)featureList[i]);
+      jElements.Set(i, feature);
+    }
+  }
+
+  return jElements;
 }
 
 Napi::Value napi_GetSupportedFeatures(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
-    Napi::Function javascriptResultCallback = info[1].As<Napi::Function>();
 
-    (new util::JAsyncWorker<FeatureListCountPair, Napi::Array>(
+    std::vector<DeviceFeature> features;
+    if (DeviceCapabilityCache::instance().getFeatures(deviceId, features)) {
+      return util::ResolvedPromise(env, toNapiFeatureArray(env, features.data(), (unsigned int)features.size()));
+    }
+
+    auto * const worker = new util::JAsyncWorker<FeatureListCountPair, Napi::Array>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId](){
         FeatureListCountPair flcPair;
         flcPair.featureList = Jabra_GetSupportedFeatures(deviceId, &flcPair.featureCount);
         return flcPair;
       },
       [](const Napi::Env& env, const FeatureListCountPair& flcPair) {
-
-        Napi::Array jElements = Napi::Array::New(env);
-
-        if (flcPair.featureList != nullptr) { 
-          for (unsigned int i=0; i<flcPair.featureCount; ++i) {
-            Napi::Number feature = Napi::Number::New(env, (uint32_t)flcPair.featureList[i]);
-            jElements.Set(i, feature);
-          }
-        }
-
-        return jElements;        
+        return toNapiFeatureArray(env, flcPair.featureList, flcPair.featureCount);
       },
       [](const FeatureListCountPair& flcPair) {
         if (flcPair.featureList != nullptr) {
           Jabra_FreeSupportedFeatures(flcPair.featureList);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_GetEqualizerParameters(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
 	  const unsigned int maxNbands = (unsigned short)(info[1].As<Napi::Number>().Int32Value());
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<EqualizerBandsListCountPair, Napi::Array>(
+    auto * const worker = new util::JAsyncWorker<EqualizerBandsListCountPair, Napi::Array>(
       functionName,
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, maxNbands](){
         Jabra_ReturnCode retv;
         
@@ -855,27 +988,37 @@ Napi::Value napi_GetEqualizerParameters(const Napi::CallbackInfo& info) {
       }, [](const EqualizerBandsListCountPair& pair) {
         delete[] pair.bands;
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_GetRemoteMmiFocus(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
-  bool argsOk = util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::NUMBER, util::NUMBER, util::FUNCTION});
+  util::CallOptions callOptions;
+  bool argsOk = util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::NUMBER, util::NUMBER, util::NUMBER}, callOptions);
 
   if (argsOk) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const RemoteMmiType type = (RemoteMmiType)(info[1].As<Napi::Number>().Int32Value());
     const RemoteMmiInput input = (RemoteMmiInput)(info[2].As<Napi::Number>().Int32Value());
     const RemoteMmiPriority prio = (RemoteMmiPriority)(info[3].As<Napi::Number>().Int32Value());
-    Napi::Function javascriptResultCallback = info[4].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, type, input, prio](){ 
         Jabra_ReturnCode retv = Jabra_GetRemoteMmiFocus(deviceId, type, input, prio);     
 
@@ -883,25 +1026,35 @@ Napi::Value napi_GetRemoteMmiFocus(const Napi::CallbackInfo& info) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         } 
       }
-    ))->Queue();     
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   } 
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_ReleaseRemoteMmiFocus(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
-  bool argsOk = util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::FUNCTION});
+  util::CallOptions callOptions;
+  bool argsOk = util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::NUMBER}, callOptions);
 
   if (argsOk) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const RemoteMmiType type = (RemoteMmiType)(info[1].As<Napi::Number>().Int32Value());  
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();  
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, type](){ 
         Jabra_ReturnCode retv = Jabra_ReleaseRemoteMmiFocus(deviceId, type);     
 
@@ -909,25 +1062,35 @@ Napi::Value napi_ReleaseRemoteMmiFocus(const Napi::CallbackInfo& info) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         } 
       }
-    ))->Queue();         
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_IsRemoteMmiInFocus(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
-  bool argsOk = util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::FUNCTION});
+  util::CallOptions callOptions;
+  bool argsOk = util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::NUMBER}, callOptions);
 
   if (argsOk) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const RemoteMmiType type = (RemoteMmiType)(info[1].As<Napi::Number>().Int32Value());  
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();  
 
-    (new util::JAsyncWorker<bool, Napi::Boolean>(
+    auto * const worker = new util::JAsyncWorker<bool, Napi::Boolean>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, type](){ 
         bool isInFocus;
 
@@ -941,22 +1104,32 @@ Napi::Value napi_IsRemoteMmiInFocus(const Napi::CallbackInfo& info) {
       }, [](const Napi::Env& env, bool isInFocus){
         return Napi::Boolean::New(env, isInFocus);
       }     
-    ))->Queue();         
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_SetRemoteMmiAction(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
-  bool argsOk = util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::OBJECT, util::FUNCTION});
+  util::CallOptions callOptions;
+  bool argsOk = util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::NUMBER, util::OBJECT}, callOptions);
 
   if (argsOk) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const RemoteMmiType type = (RemoteMmiType)(info[1].As<Napi::Number>().Int32Value());  
     Napi::Object actionOutputArgs = info[2].As<Napi::Object>();
-    Napi::Function javascriptResultCallback = info[3].As<Napi::Function>();  
 
     RemoteMmiActionOutput actionOutput;
     actionOutput.red = util::getObjInt32OrDefault(actionOutputArgs, "red", 0);
@@ -964,9 +1137,9 @@ Napi::Value napi_SetRemoteMmiAction(const Napi::CallbackInfo& info) {
     actionOutput.blue = util::getObjInt32OrDefault(actionOutputArgs, "blue", 0);
     actionOutput.sequence = util::getObjEnumValueOrDefault<RemoteMmiSequence>(actionOutputArgs, "sequence", RemoteMmiSequence::MMI_LED_SEQUENCE_OFF);   
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, type, actionOutput](){         
         Jabra_ReturnCode retv = Jabra_SetRemoteMmiAction(deviceId, type, actionOutput);     
 
@@ -974,15 +1147,21 @@ Napi::Value napi_SetRemoteMmiAction(const Napi::CallbackInfo& info) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         } 
       }     
-    ))->Queue();         
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_IsNewportRemoteManagementEnabled(const Napi::CallbackInfo& info) {
     const char * const functionName = __func__;
-    return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(functionName, info,
+    return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(functionName, util::AsyncOptions::ReadOnly(), info,
         [functionName](unsigned short deviceId) {
             bool result = false;
             Jabra_ReturnCode retCode = Jabra_IsNewportRemoteManagementEnabled(deviceId, &result);
@@ -1010,29 +1189,39 @@ Napi::Value napi_SetXpressUrl(const Napi::CallbackInfo& info) {
     const char * const functionName = __func__;
     Napi::Env env = info.Env();
 
-    if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::FUNCTION})) {
+    util::CallOptions callOptions;
+    if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING}, callOptions)) {
+        if (callOptions.aborted) {
+            return util::AbortedPromise(env, functionName);
+        }
+
         const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
         const std::string url = info[1].As<Napi::String>();
-        Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-        (new util::JAsyncWorker<void, void>(
+        auto * const worker = new util::JAsyncWorker<void, void>(
             functionName,
-            javascriptResultCallback,
+            env,
             [functionName, deviceId, url](){
                 Jabra_ReturnCode retCode = Jabra_SetXpressUrl(deviceId, url.c_str());
                 if (retCode != Return_Ok) {
                     util::JabraReturnCodeException::LogAndThrow(functionName, retCode);
                 }
             }
-        ))->Queue();
+        );
+        worker->SetDeviceStrand(deviceId);
+        worker->SetCallOptions(callOptions);
+
+        const Napi::Value promise = worker->Promise();
+        worker->Queue();
+        return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_GetXpressUrl(const Napi::CallbackInfo& info) {
     const char * const functionName = __func__;
-    return util::SimpleDeviceAsyncFunction<Napi::String, std::string>(functionName, info,
+    return util::SimpleDeviceAsyncFunction<Napi::String, std::string>(functionName, util::AsyncOptions::ReadOnly(), info,
         [functionName](unsigned short deviceId) {
             // 2 * 1024 == 2 Kb is the maximum allowed by Jabra_GetXpressUrl
             int size = 2 * 1024;
@@ -1055,8 +1244,12 @@ Napi::Value napi_GetWhiteboardPosition(const Napi::CallbackInfo& info) {
     const char * const functionName = __func__;
     Napi::Env env = info.Env();
 
-    if (!util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::FUNCTION})) {
-        return env.Undefined();
+    util::CallOptions callOptions;
+    if (!util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::NUMBER}, callOptions)) {
+        return util::RejectedPromise(env, functionName);
+    }
+    if (callOptions.aborted) {
+        return util::AbortedPromise(env, functionName);
     }
 
     /*
@@ -1065,11 +1258,10 @@ Napi::Value napi_GetWhiteboardPosition(const Napi::CallbackInfo& info) {
      */
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const uint8_t whiteboardId = (uint8_t)(info[1].As<Napi::Number>().Int32Value());
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<Jabra_WhiteboardPosition, Napi::Object>(
+    auto * const worker = new util::JAsyncWorker<Jabra_WhiteboardPosition, Napi::Object>(
         functionName,
-        javascriptResultCallback,
+        env,
         [functionName, deviceId, whiteboardId]() {
             Jabra_WhiteboardPosition whiteboardPosition;
             Jabra_ReturnCode retCode = Jabra_GetWhiteboardPosition(deviceId,
@@ -1096,23 +1288,30 @@ Napi::Value napi_GetWhiteboardPosition(const Napi::CallbackInfo& info) {
 
             return jsWhiteboard;
         }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
 
-    return env.Undefined();
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
 }
 
 Napi::Value napi_SetWhiteboardPosition(const Napi::CallbackInfo& info) {
     const char * const functionName = __func__;
     Napi::Env env = info.Env();
 
-    if (!util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::OBJECT, util::FUNCTION})) {
-        return env.Undefined();
+    util::CallOptions callOptions;
+    if (!util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::NUMBER, util::OBJECT}, callOptions)) {
+        return util::RejectedPromise(env, functionName);
+    }
+    if (callOptions.aborted) {
+        return util::AbortedPromise(env, functionName);
     }
 
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const uint8_t whiteboardId = (uint8_t)(info[1].As<Napi::Number>().Int32Value());
     Napi::Object whiteboardCorners = info[2].As<Napi::Object>();
-    Napi::Function javascriptResultCallback = info[3].As<Napi::Function>();
 
     Napi::Object lowerLeftCorner = whiteboardCorners.Get("lowerLeftCorner").As<Napi::Object>();
     Napi::Object lowerRightCorner = whiteboardCorners.Get("lowerRightCorner").As<Napi::Object>();
@@ -1129,9 +1328,9 @@ Napi::Value napi_SetWhiteboardPosition(const Napi::CallbackInfo& info) {
     whiteboardPosition.upperLeftCornerX = (uint16_t) util::getObjInt32OrDefault(upperLeftCorner, "x", 0);
     whiteboardPosition.upperLeftCornerY = (uint16_t) util::getObjInt32OrDefault(upperLeftCorner, "y", 0);
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
         functionName,
-        javascriptResultCallback,
+        env,
         [functionName, deviceId, whiteboardId, whiteboardPosition]() {
             Jabra_ReturnCode retCode = Jabra_SetWhiteboardPosition(deviceId,
                 whiteboardId, &whiteboardPosition);
@@ -1141,16 +1340,20 @@ Napi::Value napi_SetWhiteboardPosition(const Napi::CallbackInfo& info) {
                     retCode);
             }
         }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
 
-    return env.Undefined();
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
 }
 
 Napi::Value napi_GetZoom(const Napi::CallbackInfo& info) {
     const char * const functionName = __func__;
 
     return util::SimpleDeviceAsyncFunction<Napi::Number, uint16_t>(
-        functionName, info,
+        functionName, util::AsyncOptions::ReadOnly(), info,
         [functionName](unsigned short deviceId) {
             uint16_t zoom;
             Jabra_ReturnCode retCode = Jabra_GetZoom(deviceId, &zoom);
@@ -1171,17 +1374,20 @@ Napi::Value napi_SetZoom(const Napi::CallbackInfo& info) {
     const char * const functionName = __func__;
     Napi::Env env = info.Env();
 
-    if (!util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER, util::FUNCTION})) {
-        return env.Undefined();
+    util::CallOptions callOptions;
+    if (!util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::NUMBER}, callOptions)) {
+        return util::RejectedPromise(env, functionName);
+    }
+    if (callOptions.aborted) {
+        return util::AbortedPromise(env, functionName);
     }
 
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     uint16_t zoom = (uint16_t) info[1].As<Napi::Number>().Int32Value();
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
         functionName,
-        javascriptResultCallback,
+        env,
         [functionName, deviceId, zoom]() {
             Jabra_ReturnCode retCode = Jabra_SetZoom(deviceId, zoom);
 
@@ -1190,16 +1396,20 @@ Napi::Value napi_SetZoom(const Napi::CallbackInfo& info) {
                     retCode);
             }
         }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
 
-    return env.Undefined();
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
 }
 
 Napi::Value napi_GetZoomLimits(const Napi::CallbackInfo& info) {
     const char * const functionName = __func__;
 
     return util::SimpleDeviceAsyncFunction<Napi::Object, Jabra_ZoomLimits>(
-        functionName, info,
+        functionName, util::AsyncOptions::ReadOnly(), info,
         [functionName](unsigned short deviceId) {
             Jabra_ZoomLimits limits;
             Jabra_ReturnCode retCode = Jabra_GetZoomLimits(deviceId, &limits);
@@ -1,8 +1,9 @@
 import { SdkIntegration } from "./sdkintegration";
 import { AddonLogSeverity, DeviceTiming, DevLogData, AudioFileFormatEnum,
-  RemoteMmiActionOutput, WhiteboardPosition, ZoomLimits } from "./core-types";
+  RemoteMmiActionOutput, WhiteboardPosition, ZoomLimits, CallOptions, DeviceIdentity } from "./core-types";
 import { isNodeJs } from './util';
 import { _JabraNativeAddonLog } from './logger';
+import { _withCallOptions } from './calloptions';
 
 // Browser friendly type-only import:
 type _EventEmitter = import('events').EventEmitter;
@@ -24,7 +25,7 @@ if (isNodeJs()) {
 } 
 
 import { DeviceInfo, RCCStatus, ConfigInfo, ConfigParamsCloud, DeviceCatalogueParams,
-    FirmwareInfoType, SettingType, DeviceSettings, PairedListInfo, NamedAsset,
+    FirmwareInfoType, SettingType, DeviceSettings, DeviceSettingsSchema, DeviceSettingValues, PairedListInfo, NamedAsset,
     DectInfo } from './core-types';
 
 import { enumAPIReturnCode, enumDeviceErrorStatus, enumDeviceBtnType, enumDeviceConnectionType,
@@ -35,8 +36,8 @@ import { enumAPIReturnCode, enumDeviceErrorStatus, enumDeviceBtnType, enumDevice
 import * as _jabraEnums from './jabra-enums';
 
 import { MetaApi, ClassEntry, _getJabraApiMetaSync } from './meta';
+import { NativeEventType } from './nativeevents';
 
-import * as util from 'util';
 import { throws } from "assert";
 
 export namespace DeviceTypeCallbacks {
@@ -56,6 +57,48 @@ export type DeviceTypeEvents = 'btnPress' | 'busyLightChange' | 'downloadFirmwar
 
 export const DeviceEventsList : DeviceTypeEvents[] = ['btnPress', 'busyLightChange', 'downloadFirmwareProgress', 'onBTParingListChange', 'onGNPBtnEvent', 'onDevLogEvent', 'onBatteryStatusUpdate', 'onRemoteMmiEvent', 'onUploadProgress', 'onDectInfoEvent'];
 
+/**
+ * The native event each device event is emitted for. Native events for which the device has no listeners
+ * are dropped natively (busyLightChange has no native event).
+ *
+ * @internal
+ * @hidden
+ */
+const nativeEventOf: { [event in DeviceTypeEvents]?: NativeEventType } = {
+    btnPress: NativeEventType.buttonInDataTranslated,
+    downloadFirmwareProgress: NativeEventType.firmwareProgress,
+    onBTParingListChange: NativeEventType.pairingList,
+    onGNPBtnEvent: NativeEventType.gnpButton,
+    onDevLogEvent: NativeEventType.devLog,
+    onBatteryStatusUpdate: NativeEventType.batteryStatus,
+    onRemoteMmiEvent: NativeEventType.remoteMmi,
+    onUploadProgress: NativeEventType.uploadProgress,
+    onDectInfoEvent: NativeEventType.dectInfo
+};
+
+/**
+ * A recent device event, as kept in the native event history.
+ */
+export interface DeviceEventHistoryEntry {
+    /* Increasing per device, starting from 1 when the device is attached. */
+    sequenceNumber: number;
+    /* The time since EPOC that the event happened. */
+    time_ms: number;
+    event: DeviceTypeEvents;
+    /* The arguments passed to listeners of the event. */
+    args: any[];
+}
+
+/**
+ * Recent events of a device (see DeviceType.getEventHistoryAsync).
+ */
+export interface DeviceEventHistory {
+    /* Sequence number of the last event of the device (also if not kept) - pass it to the next call to only get newer events. */
+    lastSequenceNumber: number;
+    /* Kept events in order (the oldest events of each type are dropped, see eventHistoryCapacity). */
+    events: DeviceEventHistoryEntry[];
+}
+
 /** 
  * Represents a concrete Jabra device and the operations that can be done on it.   
  */
@@ -76,6 +119,8 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
         }
         
         this._eventEmitter = new events.EventEmitter();
+        this._eventEmitter.on('newListener', (event: string | symbol) => this._updateEventInterest(event));
+        this._eventEmitter.on('removeListener', () => this._updateEventInterest());
 
         this.deviceID = deviceInfo.deviceID;
         this.deviceName = deviceInfo.deviceName;
@@ -89,6 +134,190 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
         this.isInFirmwareUpdateMode = deviceInfo.isInFirmwareUpdateMode;
         this.attached_time_ms = attached_time_ms;
         this.detached_time_ms = undefined;
+        this._usbDevicePath = (deviceInfo as DeviceInfo).usbDevicePath;
+    }
+
+    /** 
+    * @internal 
+    * @hidden
+    */
+    private _usbDevicePath?: string;
+
+    /**
+     * Is the device info of the same device? The Jabra SDK may report a different device with the same device ID,
+     * so the USB device path (or else the ESN) must match too, when known for both.
+     *
+     * @internal
+     * @hidden
+     */
+    _isSameDevice(deviceInfo: DeviceInfo): boolean {
+        if (deviceInfo.deviceID !== this.deviceID || deviceInfo.productID !== this.productID) {
+            return false;
+        }
+        if (this._usbDevicePath && deviceInfo.usbDevicePath) {
+            return deviceInfo.usbDevicePath === this._usbDevicePath;
+        }
+        if (this.ESN && deviceInfo.ESN) {
+            return deviceInfo.ESN === this.ESN;
+        }
+        return true;
+    }
+
+    /**
+     * Update the device info of the same device (see _isSameDevice), f.x. from its attach event after it was taken
+     * from an attached devices snapshot, and the attach time if known.
+     *
+     * @internal
+     * @hidden
+     */
+    _updateDeviceInfo(deviceInfo: DeviceInfo, attached_time_ms?: number): void {
+        // Assign to the readonly fields even though they are formally readonly because we don't want clients to change them.
+        const self = this as { -readonly [K in keyof DeviceType]: DeviceType[K] };
+        self.deviceName = deviceInfo.deviceName;
+        self.ESN = deviceInfo.ESN;
+        self.vendorID = deviceInfo.vendorID;
+        self.variant = deviceInfo.variant;
+        self.connectionType = deviceInfo.connectionType;
+        self.errorStatus = deviceInfo.errorStatus;
+        self.isDongleDevice = deviceInfo.isDongleDevice;
+        self.isInFirmwareUpdateMode = deviceInfo.isInFirmwareUpdateMode;
+        if (deviceInfo.usbDevicePath) {
+            this._usbDevicePath = deviceInfo.usbDevicePath;
+        }
+        if (attached_time_ms !== undefined) {
+            self.attached_time_ms = attached_time_ms;
+        }
+    }
+
+    /** 
+    * @internal 
+    * @hidden
+    */
+    private _eventInterestMask?: number;
+
+    /** 
+    * @internal 
+    * @hidden
+    */
+    private _eventInterestPending = false;
+
+    /**
+     * Tell the native side which device events have listeners, so events nobody listens for are not queued for
+     * javascript. Called when listeners are added (newListener is emitted before the listener is added, hence
+     * 'adding') or removed.
+     *
+     * The native side delivers all events of a device until it gets the first mask, so the first mask is only sent
+     * once the current task (f.x. an attach handler adding several listeners) is done, so none of its listeners miss
+     * events in between.
+     *
+     * @internal
+     * @hidden
+     */
+    private _updateEventInterest(adding?: string | symbol): void {
+        if (this._eventInterestMask === undefined) {
+            if (!this._eventInterestPending) {
+                this._eventInterestPending = true;
+                setImmediate(() => {
+                    this._eventInterestPending = false;
+                    if (this.detached_time_ms === undefined) {
+                        this._sendEventInterest();
+                    }
+                });
+            }
+            return;
+        }
+
+        this._sendEventInterest(adding);
+    }
+
+    /** 
+    * @internal 
+    * @hidden
+    */
+    private _sendEventInterest(adding?: string | symbol): void {
+        let mask = 0;
+        for (const event of Object.keys(nativeEventOf) as DeviceTypeEvents[]) {
+            if (event === adding || this._eventEmitter.listenerCount(event) > 0) {
+                mask |= (1 << nativeEventOf[event]!);
+            }
+        }
+
+        if (mask !== this._eventInterestMask) {
+            this._eventInterestMask = mask;
+            try {
+                sdkIntegration.SetDeviceEventInterest(this.deviceID, mask);
+            } catch (err) {
+                _JabraNativeAddonLog(AddonLogSeverity.error, this._sendEventInterest.name, "failed with", err);
+            }
+        }
+    }
+
+    /** 
+    * @internal 
+    * @hidden
+    */
+    private _buttonCatalogue?: { revision: number, buttons: Map<number, { buttonTypeValue: string, events: Map<number, string> }> };
+
+    /**
+     * Resolve GNP button presses delivered natively as flattened (buttonTypeKey, key) pairs into the
+     * onGNPBtnEvent structure, using the native button catalogue of the device (fetched again only when
+     * its revision changes).
+     *
+     * @internal
+     * @hidden
+     */
+    _resolveGnpButtonEvents(buttonPairs: number[], catalogueRevision: number): Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }> {
+        if (!this._buttonCatalogue || this._buttonCatalogue.revision !== catalogueRevision) {
+            const catalogue = sdkIntegration.GetButtonCatalogue(this.deviceID);
+            const buttons = new Map<number, { buttonTypeValue: string, events: Map<number, string> }>();
+            for (const button of catalogue.buttons) {
+                buttons.set(button.buttonTypeKey, {
+                    buttonTypeValue: button.buttonTypeValue,
+                    events: new Map(button.buttonEventType.map((e): [number, string] => [e.key, e.value]))
+                });
+            }
+            this._buttonCatalogue = { revision: catalogue.revision, buttons };
+        }
+
+        // Group by button type in order of appearance (as the sdk does):
+        const result: Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }> = [];
+        for (let i = 0; i + 1 < buttonPairs.length; i += 2) {
+            const buttonTypeKey = buttonPairs[i];
+            const key = buttonPairs[i + 1];
+            const button = this._buttonCatalogue.buttons.get(buttonTypeKey);
+            let target = result.find((b) => b.buttonTypeKey === buttonTypeKey);
+            if (!target) {
+                target = { buttonTypeKey, buttonTypeValue: button ? button.buttonTypeValue : "", buttonEventType: [] };
+                result.push(target);
+            }
+            target.buttonEventType.push({ key, value: (button && button.events.get(key)) || "" });
+        }
+        return result;
+    }
+
+    /** 
+    * @internal 
+    * @hidden
+    */
+    private _prefetchedIdentity?: DeviceIdentity;
+
+    /**
+     * Set the identity prefetched natively when the device was attached.
+     *
+     * @internal
+     * @hidden
+     */
+    _setPrefetchedIdentity(identity: DeviceIdentity | undefined): void {
+        this._prefetchedIdentity = identity;
+    }
+
+    /**
+     * The identity (ESN, firmware version, SKU etc.) prefetched when the device was attached, if enabled
+     * with the attachPrefetch native config parameter. Only the parts configured and successfully
+     * fetched are set.
+     */
+    get prefetchedIdentity(): DeviceIdentity | undefined {
+        return this._prefetchedIdentity;
     }
 
     readonly ESN: string;
@@ -116,24 +345,26 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     //CallControl
     /**
      * Checks for OffHook command support by the device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - Returns `true` if supported, otherwise `false`.
      */
-    isOffHookSupportedAsync(): Promise<boolean> {
+    isOffHookSupportedAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isOffHookSupportedAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsOffHookSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsOffHookSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isOffHookSupportedAsync.name, "returned with", result);
             return result;
         });
     }
     /**
      * Checks for Mute command support by the device (Async).
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - Returns `true` if supported, otherwise `false`.
      */
-    isMuteSupportedAsync(): Promise<boolean> {
+    isMuteSupportedAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isMuteSupportedAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsMuteSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsMuteSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isMuteSupportedAsync.name, "returned with", result);
             return result;
         });
@@ -141,12 +372,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Checks for Ringer command support by the device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - Returns `true` if supported, otherwise `false`.
      */
-    isRingerSupportedAsync(): Promise<boolean> {
+    isRingerSupportedAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isRingerSupportedAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsRingerSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsRingerSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isRingerSupportedAsync.name, "returned with", result);
             return result;
         });
@@ -154,12 +386,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Checks for Hold support by the device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - Returns `true` if supported, otherwise `false`.
      */
-    isHoldSupportedAsync(): Promise<boolean> {
+    isHoldSupportedAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isHoldSupportedAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsHoldSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsHoldSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isHoldSupportedAsync.name, "returned with", result);
             return result;
         });
@@ -167,12 +400,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Checks for Online mode support by the device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - Returns `true` if supported, otherwise `false`.
      */
-    isOnlineSupportedAsync(): Promise<boolean> {
+    isOnlineSupportedAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isOnlineSupportedAsync.name, "called with", this.deviceID);
-        return util.promisify(sdkIntegration.IsOnlineSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsOnlineSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isOnlineSupportedAsync.name, "returned with", result);
             return result;
         });
@@ -180,12 +414,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Checks if busylight is supported by the device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - Returns `true` if supported, otherwise `false`.
      */
-    isBusyLightSupportedAsync(): Promise<boolean> {
+    isBusyLightSupportedAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isBusyLightSupportedAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsBusyLightSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsBusyLightSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isBusyLightSupportedAsync.name, "returned with", result);
             return result;
         });
@@ -193,88 +428,96 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Set device's offhook state to true (Async).
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    offhookAsync(): Promise<void> {
+    offhookAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.offhookAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.SetOffHook)(this.deviceID, true).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetOffHook(this.deviceID, true, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.offhookAsync.name, "returned");
         });
     }
 
      /**
      * Set device's offhook state to false.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    onhookAsync(): Promise<void> {
+    onhookAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.onhookAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.SetOffHook)(this.deviceID, false).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetOffHook(this.deviceID, false, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.onhookAsync.name, "returned");
         });
     }
 
     /**
      * Set device's mute state to true i.e., device gets muted.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    muteAsync(): Promise<void> {
+    muteAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.muteAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.SetMute)(this.deviceID, true).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetMute(this.deviceID, true, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.muteAsync.name, "returned");
         });
     }
 
      /**
      * Set device's mute state to false i.e., device gets unmuted.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    unmuteAsync(): Promise<void> {
+    unmuteAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.unmuteAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.SetMute)(this.deviceID, false).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetMute(this.deviceID, false, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.unmuteAsync.name, "returned");
         });
     }
 
     /**
      * Set device's ringer state to true.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    ringAsync(): Promise<void> {
+    ringAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.ringAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.SetRinger)(this.deviceID, true).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetRinger(this.deviceID, true, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.ringAsync.name, "returned");
         });
     }
 
     /**
      * Set device's ringer state to false.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    unringAsync(): Promise<void> {
+    unringAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.unringAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.SetRinger)(this.deviceID, false).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetRinger(this.deviceID, false, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.unringAsync.name, "returned");
         });
     }
 
     /**
      * Set device's hold state to true.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    holdAsync(): Promise<void> {
+    holdAsync(options?: CallOptions): Promise<void> {
        _JabraNativeAddonLog(AddonLogSeverity.verbose, this.holdAsync.name, "called with", this.deviceID); 
-       return util.promisify(sdkIntegration.SetHold)(this.deviceID, true).then(() => {
+       return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetHold(this.deviceID, true, nativeOptions)).then(() => {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.holdAsync.name, "returned");
        });
     }
 
     /**
      * Set device's hold state to false.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    resumeAsync(): Promise<void> {
+    resumeAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.resumeAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.SetHold)(this.deviceID, false).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetHold(this.deviceID, false, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.resumeAsync.name, "returned");
         });
     }
@@ -282,12 +525,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * It opens radio link between base/dongle and device.
      * @param {boolean} online - Boolean value to set Online On/Off
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
     
      */
-    setOnlineAsync(online: boolean): Promise<void> {
+    setOnlineAsync(online: boolean, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setOnlineAsync.name, "called with", this.deviceID, online); 
-        return util.promisify(sdkIntegration.SetOnline)(this.deviceID, online).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetOnline(this.deviceID, online, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setOnlineAsync.name, "returned");
         });
     }
@@ -295,23 +539,25 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Set busylight status (Async).
      * @param {boolean} status - Boolean value to set busylight on / off.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    setBusyLightStatusAsync(status: boolean): Promise<void> {
+    setBusyLightStatusAsync(status: boolean, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setBusyLightStatusAsync.name, "called with", this.deviceID, status); 
-        return util.promisify(sdkIntegration.SetBusyLightStatus)(this.deviceID, status).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetBusyLightStatus(this.deviceID, status, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setBusyLightStatusAsync.name, "returned");
         });
     }
 
     /**
      * Checks the status of busylight.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - `true` if busylight is on, `false` if busylight is off or if it is not supported.
      */
-    getBusyLightStatusAsync(): Promise<boolean> {
+    getBusyLightStatusAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getBusyLightStatusAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetBusyLightStatus)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetBusyLightStatus(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getBusyLightStatusAsync.name, "returned with", result);
             return result;
         });
@@ -331,11 +577,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Get ESN (electronic serial number).
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<string, JabraError>} - Resolve `string` if successful otherwise Reject with `error`.
      */
-    getESNAsync(): Promise<string> {
+    getESNAsync(options?: CallOptions): Promise<string> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getESNAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetESN)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetESN(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getESNAsync.name, "returned with", result);
             return result;
         });
@@ -343,11 +590,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Get asset with name.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<NamedAsset, JabraError>} - Resolve NamedAsset `object` if successful otherwise Reject with `error`.
      */
-    getNamedAssetAsyngetNamec(assetName: string): Promise<NamedAsset> {
+    getNamedAssetAsyngetNamec(assetName: string, options?: CallOptions): Promise<NamedAsset> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getNamedAssetAsyngetNamec.name, "called with", this.deviceID, assetName); 
-        return util.promisify(sdkIntegration.GetNamedAsset)(this.deviceID, assetName).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetNamedAsset(this.deviceID, assetName, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getNamedAssetAsyngetNamec.name, "returned with", result);
             return result;
         });
@@ -355,12 +603,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Get battery status, if supported by device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<BatteryInfo, JabraError>} - Resolve batteryInfo `object` if successful otherwise Reject with `error`.
     
      */
-    getBatteryStatusAsync(): Promise<{ levelInPercent?: number, isCharging?: boolean, isBatteryLow?: boolean }> {
+    getBatteryStatusAsync(options?: CallOptions): Promise<{ levelInPercent?: number, isCharging?: boolean, isBatteryLow?: boolean }> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getBatteryStatusAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetBatteryStatus)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetBatteryStatus(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getBatteryStatusAsync.name, "returned with", result);
             return result;
         });
@@ -368,12 +617,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Gets  the device image path.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<string, JabraError>} - Resolve imagePath `string` if successful otherwise Reject with `error`.
    
      */
-    getImagePathAsync(): Promise<string> {
+    getImagePathAsync(options?: CallOptions): Promise<string> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getImagePathAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetDeviceImagePath)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetDeviceImagePath(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getImagePathAsync.name, "returned with", result);
             return result;
         });
@@ -381,11 +631,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Gets  the device image thumbnail path.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<string, JabraError>} - Resolve image Thumbnail Path `string` if successful otherwise Reject with `error`.
      */
-    getImageThumbnailPathAsync(): Promise<string> {
+    getImageThumbnailPathAsync(options?: CallOptions): Promise<string> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getImageThumbnailPathAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetDeviceImageThumbnailPath)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetDeviceImageThumbnailPath(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getImageThumbnailPathAsync.name, "returned with", result);
             return result;
         });
@@ -393,11 +644,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Check if battery is supported.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      */
-    isBatterySupportedAsync(): Promise<boolean> {
+    isBatterySupportedAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isBatterySupportedAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsBatteryStatusSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsBatteryStatusSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isBatterySupportedAsync.name, "returned with", result);
             return result;
         });
@@ -405,11 +657,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Is logging enabled on device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      */
-    isDevLogEnabledAsync(): Promise<boolean> {
+    isDevLogEnabledAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isDevLogEnabledAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsDevLogEnabled)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsDevLogEnabled(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isDevLogEnabledAsync.name, "returned with", result);
             return result;
         });
@@ -418,11 +671,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Enable/disable logging for a device.
      * @param {boolean} enable - whether to enable device log.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    enableDevLogAsync(enable: boolean): Promise<void> {
+    enableDevLogAsync(enable: boolean, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.enableDevLogAsync.name, "called with", this.deviceID, enable); 
-        return util.promisify(sdkIntegration.EnableDevLog)(this.deviceID, enable).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.EnableDevLog(this.deviceID, enable, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.enableDevLogAsync.name, "returned");
         });
     }
@@ -430,11 +684,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     // settings APIs
     /**
      * Gets the complete settings details (all groups and its settings) for a device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<Array<Setting>, JabraError>}  - Resolve setting `array` if successful otherwise Reject with `error`.
      */
-    getSettingsAsync(): Promise<DeviceSettings> {
+    getSettingsAsync(options?: CallOptions): Promise<DeviceSettings> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSettingsAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetSettings)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetSettings(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSettingsAsync.name, "returned with", result);
             return result;
         });
@@ -443,49 +698,121 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Gets the unique setting identified by a GUID of a device.
      * @param {string} guid - the unique setting identifier.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<Array<DeviceSettings>, JabraError>}  - Resolve setting `array` if successful otherwise Reject with `error`.
      */
-    getSettingAsync(guid: string): Promise<DeviceSettings> {
+    getSettingAsync(guid: string, options?: CallOptions): Promise<DeviceSettings> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSettingAsync.name, "called with", this.deviceID, guid); 
-        return util.promisify(sdkIntegration.GetSetting)(this.deviceID, guid).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetSetting(this.deviceID, guid, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSettingAsync.name, "returned with", result);
             return result;
         });
     }
 
+    /** 
+    * @internal 
+    * @hidden
+    */
+    private _settingsSchema?: Promise<DeviceSettingsSchema>;
+
+    /** 
+    * @internal 
+    * @hidden
+    */
+    private _settingsSchemaRevision = 0;
+
+    /**
+     * Gets the settings of a device without their current values (see getSettingValuesAsync). The
+     * schema is cached, so only the first call after attach (or after the schema changed) asks the
+     * sdk, and not even that if it was cached on disk (see the metadataCacheDir native config parameter).
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call, if it fetches the schema.
+     * @returns {Promise<DeviceSettingsSchema, JabraError>} - Resolve schema if successful otherwise Reject with `error`.
+     */
+    getSettingsSchemaAsync(options?: CallOptions): Promise<DeviceSettingsSchema> {
+        _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSettingsSchemaAsync.name, "called with", this.deviceID); 
+        if (!this._settingsSchema) {
+            const schema = _withCallOptions(options, (nativeOptions) => sdkIntegration.GetSettingsSchema(this.deviceID, nativeOptions));
+            this._settingsSchema = schema;
+            schema.then((result) => {
+                if (this._settingsSchema === schema) {
+                    if (result.revision === 0) {
+                        // Not cached natively (incomplete or device in firmware update mode), so not here either:
+                        this._settingsSchema = undefined;
+                    } else {
+                        this._settingsSchemaRevision = result.revision;
+                    }
+                }
+            }, () => {
+                if (this._settingsSchema === schema) {
+                    this._settingsSchema = undefined;
+                }
+            });
+        }
+        return this._settingsSchema.then((result) => {
+            _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSettingsSchemaAsync.name, "returned with revision", result.revision);
+            return result;
+        });
+    }
+
+    /**
+     * Gets the current values of all settings of a device, or of the setting identified by guid, as
+     * a compact array indexed like settingInfo of the schema (see getSettingsSchemaAsync). Much
+     * cheaper than getSettingsAsync for refreshing values. If schemaRevision of the result differs
+     * from the revision of the schema held, get the schema again.
+     * @param {string} [guid] - the unique setting identifier, if only one setting is needed.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
+     * @returns {Promise<DeviceSettingValues, JabraError>} - Resolve values if successful otherwise Reject with `error`.
+     */
+    getSettingValuesAsync(guid?: string, options?: CallOptions): Promise<DeviceSettingValues> {
+        _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSettingValuesAsync.name, "called with", this.deviceID, guid); 
+        const values = guid !== undefined ? _withCallOptions(options, (nativeOptions) => sdkIntegration.GetSettingValue(this.deviceID, guid, nativeOptions))
+                                          : _withCallOptions(options, (nativeOptions) => sdkIntegration.GetSettingValues(this.deviceID, nativeOptions));
+        return values.then((result) => {
+            _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSettingValuesAsync.name, "returned with", result);
+            if (this._settingsSchemaRevision !== 0 && result.schemaRevision !== this._settingsSchemaRevision) {
+                this._settingsSchema = undefined; // Fetched again on next use.
+                this._settingsSchemaRevision = 0;
+            }
+            return result;
+        });
+    }
+
     /**
      * Sets all the settings( including all groups and its settings) for a device.
      * @param {Array<DeviceSettings>} settings - pass only changed settings in an array
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`, `reboot` etc.
      * 
      * Nb. Currently this method returns an error with code=24 if rebooting as bi-result. 
      * TODO: Change signature to return reboot information normally instead.
      */
-    setSettingsAsync(settings: DeviceSettings): Promise<void> {
+    setSettingsAsync(settings: DeviceSettings, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setSettingsAsync.name, "called  with", settings); 
-        return util.promisify(sdkIntegration.SetSettings)(this.deviceID, settings).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetSettings(this.deviceID, settings, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setSettingsAsync.name, "returned");
         });
     }
     /**
      * Restore factory settings to device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    resetSettingsAsync(): Promise<void> {
+    resetSettingsAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.resetSettingsAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.FactoryReset)(this.deviceID).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.FactoryReset(this.deviceID, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.resetSettingsAsync.name, "returned");
         });
     }
 
     /**
      * Checks if supports factory reset.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - Returns `true` if device supports factory reset, `false` if device does not support factory reset.
      */
-    isFactoryResetSupportedAsync(): Promise<boolean> {
+    isFactoryResetSupportedAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isFactoryResetSupportedAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsFactoryResetSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsFactoryResetSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isFactoryResetSupportedAsync.name, "returned with", result);
             return result;
         });
@@ -493,14 +820,15 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
        
     /**
      * Returns error description for the error code
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Prmoise<Array<string>, JabraError>} - Resolve failedSetting `array` if successful otherwise Reject with `error`.
      * - return FailedSettings if one or more settings are failed while writing to device.
      * - return empty array if all settings are written successfully.
      * - **Note**: This API should be called if setSettingsAsync API does not return void.
      */
-    getFailedSettingNamesAsync(): Promise<Array<string>>{
+    getFailedSettingNamesAsync(options?: CallOptions): Promise<Array<string>>{
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getFailedSettingNamesAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetFailedSettingNames)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetFailedSettingNames(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getFailedSettingNamesAsync.name, "returned with", result);
             return result;
         });
@@ -510,11 +838,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Get firmware version of the device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<string, JabraError>} - Resolve version `string` if successful otherwise Reject with `error`.
      */
-    getFirmwareVersionAsync(): Promise<string> {
+    getFirmwareVersionAsync(options?: CallOptions): Promise<string> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getFirmwareVersionAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetFirmwareVersion)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetFirmwareVersion(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getFirmwareVersionAsync.name, "returned with", result);
             return result;
         });
@@ -523,12 +852,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Gets details of the latest firmware present in cloud.
      * @param {string} [authorization] - Authorization Id.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<FirmwareInfo, JabraError>} - Resolve firminfo `object` if successful otherwise Reject with `error`.
      */
-    getLatestFirmwareInformationAsync(authorization?: string): Promise<FirmwareInfoType> {
+    getLatestFirmwareInformationAsync(authorization?: string, options?: CallOptions): Promise<FirmwareInfoType> {
         const _authorization =  authorization || "";
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getLatestFirmwareInformationAsync.name, "called with", this.deviceID, _authorization); 
-        return util.promisify(sdkIntegration.GetLatestFirmwareInformation)(this.deviceID, _authorization).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetLatestFirmwareInformation(this.deviceID, _authorization, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getLatestFirmwareInformationAsync.name, "returned with", result);
             return result;
         });
@@ -536,13 +866,14 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Check if Firmware update available for device.
      * @param {string} [authorization] - authorizationId
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - `true` - if a new firmware update is available (existing firmware not up to date), `false` otherwise (existing firmware up to date).
      */
-    checkForFirmwareUpdateAsync(authorization?: string): Promise<boolean> {
+    checkForFirmwareUpdateAsync(authorization?: string, options?: CallOptions): Promise<boolean> {
         const _authorization =  authorization || "";
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.checkForFirmwareUpdateAsync.name, "called with", this.deviceID, _authorization);
-        return util.promisify(sdkIntegration.CheckForFirmwareUpdate)(this.deviceID, _authorization).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.CheckForFirmwareUpdate(this.deviceID, _authorization, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.checkForFirmwareUpdateAsync.name, "returned with", result);
             return result;
         });
@@ -551,12 +882,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
      * Downloads the specified firmware version file.
      * @param {string} version - Version for which file download needs to be initiated.
      * @param {string} [authorization] - Authorization Id.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.   
      */
-    downloadFirmwareAsync(version: string, authorization?: string): Promise<void> {
+    downloadFirmwareAsync(version: string, authorization?: string, options?: CallOptions): Promise<void> {
         const _authorization =  authorization || "";
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.downloadFirmwareAsync.name, "called with", this.deviceID, _authorization);
-        return util.promisify(sdkIntegration.DownloadFirmware)(this.deviceID, version, _authorization).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.DownloadFirmware(this.deviceID, version, _authorization, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.downloadFirmwareAsync.name, "returned");
         });
     }
@@ -564,12 +896,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Get the file path of the downloaded file.
      * @param {string} version - Version for which the path is required.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<string, JabraError>} - Resolve firmware file path `string` if successful otherwise Reject with `error`.
      * - **Note**: Call `downloadFirmwareAsync` first to ensure that data is current
      */
-    getFirmwareFilePathAsync(version: string): Promise<string> {
+    getFirmwareFilePathAsync(version: string, options?: CallOptions): Promise<string> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getFirmwareFilePathAsync.name, "called with", this.deviceID, version); 
-        return util.promisify(sdkIntegration.GetFirmwareFilePath)(this.deviceID, version).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetFirmwareFilePath(this.deviceID, version, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getFirmwareFilePathAsync.name, "returned with", result);
             return result;
         });
@@ -577,22 +910,24 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Cancels the firmware download (Async).
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    cancelFirmwareDownloadAsync(): Promise<void> {
+    cancelFirmwareDownloadAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.cancelFirmwareDownloadAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.CancelFirmwareDownload)(this.deviceID).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.CancelFirmwareDownload(this.deviceID, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.cancelFirmwareDownloadAsync.name, "returned");
         });
     }
     /**
      * Upgrades / Updates the firmware for the target device with specified version.
      * @param {string} firmwareFilePath - firmware file path.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.  
      */
-    updateFirmwareAsync(firmwareFilePath: string): Promise<void> {
+    updateFirmwareAsync(firmwareFilePath: string, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.updateFirmwareAsync.name, "called with", this.deviceID, firmwareFilePath); 
-        return util.promisify(sdkIntegration.UpdateFirmware)(this.deviceID, firmwareFilePath).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.UpdateFirmware(this.deviceID, firmwareFilePath, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.updateFirmwareAsync.name, "returned");
         });
     }
@@ -600,42 +935,46 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     // bluetooth APIs
     /**
      * Set the bluetooth device in pairing mode.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    setBTPairingAsync(): Promise<void> {
+    setBTPairingAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setBTPairingAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.SetBTPairing)(this.deviceID).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetBTPairing(this.deviceID, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setBTPairingAsync.name, "returned");
         });
     }
     /**
      * Stop search for available Bluetooth devices.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    stopBTPairingAsync(): Promise<void> {
+    stopBTPairingAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.stopBTPairingAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.StopBTPairing)(this.deviceID).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.StopBTPairing(this.deviceID, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.stopBTPairingAsync.name, "returned");
         });
     }
     
     /**
      * Search for available Bluetooth devices which are switched on, within range and ready to connect.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    searchNewDevicesAsync(): Promise<void> {
+    searchNewDevicesAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.searchNewDevicesAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.SearchNewDevices)(this.deviceID).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SearchNewDevices(this.deviceID, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.searchNewDevicesAsync.name, "returned");
         });
     }
     /**
      * Connect/Reconnect Bluetooth device to the Jabra Bluetooth adapter. Ensure the Bluetooth device is switched on and within range.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    connectBTDeviceAsync(): Promise<void> {
+    connectBTDeviceAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.connectBTDeviceAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.ConnectBTDevice)(this.deviceID).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.ConnectBTDevice(this.deviceID, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.connectBTDeviceAsync.name, "returned");
         });
     }
@@ -644,11 +983,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
      * @param {string} deviceName - name of device to be connected.
      * @param {string} deviceBTAddr -  BTAddress of device to be connected.
      * @param {boolean} isConnected - current status of device to be connected.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
     */
-    connectNewDeviceAsync(deviceName: string, deviceBTAddr: string, isConnected: boolean): Promise<void> {
+    connectNewDeviceAsync(deviceName: string, deviceBTAddr: string, isConnected: boolean, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.connectNewDeviceAsync.name, "called with", this.deviceID, deviceName, deviceBTAddr, isConnected);
-        return util.promisify(sdkIntegration.ConnectNewDevice)(this.deviceID, deviceName, deviceBTAddr, isConnected).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.ConnectNewDevice(this.deviceID, deviceName, deviceBTAddr, isConnected, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.connectNewDeviceAsync.name, "returned");
         });
     }
@@ -657,23 +997,25 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
      * @param {string} deviceName - name of device to be connected.
      * @param {string} deviceBTAddr -  BTAddress of device to be connected.
      * @param {boolean} isConnected - current status of device to be connected.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      * - **Note**       : After device connection, getPairingListAsync api has to be called to get updated connection status.
      */
-    connectPairedDeviceAsync(deviceName: string, deviceBTAddr: string, isConnected: boolean): Promise<void> {
+    connectPairedDeviceAsync(deviceName: string, deviceBTAddr: string, isConnected: boolean, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.connectPairedDeviceAsync.name, "called with", this.deviceID, deviceName, deviceBTAddr, isConnected);
-        return util.promisify(sdkIntegration.ConnectPairedDevice)(this.deviceID, deviceName, deviceBTAddr, isConnected).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.ConnectPairedDevice(this.deviceID, deviceName, deviceBTAddr, isConnected, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.connectPairedDeviceAsync.name, "returned");
         });
     }
 
     /**
      * Disconnect  Bluetooth device from  Bluetooth adapter.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    disconnectBTDeviceAsync(): Promise<void> {
+    disconnectBTDeviceAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.disconnectBTDeviceAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.DisconnectBTDevice)(this.deviceID).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.DisconnectBTDevice(this.deviceID, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.disconnectBTDeviceAsync.name, "returned");
         });
     }
@@ -683,12 +1025,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
      * @param {string} deviceName - name of device to be disconnected.
      * @param {string} deviceBTAddr -  BTAddress of device to be disconnected.
      * @param {boolean} isConnected - current status of device to be disconnected.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      * - **Note**       : After device disconnection, getPairingListAsync api has to be called to get updated connection status.
      */
-    disconnectPairedDeviceAsync(deviceName: string, deviceBTAddr: string, isConnected: boolean): Promise<void> {
+    disconnectPairedDeviceAsync(deviceName: string, deviceBTAddr: string, isConnected: boolean, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.disconnectPairedDeviceAsync.name, "called with", this.deviceID, deviceName, deviceBTAddr, isConnected); 
-        return util.promisify(sdkIntegration.DisconnectPairedDevice)(this.deviceID, deviceName, deviceBTAddr, isConnected).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.DisconnectPairedDevice(this.deviceID, deviceName, deviceBTAddr, isConnected, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.disconnectPairedDeviceAsync.name, "returned");
         });
     }
@@ -696,23 +1039,25 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * When Bluetooth adapter is plugged into the PC it will attempt to connect with the last connected Bluetooth device. If it cannot connect, it will automatically search for new Bluetooth devices to connect to.
      * @param {boolean} value - enable or disable for auto pairing.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    setAutoPairingAsync(value: boolean): Promise<void> {
+    setAutoPairingAsync(value: boolean, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setAutoPairingAsync.name, "called with", this.deviceID, value); 
-        return util.promisify(sdkIntegration.SetAutoPairing)(this.deviceID, value).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetAutoPairing(this.deviceID, value, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setAutoPairingAsync.name, "returned");
         });
     }
 
     /**
      * Get Auto pairing mode enable or disable.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - `true` if auto pairing mode is enabled, `false` otherwise.
      */
-    getAutoPairingAsync(): Promise<boolean> {
+    getAutoPairingAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getAutoPairingAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetAutoPairing)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetAutoPairing(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getAutoPairingAsync.name, "returned with", result);
             return result;
         });
@@ -720,12 +1065,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Checks if pairing list is supported by the device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - Returns `true` if pairing list is supported, false if device does not support pairing list.
      */
-    isPairingListSupportedAsync(): Promise<boolean> {
+    isPairingListSupportedAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isPairingListSupportedAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsPairingListSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsPairingListSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isPairingListSupportedAsync.name, "returned with", result);
             return result;
         });
@@ -733,11 +1079,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Gets the list of devices which are paired previously.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns { Promise<Array<PairedDevice>, JabraError>} - Resolve pairList `array` if successful otherwise Reject with `error`.
      */
-    getPairingListAsync(): Promise<Array<{ deviceName: string, deviceBTAddr: string, isConnected: boolean }>> {
+    getPairingListAsync(options?: CallOptions): Promise<Array<{ deviceName: string, deviceBTAddr: string, isConnected: boolean }>> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getPairingListAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetPairingList)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetPairingList(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getPairingListAsync.name, "returned with", result);
             return result;
         });
@@ -745,22 +1092,24 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Clear list of paired BT devices from BT adapter.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    clearPairingListAsync(): Promise<void> {
+    clearPairingListAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.clearPairingListAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.ClearPairingList)(this.deviceID).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.ClearPairingList(this.deviceID, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.clearPairingListAsync.name, "returned");
         });
     }
 
     /**
      * Get name of connected BT device with BT Adapter(Async).
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<string, JabraError>} - Resolve deviceName `string` if successful otherwise Reject with `error`.
      */
-    getConnectedBTDeviceNameAsync(): Promise<string> {
+    getConnectedBTDeviceNameAsync(options?: CallOptions): Promise<string> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getConnectedBTDeviceNameAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetConnectedBTDeviceName)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetConnectedBTDeviceName(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getConnectedBTDeviceNameAsync.name, "returned with", result);
             return result;
         });
@@ -768,12 +1117,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Gets the list of new devices which are available to pair & connect.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns { Promise<Array<PairedDevice>, JabraError>} - Resolve pairList `array` if successful otherwise Reject with `error`.
      * - **Note**: `isConnected`, flag in Pairing List Object, will always be false as device does not give connection status for the found device.
      */
-    getSearchDeviceListAsync(): Promise<Array<{ deviceName: string, deviceBTAddr: string, isConnected: boolean }>> {
+    getSearchDeviceListAsync(options?: CallOptions): Promise<Array<{ deviceName: string, deviceBTAddr: string, isConnected: boolean }>> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSearchDeviceListAsync.name, "called with", this.deviceID); 
-	    return util.promisify(sdkIntegration.GetSearchDeviceList)(this.deviceID).then((result) => {
+	    return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetSearchDeviceList(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSearchDeviceListAsync.name, "returned with", result);
             return result;
         });
@@ -782,11 +1132,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     //RMMI APIs
     /**
      * Gets the supported remote MMI for a device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<Array<ButtonEvent>, JabraError>} - Resolve btnEvent `array` if successful otherwise Reject with `error`.
      */
-    getSupportedButtonEventsAsync(): Promise<Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }>> {
+    getSupportedButtonEventsAsync(options?: CallOptions): Promise<Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }>> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSupportedButtonEventsAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetSupportedButtonEvents)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetSupportedButtonEvents(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSupportedButtonEventsAsync.name, "returned with", result);
             return result;
         });
@@ -795,11 +1146,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Configures the remote MMI events for a device.
      * @param {Array<{buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{key: number, value: string}>}>} btnEvents
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    getButtonFocusAsync(btnEvents: Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }>): Promise<void> {
+    getButtonFocusAsync(btnEvents: Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }>, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getButtonFocusAsync.name, "called with", this.deviceID, btnEvents);
-        return util.promisify(sdkIntegration.GetButtonFocus)(this.deviceID, btnEvents).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetButtonFocus(this.deviceID, btnEvents, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getButtonFocusAsync.name, "returned");
         });
     }
@@ -807,23 +1159,25 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Releases the remote MMI events configured in the device.
      * @param {Array<{buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{key: number, value: string}>}>} btnEvents
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    releaseButtonFocusAsync(btnEvents: Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }>): Promise<void> {
+    releaseButtonFocusAsync(btnEvents: Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }>, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.releaseButtonFocusAsync.name, "called with", this.deviceID, btnEvents);
-        return util.promisify(sdkIntegration.ReleaseButtonFocus)(this.deviceID, btnEvents).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.ReleaseButtonFocus(this.deviceID, btnEvents, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.releaseButtonFocusAsync.name, "returned");
         });
     }        
 
     /**
      * Checks if Upload Ringtone to the device is supported by the device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean>, Error} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - Returns `true` if Upload Ringtone to the device is supported, `false` if device does not support the ringtone upload to the device.
      */
-    isUploadRingtoneSupportedAsync(): Promise<boolean> {
+    isUploadRingtoneSupportedAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isUploadRingtoneSupportedAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsUploadRingtoneSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsUploadRingtoneSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isUploadRingtoneSupportedAsync.name, "returned with", result);
             return result;
         });
@@ -832,22 +1186,24 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Upload ringtone to device  (Async).
      * @param {string} filePath filepath of image file to be uploaded.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    uploadRingtoneAsync(filePath: string): Promise<void> {
+    uploadRingtoneAsync(filePath: string, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.uploadRingtoneAsync.name, "called with", this.deviceID, filePath);
-        return util.promisify(sdkIntegration.UploadRingtone)(this.deviceID, filePath).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.UploadRingtone(this.deviceID, filePath, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.uploadRingtoneAsync.name, "returned");
         });
     }
 
     /**
      * Get details of audio file for uploading to device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<{ audioFileType: AudioFileFormatEnum, numChannels: number, bitsPerSample: number, sampleRate: number, maxFileSize: number }, JabraError>} - Resolve Audio File Detail `object` if successful otherwise Reject with `error`.
      */
-    getAudioFileParametersForUploadAsync(): Promise<{ audioFileType: AudioFileFormatEnum, numChannels: number, bitsPerSample: number, sampleRate: number, maxFileSize: number }> {
+    getAudioFileParametersForUploadAsync(options?: CallOptions): Promise<{ audioFileType: AudioFileFormatEnum, numChannels: number, bitsPerSample: number, sampleRate: number, maxFileSize: number }> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getAudioFileParametersForUploadAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetAudioFileParametersForUpload)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetAudioFileParametersForUpload(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getAudioFileParametersForUploadAsync.name, "returned with", result);
             return result;
         });
@@ -856,11 +1212,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Upload ringtone to device in .wav format.
      * @param {string} filePath filepath of image file to be uploaded.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    uploadWavRingtoneAsync(filePath: string): Promise<void> {
+    uploadWavRingtoneAsync(filePath: string, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.uploadWavRingtoneAsync.name, "called with", this.deviceID, filePath); 
-        return util.promisify(sdkIntegration.UploadWavRingtone)(this.deviceID, filePath).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.UploadWavRingtone(this.deviceID, filePath, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.uploadWavRingtoneAsync.name, "returned");
         });
     }
@@ -868,23 +1225,25 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Feature of configuring time to device (Async).
      * @param {DateTimeParam} timedate date and time in object format, where year is an offset from 1900.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    setDateTimeAsync(timedate: { sec: number, min: number, hour: number, mday: number, mon: number, year: number, wday: number }): Promise<void> {
+    setDateTimeAsync(timedate: { sec: number, min: number, hour: number, mday: number, mon: number, year: number, wday: number }, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setDateTimeAsync.name, "called with", this.deviceID, timedate); 
-       return util.promisify(sdkIntegration.SetDatetime)(this.deviceID, timedate).then(() => {
+       return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetDatetime(this.deviceID, timedate, nativeOptions)).then(() => {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setDateTimeAsync.name, "returned with");
     });
     }
 
     /**
      * Checks if date and time can be configured to device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`. 
      * - Returns `true` if configuring time for device is supported, `false` if device does not support date and time configuration.
      */
-    isSetDateTimeSupportedAsync(): Promise<boolean> {
+    isSetDateTimeSupportedAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isSetDateTimeSupportedAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsSetDateTimeSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsSetDateTimeSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isSetDateTimeSupportedAsync.name, "returned with", result);
             return result;
         });
@@ -892,12 +1251,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Checks if image upload is supported by the device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`. 
      * - Returns `true` if device supports image upload otherwise `false`.
      */
-    isUploadImageSupportedAsync(): Promise<boolean> {
+    isUploadImageSupportedAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isUploadImageSupportedAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsUploadImageSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsUploadImageSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isUploadImageSupportedAsync.name, "returned with", result);
             return result;
         });
@@ -906,23 +1266,25 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Upload image to device.
      * @param {string} filePath filepath of image file to be uploaded.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @return {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`. 
      */
-    uploadImageAsync(filePath: string): Promise<void> {
+    uploadImageAsync(filePath: string, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.uploadImageAsync.name, "called with", this.deviceID, filePath); 
-        return util.promisify(sdkIntegration.UploadImage)(this.deviceID, filePath).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.UploadImage(this.deviceID, filePath, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.uploadImageAsync.name, "returned");
         });
     }
 
     /**
      * Checks if setting protection is enabled.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve `boolean` if successful otherwise Reject with `error`.
      * - Returns `true` if setting protection is enabled otherwise `false`.
      */
-    isSettingProtectionEnabledAsync(): Promise<boolean> {
+    isSettingProtectionEnabledAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isSettingProtectionEnabledAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsSettingProtectionEnabled)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsSettingProtectionEnabled(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isSettingProtectionEnabledAsync.name, "returned with", result);
             return result;
         });
@@ -930,12 +1292,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**  
      * Get the panic list.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<Array<string>, JabraError>} - Resolve paniclist 'array' if successful otherwise Reject with `error`.
      * - panic code will be hex string
      */
-    getPanicsAsync(): Promise<Array<string>> {
+    getPanicsAsync(options?: CallOptions): Promise<Array<string>> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getPanicsAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetPanics)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetPanics(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getPanicsAsync.name, "returned with", result);
             return result;
         });
@@ -944,11 +1307,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Check if a feature is supported by a device.
      * @param {number} deviceFeature the feature to check, should be `enumDeviceFeature`
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolve isfeatureSupports `boolean` if successful otherwise Reject with `error`.
      */
-    isFeatureSupportedAsync(deviceFeature: number): Promise<boolean> {
+    isFeatureSupportedAsync(deviceFeature: number, options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isFeatureSupportedAsync.name, "called with", this.deviceID, deviceFeature);
-        return util.promisify(sdkIntegration.IsFeatureSupported)(this.deviceID,deviceFeature).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsFeatureSupported(this.deviceID,deviceFeature, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isFeatureSupportedAsync.name, "returned with", result);
             return result;
         });
@@ -956,11 +1320,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Check if GN or Std HID state is supported by a device.
+     *  @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      *  @returns {Promise<boolean, JabraError>} - Resolve isGnHidStdHidSupported `boolean` if successful otherwise Reject with `error`.
      */
-    isGnHidStdHidSupportedAsync(): Promise<boolean>  {
+    isGnHidStdHidSupportedAsync(options?: CallOptions): Promise<boolean>  {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isGnHidStdHidSupportedAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsGnHidStdHidSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsGnHidStdHidSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isGnHidStdHidSupportedAsync.name, "returned with", result);
             return result;
         });
@@ -968,12 +1333,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Get array of features supported by a device
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns { Promise<Array<enumDeviceFeature>, JabraError>} 
      * - Resolve array of supported features, should be enumDeviceFeature `array` if successful otherwise Reject with `error`.
      */
-    getSupportedFeaturesAsync(): Promise<Array<enumDeviceFeature>> {
+    getSupportedFeaturesAsync(options?: CallOptions): Promise<Array<enumDeviceFeature>> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSupportedFeaturesAsync.name, "called with", this.deviceID); 
-         return util.promisify(sdkIntegration.GetSupportedFeatures)(this.deviceID).then((result) => {
+         return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetSupportedFeatures(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSupportedFeaturesAsync.name, "returned with", result);
             return result;
         });
@@ -982,22 +1348,24 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Sets the HID working state to either standard HID (usb.org HID specification) or GN HID.
      * @param {number} hidState - state HID working state (`enumHidState`)
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    setHidWorkingStateAsync(hidState: enumHidState): Promise<void>  {
+    setHidWorkingStateAsync(hidState: enumHidState, options?: CallOptions): Promise<void>  {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setHidWorkingStateAsync.name, "called with", this.deviceID, hidState);
-        return util.promisify(sdkIntegration.SetHidWorkingState)(this.deviceID, hidState).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetHidWorkingState(this.deviceID, hidState, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setHidWorkingStateAsync.name, "returned");
         });
     }
 
     /**
      * Gets the HID working state.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<number, JabraError>} - Resolve hidState (`enumHidState`) if successful otherwise Reject with `error`.
      */
-    getHidWorkingStateAsync() : Promise<enumHidState>  {
+    getHidWorkingStateAsync(options?: CallOptions) : Promise<enumHidState>  {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getHidWorkingStateAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetHidWorkingState)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetHidWorkingState(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getHidWorkingStateAsync.name, "returned with", result);
             return result;
         });
@@ -1009,11 +1377,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
      * to query feature support enumDeviceFeature.FullWizardMode or
      * enumDeviceFeature.LimitedWizardMode.
      * @param {number} wizardMode Wizard mode to be set (one of WizardModes).
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    setWizardModeAsync(wizardMode: enumWizardMode) : Promise<void>  {
+    setWizardModeAsync(wizardMode: enumWizardMode, options?: CallOptions) : Promise<void>  {
        _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setWizardModeAsync.name, "called with", this.deviceID, wizardMode); 
-       return util.promisify(sdkIntegration.SetWizardMode)(this.deviceID,wizardMode).then(() => {
+       return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetWizardMode(this.deviceID,wizardMode, nativeOptions)).then(() => {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setWizardModeAsync.name, "returned");
        });
     }
@@ -1023,12 +1392,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     * setup wizard or none will run on next power-on). 
     * Use isFeatureSupportedAsync to query feature support
     * enumDeviceFeature.FullWizardMode or enumDeviceFeature.LimitedWizardMode.
+    * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
     * @returns {Promise<number, JabraError>} 
     * - Resolve enumWizardMode Current wizard mode (one of WizardModes) `number` if successful otherwise Reject with `error`.
     */ 
-    getWizardModeAsync() : Promise<enumWizardMode>  {
+    getWizardModeAsync(options?: CallOptions) : Promise<enumWizardMode>  {
        _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getWizardModeAsync.name, "called with", this.deviceID); 
-       return util.promisify(sdkIntegration.GetWizardMode)(this.deviceID).then((result) => {
+       return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetWizardMode(this.deviceID, nativeOptions)).then((result) => {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getWizardModeAsync.name, "returned with", result);
         return result;
        });
@@ -1036,12 +1406,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
     * Reads the secure connection status (whether it is in legacy mode, secure mode or restricted) 
+    * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
     * @returns {Promise<number, JabraError>} 
     * - Resolve enumSecureCommectionMode secure connection mode (one of SecureConnectionModes) `number` if successful otherwise Reject with `error`.
     */ 
-    getSecureConnectionModeAsync() : Promise<enumSecureConnectionMode>  {
+    getSecureConnectionModeAsync(options?: CallOptions) : Promise<enumSecureConnectionMode>  {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSecureConnectionModeAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetSecureConnectionMode)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetSecureConnectionMode(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getSecureConnectionModeAsync.name, "returned with", result);
             return result;
         });
@@ -1049,11 +1420,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
 
     /**
      * Reboot device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    rebootDeviceAsync(): Promise<void> {
+    rebootDeviceAsync(options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.rebootDeviceAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.RebootDevice)(this.deviceID).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.RebootDevice(this.deviceID, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.rebootDeviceAsync.name, "returned");
         });
     }
@@ -1063,11 +1435,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
      * @param {string} deviceName - name of device to be connected.
      * @param {string} deviceBTAddr -  BTAddress of device to be connected.
      * @param {boolean} isConnected - current status of device to be connected.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    clearPairedDeviceAsync(deviceName: string, deviceBTAddr: string, isConnected: boolean): Promise<void>  {
+    clearPairedDeviceAsync(deviceName: string, deviceBTAddr: string, isConnected: boolean, options?: CallOptions): Promise<void>  {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.clearPairedDeviceAsync.name, "called with", this.deviceID, deviceName, deviceBTAddr, isConnected);
-        return util.promisify(sdkIntegration.ClearPairedDevice)(this.deviceID, deviceName, deviceBTAddr, isConnected).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.ClearPairedDevice(this.deviceID, deviceName, deviceBTAddr, isConnected, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.clearPairedDeviceAsync.name, "returned");
         });
     }
@@ -1075,12 +1448,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Downloads the latest FW updater relevant for this device
      * @param {string} [authorization] - Authorization Id.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    downloadFirmwareUpdaterAsync(authorization?: string): Promise<void>  {
+    downloadFirmwareUpdaterAsync(authorization?: string, options?: CallOptions): Promise<void>  {
         const _authorization = authorization || "";
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.downloadFirmwareUpdaterAsync.name, "called with", this.deviceID, _authorization);
-        return util.promisify(sdkIntegration.DownloadFirmwareUpdater)(this.deviceID, _authorization).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.DownloadFirmwareUpdater(this.deviceID, _authorization, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.downloadFirmwareUpdaterAsync.name, "returned");
         });
     }
@@ -1088,22 +1462,24 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Sets a static timestamp in the device. Can be used for later referencing using Jabra_GetTime.
      * @param {Number} timeStamp - Timestamp to be set. Unix epoch.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @return {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    setTimestampAsync(timeStamp: number) : Promise<void>  {
+    setTimestampAsync(timeStamp: number, options?: CallOptions) : Promise<void>  {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setTimestampAsync.name, "called with", this.deviceID, timeStamp);
-        return util.promisify(sdkIntegration.SetTimestamp)(this.deviceID, timeStamp).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetTimestamp(this.deviceID, timeStamp, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setTimestampAsync.name, "returned");
         });
     }
     
     /**
      * Gets the static timestamp in the device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<number, JabraError>} - Resolve Date in milliseconds `number` if successful otherwise Reject with `error`.
      */
-    getTimestampAsync() : Promise<number>  {
+    getTimestampAsync(options?: CallOptions) : Promise<number>  {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getTimestampAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.GetTimestamp)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetTimestamp(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getTimestampAsync.name, "returned with", result);
             return result;
         });
@@ -1113,23 +1489,25 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     * Play Ringtone in Device.
     * @param {number} level volume Level to Play.
     * @param {number} type ringtone Type to Play.
+    * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
     * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
     */
-    playRingtoneAsync(level: number, type: number): Promise<void>  {
+    playRingtoneAsync(level: number, type: number, options?: CallOptions): Promise<void>  {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.playRingtoneAsync.name, "called with", this.deviceID, level, type);
-        return util.promisify(sdkIntegration.PlayRingTone)(this.deviceID,level,type).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.PlayRingTone(this.deviceID,level,type, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.playRingtoneAsync.name, "returned");
         });
     }
 
     /**
     * Checks if equalizer is supported by the device.
+    * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
     * @returns {Promise<boolean, JabraError>} - Resolve True if equalizer is supported, false if device does not support
     * equalizer otherwise Reject with `error`.
     */
-   isEqualizerSupportedAsync(): Promise<boolean>  {
+   isEqualizerSupportedAsync(options?: CallOptions): Promise<boolean>  {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isEqualizerSupportedAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsEqualizerSupported)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsEqualizerSupported(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isEqualizerSupportedAsync.name, "returned with", result);
             return result;
         });
@@ -1137,12 +1515,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     
    /**
    * Checks if equalizer is enabled.
+   * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
    * @returns {Promise<boolean, JabraError>} - Resolve True if equalizer is enabled, false if equalizer is disabled or not
    * supported by the device otherwise Reject with `error`.
    */
-   isEqualizerEnabledAsync(): Promise<boolean>  {
+   isEqualizerEnabledAsync(options?: CallOptions): Promise<boolean>  {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isEqualizerEnabledAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsEqualizerEnabled)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsEqualizerEnabled(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isEqualizerEnabledAsync.name, "returned with", result);
             return result;
         });
@@ -1151,11 +1530,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
    /**
    * Enable/disable equalizer.
    * @param {boolean} enable Enable or disable equalizer.
+   * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
    * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
    */
-   enableEqualizerAsync(enable: boolean): Promise<void> {
+   enableEqualizerAsync(enable: boolean, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.enableEqualizerAsync.name, "called with", this.deviceID, enable); 
-        return util.promisify(sdkIntegration.EnableEqualizer)(this.deviceID, enable).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.EnableEqualizer(this.deviceID, enable, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.enableEqualizerAsync.name, "returned");
         });
    }
@@ -1163,23 +1543,25 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
    /**
    * Get equalizer parameters.
    * @param {number} maxBands Max no of bands to return (default is 5)
+   * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
    * @returns {Promise<Array<EqualizerBand>, JabraError>} - Resolve equalizerBand `object` if successful otherwise Reject with `error`.
    */
-   getEqualizerParametersAsync(maxNBands?: number): Promise<Array<{ max_gain: number, centerFrequency: number, currentGain: number }>> {
+   getEqualizerParametersAsync(maxNBands?: number, options?: CallOptions): Promise<Array<{ max_gain: number, centerFrequency: number, currentGain: number }>> {
         const _maxNBands = maxNBands || 5;
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getEqualizerParametersAsync.name, "called with", this.deviceID, _maxNBands);
-        return util.promisify(sdkIntegration.GetEqualizerParameters)(this.deviceID, _maxNBands);
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetEqualizerParameters(this.deviceID, _maxNBands, nativeOptions));
    }
 
    /**
     * Set equalizer parameters
     * @param {Array<number>} bands Caller-owned array containing the band gains to set in dB
     * (must be within range of +/- max_gain).
+    * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
     * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
    */
-   setEqualizerParametersAsync(bands: Array<number>): Promise<void> {
+   setEqualizerParametersAsync(bands: Array<number>, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setEqualizerParametersAsync.name, "called with", this.deviceID, bands);
-        return util.promisify(sdkIntegration.SetEqualizerParameters)(this.deviceID, bands).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetEqualizerParameters(this.deviceID, bands, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setEqualizerParametersAsync.name, "returned");
         });
    }
@@ -1189,11 +1571,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
      * it is not possible to upgrade nor downgrade the firmware. In this situation
      * the firmware can only be changed to the same version e.g. if you want to
      * change the language.
+     *  @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      *  @returns {Promise<boolean, JabraError>} - Resolve isFirmwareLockEnabled `boolean` if successful otherwise Reject with `error`.
      */
-   isFirmwareLockEnabledAsync(): Promise<boolean> {
+   isFirmwareLockEnabledAsync(options?: CallOptions): Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isFirmwareLockEnabledAsync.name, "called with", this.deviceID); 
-        return util.promisify(sdkIntegration.IsFirmwareLockEnabled)(this.deviceID).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsFirmwareLockEnabled(this.deviceID, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isFirmwareLockEnabledAsync.name, "returned with", result);
             return result;
         });
@@ -1202,11 +1585,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
      /**
      * Enable/disable the firmware lock. if the firmware is locked the device should not be upgraded.
      * @param {boolean} enable - whether to lock the firmware in the device.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
      */
-    enableFirmwareLockAsync(enable: boolean): Promise<void> {
+    enableFirmwareLockAsync(enable: boolean, options?: CallOptions): Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.enableFirmwareLockAsync.name, "called with", this.deviceID, enable); 
-        return util.promisify(sdkIntegration.EnableFirmwareLock)(this.deviceID, enable).then(() => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.EnableFirmwareLock(this.deviceID, enable, nativeOptions)).then(() => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.enableFirmwareLockAsync.name, "returned");
         });
     }
@@ -1221,11 +1605,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
      * @param {enumRemoteMmiInput} input Action to get focus of, acts as a filter/mask for the
      * actions on the RemoteMmiCallback callback
      * @param {enumRemoteMmiPriority} priority Priority of focus.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
     */
-    getRemoteMmiFocusAsync(type: enumRemoteMmiType, input: enumRemoteMmiInput, priority: enumRemoteMmiPriority) : Promise<void> {
+    getRemoteMmiFocusAsync(type: enumRemoteMmiType, input: enumRemoteMmiInput, priority: enumRemoteMmiPriority, options?: CallOptions) : Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getRemoteMmiFocusAsync.name, "called with", this.deviceID);
-        return util.promisify(sdkIntegration.GetRemoteMmiFocus)(this.deviceID, type, input, priority).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetRemoteMmiFocus(this.deviceID, type, input, priority, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getRemoteMmiFocusAsync.name, "returned");
             return result;
         });
@@ -1235,11 +1620,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
      * Releases the focus of the remote MMI specified. Note that focus on
      * all actions are removed.
      * @param {enumRemoteMmiType} type Type of remote MMI to release focus of.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolve `void` if successful otherwise Reject with `error`.
     */    
-    releaseRemoteMmiFocusAsync(type: enumRemoteMmiType) : Promise<void> {
+    releaseRemoteMmiFocusAsync(type: enumRemoteMmiType, options?: CallOptions) : Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.releaseRemoteMmiFocusAsync.name, "called with", this.deviceID);
-        return util.promisify(sdkIntegration.ReleaseRemoteMmiFocus)(this.deviceID, type).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.ReleaseRemoteMmiFocus(this.deviceID, type, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.releaseRemoteMmiFocusAsync.name, "returned");
             return result;
         });
@@ -1248,11 +1634,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Gets the status of the remote MMI focus.
      * @param {enumRemoteMmiType} type Type of remote MMI to get focus status of.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} returns true if in focus, false if not. 
     */    
-    isRemoteMmiInFocusaAsync(type: enumRemoteMmiType) : Promise<boolean> {
+    isRemoteMmiInFocusaAsync(type: enumRemoteMmiType, options?: CallOptions) : Promise<boolean> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isRemoteMmiInFocusaAsync.name, "called with", this.deviceID);
-        return util.promisify(sdkIntegration.IsRemoteMmiInFocus)(this.deviceID, type).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsRemoteMmiInFocus(this.deviceID, type, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isRemoteMmiInFocusaAsync.name, "returned");
             return result;
         });
@@ -1265,11 +1652,12 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
      * returned.
      * @param {enumRemoteMmiType} type type Type of remote MMI to set action of.
      * @param {RemoteMmiActionOutput} outputAction Output LED action to set.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} returns true if in focus, false if not. 
     */    
-    setRemoteMmiActionAsync(type: enumRemoteMmiType, actionOutput: RemoteMmiActionOutput ) : Promise<void> {
+    setRemoteMmiActionAsync(type: enumRemoteMmiType, actionOutput: RemoteMmiActionOutput , options?: CallOptions) : Promise<void> {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setRemoteMmiActionAsync.name, "called with", this.deviceID);
-        return util.promisify(sdkIntegration.SetRemoteMmiAction)(this.deviceID, type, actionOutput).then((result) => {
+        return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetRemoteMmiAction(this.deviceID, type, actionOutput, nativeOptions)).then((result) => {
             _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setRemoteMmiActionAsync.name, "returned");
             return result;
         });
@@ -1277,13 +1665,14 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     
     /**
      * Checks whether remote management is enabled on Newport/Python
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<boolean, JabraError>} - Resolves to true if remote
      *   management is enabled, false if it is not. Rejects to JabraError in
      *   case of errors.
      */
-    isNewportRemoteManagementEnabledAsync() : Promise<boolean> {
+    isNewportRemoteManagementEnabledAsync(options?: CallOptions) : Promise<boolean> {
       _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isNewportRemoteManagementEnabledAsync.name, "called with", this.deviceID);
-      return util.promisify(sdkIntegration.IsNewportRemoteManagementEnabled)(this.deviceID).then((result) => {
+      return _withCallOptions(options, (nativeOptions) => sdkIntegration.IsNewportRemoteManagementEnabled(this.deviceID, nativeOptions)).then((result) => {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.isNewportRemoteManagementEnabledAsync.name, "returned");
         return result;
       });
@@ -1293,12 +1682,13 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
      * Enables/disables remote management on Newport/Python
      * @param {boolean} enable - True to enable remote management, false to
      *   disable it
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolves to `void` on success,
      *   rejects with `JabraError` if an error occurs.
      */
-    enableNewportRemoteManagementAsync(enable: boolean) : Promise<void> {
+    enableNewportRemoteManagementAsync(enable: boolean, options?: CallOptions) : Promise<void> {
       _JabraNativeAddonLog(AddonLogSeverity.verbose, this.enableNewportRemoteManagementAsync.name, "called with", this.deviceID);
-      return util.promisify(sdkIntegration.EnableNewportRemoteManagement)(this.deviceID, enable).then(() => {
+      return _withCallOptions(options, (nativeOptions) => sdkIntegration.EnableNewportRemoteManagement(this.deviceID, enable, nativeOptions)).then(() => {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.enableNewportRemoteManagementAsync.name, "returned");
       });
     }
@@ -1306,24 +1696,26 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Sets the Jabra Xpress url on Newport/Python
      * @param {string} url - The new Jabra Xpress URL
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolves to `void` on success,
      *   rejects with `JabraError` if an error occurs.
      */
-    setXpressUrlAsync(url: string) : Promise<void> {
+    setXpressUrlAsync(url: string, options?: CallOptions) : Promise<void> {
       _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setXpressUrlAsync.name, "called with", this.deviceID);
-      return util.promisify(sdkIntegration.SetXpressUrl)(this.deviceID, url).then(() => {
+      return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetXpressUrl(this.deviceID, url, nativeOptions)).then(() => {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setXpressUrlAsync.name, "returned");
       });
     }
 
     /**
      * Returns the Jabra Xpress url on Newport/Python
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<string, JabraError>} - Resolves to the Xpress url on success,
      *   rejects with `JabraError` if an error occurs.
      */
-    getXpressUrlAsync() : Promise<string> {
+    getXpressUrlAsync(options?: CallOptions) : Promise<string> {
       _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getXpressUrlAsync.name, "called with", this.deviceID);
-      return util.promisify(sdkIntegration.GetXpressUrl)(this.deviceID).then((result) => {
+      return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetXpressUrl(this.deviceID, nativeOptions)).then((result) => {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setXpressUrlAsync.name, "returned");
         return result;
       });
@@ -1332,13 +1724,14 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Returns the position of the provided whiteboard corners as coordinates.
      * @param {number} whiteboardId - The whiteboard id number.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<number, JabraError>} - Resolves to the whiteboard
      *    corners position on success, rejects with `JabraError` if an error
      *    occurs.
      */
-    getWhiteboardPositionAsync(whiteboardId: number) : Promise<WhiteboardPosition> {
+    getWhiteboardPositionAsync(whiteboardId: number, options?: CallOptions) : Promise<WhiteboardPosition> {
       _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getWhiteboardPositionAsync.name, "called with", this.deviceID);
-      return util.promisify(sdkIntegration.GetWhiteboardPosition)(this.deviceID, whiteboardId).then((result) => {
+      return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetWhiteboardPosition(this.deviceID, whiteboardId, nativeOptions)).then((result) => {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getWhiteboardPositionAsync.name, "returned");
         return result;
       });
@@ -1348,24 +1741,26 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
      * Sets the position of the provided whiteboard corners.
      * @param {number} whiteboardId - The whiteboard id number.
      * @param {WhiteboardPosition} whiteboardPosition - The whiteboard corners.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<number, JabraError>} - Resolves to `void` on success,
      *    rejects with `JabraError` on error.
      */
-    setWhiteboardPositionAsync(whiteboardId: number, whiteboardPosition: WhiteboardPosition) : Promise<void> {
+    setWhiteboardPositionAsync(whiteboardId: number, whiteboardPosition: WhiteboardPosition, options?: CallOptions) : Promise<void> {
       _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setWhiteboardPositionAsync.name, "called with", this.deviceID);
-      return util.promisify(sdkIntegration.SetWhiteboardPosition)(this.deviceID, whiteboardId, whiteboardPosition).then(() => {
+      return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetWhiteboardPosition(this.deviceID, whiteboardId, whiteboardPosition, nativeOptions)).then(() => {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setWhiteboardPositionAsync.name, "returned");
       });
     }
 
     /**
      * Returns the current zoom value from the device's camera.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<number, JabraError>} - Resolves to the current zoom
      *    value on success, else rejects with `JabraError`
      */
-    getZoomAsync() : Promise<number> {
+    getZoomAsync(options?: CallOptions) : Promise<number> {
       _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getZoomAsync.name, "called with", this.deviceID);
-      return util.promisify(sdkIntegration.GetZoom)(this.deviceID).then((result) => {
+      return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetZoom(this.deviceID, nativeOptions)).then((result) => {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getZoomAsync.name, "returned");
         return result;
       });
@@ -1374,29 +1769,60 @@ export class DeviceType implements DeviceInfo, DeviceTiming, MetaApi {
     /**
      * Controls the device's camera zoom functionality.
      * @param {number} - The new value for the device camera's zoom.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<void, JabraError>} - Resolves to `void` on success,
      *    rejects with `JabraError` on error.
      */
-    setZoomAsync(zoom: number) : Promise<void> {
+    setZoomAsync(zoom: number, options?: CallOptions) : Promise<void> {
       _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setZoomAsync.name, "called with", this.deviceID);
-      return util.promisify(sdkIntegration.SetZoom)(this.deviceID, zoom).then(() => {
+      return _withCallOptions(options, (nativeOptions) => sdkIntegration.SetZoom(this.deviceID, zoom, nativeOptions)).then(() => {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.setZoomAsync.name, "returned");
       });
     }
 
     /**
      * Returns the zoom limit values from the device's camera.
+     * @param {CallOptions} [options] - Optional timeout and cancellation signal for the call.
      * @returns {Promise<ZoomLimits, JabraError>} - Resolves to the current
      *    zoom limit values on success, else rejects with `JabraError`
      */
-    getZoomLimitsAsync() : Promise<ZoomLimits> {
+    getZoomLimitsAsync(options?: CallOptions) : Promise<ZoomLimits> {
       _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getZoomLimitsAsync.name, "called with", this.deviceID);
-      return util.promisify(sdkIntegration.GetZoomLimits)(this.deviceID).then((result) => {
+      return _withCallOptions(options, (nativeOptions) => sdkIntegration.GetZoomLimits(this.deviceID, nativeOptions)).then((result) => {
         _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getZoomLimitsAsync.name, "returned");
         return result;
       });
     }
 
+    /**
+     * Get recent events of the device kept natively (see the eventHistoryCapacity native config parameter),
+     * so a late subscriber (f.x. a reloaded renderer) can catch up without polling the device state. Nb. events
+     * that happened while adding listeners may be both replayed and delivered to the listeners.
+     * @param {number} [sinceSequenceNumber] - Only get events after this (lastSequenceNumber of an earlier call), or all if omitted.
+     * @returns {Promise<DeviceEventHistory, JabraError>} - Resolve `DeviceEventHistory` if successful otherwise Reject with `error`.
+     */
+    getEventHistoryAsync(sinceSequenceNumber: number = 0): Promise<DeviceEventHistory> {
+      _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getEventHistoryAsync.name, "called with", this.deviceID, sinceSequenceNumber);
+      try {
+        const history = sdkIntegration.GetDeviceEventHistory(this.deviceID, sinceSequenceNumber);
+        const result: DeviceEventHistory = {
+          lastSequenceNumber: history.lastSequenceNumber,
+          events: []
+        };
+        for (const [sequenceNumber, time_ms, type, deviceId, ...args] of history.events) {
+          const event = (Object.keys(nativeEventOf) as DeviceTypeEvents[]).find((e) => nativeEventOf[e] === type);
+          if (event) {
+            // As emitted to listeners (see JabraType):
+            result.events.push({ sequenceNumber, time_ms, event, args: event === 'onGNPBtnEvent' ? [this._resolveGnpButtonEvents(args[0], args[1])] : args });
+          }
+        }
+        _JabraNativeAddonLog(AddonLogSeverity.verbose, this.getEventHistoryAsync.name, "returned with", result.events.length, "events");
+        return Promise.resolve(result);
+      } catch (err) {
+        return Promise.reject(err);
+      }
+    }
+
    /**
    * Get meta information about methods, properties etc. that can be used 
    * for reflective usage of this class.
@@ -0,0 +1,405 @@
+#include "devlog.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * Minimal json parser for dev log events. Values of top-level members not in the projection (if any) are skipped
+ * without being stored.
+ */
+class DevLogJsonParser {
+  public:
+    DevLogJsonParser(const char * json, const std::unordered_set<std::string>& fields) : pos(json), fields(fields) {}
+
+    bool parseEvent(DevLogValue& result) {
+      skipWhitespace();
+      if (*pos != '{' || !parseObject(&result, 0)) {
+        return false;
+      }
+      skipWhitespace();
+      return *pos == '\0';
+    }
+
+  private:
+    // Dev log events are flat - this just bounds the recursion for malformed input.
+    static const int MAX_DEPTH = 32;
+
+    const char * pos;
+    const std::unordered_set<std::string>& fields;
+
+    void skipWhitespace() {
+      while (*pos == ' ' || *pos == '\t' || *pos == '\n' || *pos == '\r') {
+        ++pos;
+      }
+    }
+
+    bool consume(const char * literal) {
+      const size_t length = strlen(literal);
+      if (strncmp(pos, literal, length) != 0) {
+        return false;
+      }
+      pos += length;
+      return true;
+    }
+
+    static void appendUtf8(std::string& out, uint32_t codePoint) {
+      if (codePoint < 0x80) {
+        out += (char)codePoint;
+      } else if (codePoint < 0x800) {
+        out += (char)(0xC0 | (codePoint >> 6));
+        out += (char)(0x80 | (codePoint & 0x3F));
+      } else if (codePoint < 0x10000) {
+        out += (char)(0xE0 | (codePoint >> 12));
+        out += (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        out += (char)(0x80 | (codePoint & 0x3F));
+      } else {
+        out += (char)(0xF0 | (codePoint >> 18));
+        out += (char)(0x80 | ((codePoint >> 12) & 0x3F));
+        out += (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        out += (char)(0x80 | (codePoint & 0x3F));
+      }
+    }
+
+    bool parseHex4(uint32_t& value) {
+      value = 0;
+      for (int i = 0; i < 4; ++i) {
+        const char c = *pos++;
+        value <<= 4;
+        if (c >= '0' && c <= '9') {
+          value |= (uint32_t)(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+          value |= (uint32_t)(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+          value |= (uint32_t)(c - 'A' + 10);
+        } else {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    bool parseString(std::string * out) {
+      ++pos; // Opening quote.
+      while (*pos != '"') {
+        const char c = *pos++;
+        if (c == '\0') {
+          return false;
+        } else if (c != '\\') {
+          if (out) {
+            *out += c;
+          }
+          continue;
+        }
+
+        const char escaped = *pos++;
+        uint32_t codePoint;
+        switch (escaped) {
+          case '"': codePoint = '"'; break;
+          case '\\': codePoint = '\\'; break;
+          case '/': codePoint = '/'; break;
+          case 'b': codePoint = '\b'; break;
+          case 'f': codePoint = '\f'; break;
+          case 'n': codePoint = '\n'; break;
+          case 'r': codePoint = '\r'; break;
+          case 't': codePoint = '\t'; break;
+          case 'u':
+            if (!parseHex4(codePoint)) {
+              return false;
+            }
+            if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+              uint32_t low;
+              if (!consume("\\u") || !parseHex4(low) || low < 0xDC00 || low > 0xDFFF) {
+                return false;
+              }
+              codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+            }
+            break;
+          default:
+            return false;
+        }
+        if (out) {
+          appendUtf8(*out, codePoint);
+        }
+      }
+      ++pos; // Closing quote.
+      return true;
+    }
+
+    bool parseNumber(DevLogValue * out) {
+      char * end = nullptr;
+      const double number = strtod(pos, &end);
+      if (end == pos) {
+        return false;
+      }
+      pos = end;
+      if (out) {
+        out->kind = DevLogValue::Kind::NUMBER;
+        out->number = number;
+      }
+      return true;
+    }
+
+    bool parseObject(DevLogValue * out, int depth) {
+      ++pos; // {
+      if (out) {
+        out->kind = DevLogValue::Kind::OBJECT;
+      }
+      skipWhitespace();
+      if (*pos == '}') {
+        ++pos;
+        return true;
+      }
+
+      std::string key;
+      for (;;) {
+        skipWhitespace();
+        key.clear();
+        if (*pos != '"' || !parseString(&key)) {
+          return false;
+        }
+        skipWhitespace();
+        if (*pos++ != ':') {
+          return false;
+        }
+
+        // Only the top-level fields of the event are projected:
+        const bool keep = out && (depth > 0 || fields.empty() || fields.count(key) > 0);
+        if (keep) {
+          out->members.emplace_back(key, DevLogValue());
+        }
+        if (!parseValue(keep ? &out->members.back().second : nullptr, depth + 1)) {
+          return false;
+        }
+
+        skipWhitespace();
+        const char c = *pos++;
+        if (c == '}') {
+          return true;
+        } else if (c != ',') {
+          return false;
+        }
+      }
+    }
+
+    bool parseArray(DevLogValue * out, int depth) {
+      ++pos; // [
+      if (out) {
+        out->kind = DevLogValue::Kind::ARRAY;
+      }
+      skipWhitespace();
+      if (*pos == ']') {
+        ++pos;
+        return true;
+      }
+
+      for (;;) {
+        if (out) {
+          out->items.emplace_back();
+        }
+        if (!parseValue(out ? &out->items.back() : nullptr, depth + 1)) {
+          return false;
+        }
+
+        skipWhitespace();
+        const char c = *pos++;
+        if (c == ']') {
+          return true;
+        } else if (c != ',') {
+          return false;
+        }
+      }
+    }
+
+    bool parseValue(DevLogValue * out, int depth) {
+      if (depth > MAX_DEPTH) {
+        return false;
+      }
+
+      skipWhitespace();
+      switch (*pos) {
+        case '{':
+          return parseObject(out, depth);
+        case '[':
+          return parseArray(out, depth);
+        case '"':
+          if (out) {
+            out->kind = DevLogValue::Kind::STRING;
+          }
+          return parseString(out ? &out->text : nullptr);
+        case 't':
+        case 'f': {
+          const bool value = *pos == 't';
+          if (!consume(value ? "true" : "false")) {
+            return false;
+          }
+          if (out) {
+            out->kind = DevLogValue::Kind::BOOLEAN;
+            out->boolean = value;
+          }
+          return true;
+        }
+        case 'n':
+          return consume("null");
+        default:
+          return parseNumber(out);
+      }
+    }
+};
+
+Napi::Value DevLogValue::toNapi(const Napi::Env& env) const {
+  switch (kind) {
+    case Kind::BOOLEAN:
+      return Napi::Boolean::New(env, boolean);
+    case Kind::NUMBER:
+      return Napi::Number::New(env, number);
+    case Kind::STRING:
+      return Napi::String::New(env, text);
+    case Kind::ARRAY: {
+      Napi::Array array = Napi::Array::New(env, items.size());
+      for (size_t i = 0; i < items.size(); ++i) {
+        array.Set((uint32_t)i, items[i].toNapi(env));
+      }
+      return array;
+    }
+    case Kind::OBJECT: {
+      // Define all properties in a single call (as ObjectBuilder, but the keys are not known in advance).
+      std::vector<napi_property_descriptor> properties;
+      properties.reserve(members.size());
+      for (const auto& member : members) {
+        napi_property_descriptor property = {};
+        property.utf8name = member.first.c_str();
+        property.value = member.second.toNapi(env);
+        property.attributes = static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable);
+        properties.push_back(property);
+      }
+
+      Napi::Object object = Napi::Object::New(env);
+      const napi_status status = napi_define_properties(env, object, properties.size(), properties.data());
+      if (status != napi_ok) {
+        throw Napi::Error::New(env);
+      }
+      return object;
+    }
+    default:
+      return env.Null();
+  }
+}
+
+DevLogDecoder& DevLogDecoder::instance() {
+  static DevLogDecoder decoder;
+  return decoder;
+}
+
+DevLogDecoder::DevLogDecoder() : fields(), filePath(), fileMaxSizeBytes(DEFAULT_FILE_MAX_SIZE_BYTES),
+  fileCount(DEFAULT_FILE_COUNT), fileMutex(), file(), fileSize(0), decodedCount(0), decodeErrorCount(0),
+  fileWriteCount(0), fileByteCount(0), fileRotationCount(0), fileErrorCount(0) {
+}
+
+void DevLogDecoder::configure(Napi::Object& config) {
+  fields.clear();
+  if (config.Has("devLogFields") && config.Get("devLogFields").IsArray()) {
+    Napi::Array devLogFields = config.Get("devLogFields").As<Napi::Array>();
+    for (uint32_t i = 0; i < devLogFields.Length(); ++i) {
+      fields.insert(devLogFields.Get(i).ToString().Utf8Value());
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(fileMutex);
+  filePath = util::getObjStringOrDefault(config, "devLogFile", "");
+  const int32_t maxSizeBytes = util::getObjInt32OrDefault(config, "devLogFileMaxSizeBytes", DEFAULT_FILE_MAX_SIZE_BYTES);
+  fileMaxSizeBytes = maxSizeBytes > 0 ? (uint64_t)maxSizeBytes : DEFAULT_FILE_MAX_SIZE_BYTES;
+  const int32_t count = util::getObjInt32OrDefault(config, "devLogFileCount", DEFAULT_FILE_COUNT);
+  fileCount = count >= 0 ? count : DEFAULT_FILE_COUNT;
+}
+
+bool DevLogDecoder::decode(const char * json, DevLogValue& result) {
+  DevLogJsonParser parser(json, fields);
+  if (!parser.parseEvent(result)) {
+    if (decodeErrorCount++ == 0) {
+      LOG_WARNING_(LOGINSTANCE) << "DevLogDecoder: dropping dev log event that is not a json object: " << json << " (further errors are only counted).";
+    }
+    return false;
+  }
+  ++decodedCount;
+  return true;
+}
+
+bool DevLogDecoder::openFile() {
+  file.open(filePath, std::ios::out | std::ios::app | std::ios::binary);
+  if (!file.is_open()) {
+    if (fileErrorCount++ == 0) {
+      LOG_ERROR_(LOGINSTANCE) << "DevLogDecoder: could not open dev log file " << filePath << " (further errors are only counted).";
+    }
+    return false;
+  }
+  file.seekp(0, std::ios::end);
+  fileSize = (uint64_t)file.tellp();
+  return true;
+}
+
+void DevLogDecoder::rotateFile() {
+  file.close();
+  if (fileCount > 0) {
+    std::remove((filePath + "." + std::to_string(fileCount)).c_str());
+    for (int32_t i = fileCount - 1; i >= 1; --i) {
+      std::rename((filePath + "." + std::to_string(i)).c_str(), (filePath + "." + std::to_string(i + 1)).c_str());
+    }
+    std::rename(filePath.c_str(), (filePath + ".1").c_str());
+  } else {
+    std::remove(filePath.c_str());
+  }
+  ++fileRotationCount;
+}
+
+void DevLogDecoder::write(const char * json) {
+  std::lock_guard<std::mutex> lock(fileMutex);
+  if (filePath.empty()) {
+    return;
+  }
+
+  // One event per line - the sdk may pretty print events:
+  std::string line(json);
+  for (char& c : line) {
+    if (c == '\n' || c == '\r') {
+      c = ' ';
+    }
+  }
+  line += '\n';
+
+  if (file.is_open() && fileSize > 0 && fileSize + line.size() > fileMaxSizeBytes) {
+    rotateFile();
+  }
+  if (!file.is_open() && !openFile()) {
+    return;
+  }
+
+  file.write(line.data(), line.size());
+  if (!file) {
+    ++fileErrorCount;
+    file.close(); // Retried with the next event.
+    return;
+  }
+  fileSize += line.size();
+  ++fileWriteCount;
+  fileByteCount += line.size();
+}
+
+void DevLogDecoder::close() {
+  std::lock_guard<std::mutex> lock(fileMutex);
+  if (file.is_open()) {
+    file.close();
+  }
+  filePath.clear();
+}
+
+DevLogStats DevLogDecoder::getStats() const {
+  DevLogStats stats;
+  stats.decoded = decodedCount;
+  stats.decodeErrors = decodeErrorCount;
+  stats.fileWrites = fileWriteCount;
+  stats.fileBytes = fileByteCount;
+  stats.fileRotations = fileRotationCount;
+  stats.fileErrors = fileErrorCount;
+  return stats;
+}
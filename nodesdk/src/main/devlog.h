@@ -0,0 +1,108 @@
+#pragma once
+
+#include "stdafx.h"
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * A decoded json value of a dev log event.
+ */
+struct DevLogValue {
+  enum class Kind { NULL_VALUE, BOOLEAN, NUMBER, STRING, OBJECT, ARRAY };
+
+  Kind kind;
+  bool boolean;
+  double number;
+  std::string text; // STRING only.
+  std::vector<std::pair<std::string, DevLogValue>> members; // OBJECT only, in json order.
+  std::vector<DevLogValue> items; // ARRAY only.
+
+  DevLogValue() : kind(Kind::NULL_VALUE), boolean(false), number(0) {}
+
+  /**
+   * Convert to the same javascript value as JSON.parse would. Main thread only.
+   */
+  Napi::Value toNapi(const Napi::Env& env) const;
+};
+
+/**
+ * Snapshot of dev log counters (for diagnostics only).
+ */
+struct DevLogStats {
+  uint64_t decoded;
+  uint64_t decodeErrors;
+  uint64_t fileWrites;
+  uint64_t fileBytes;
+  uint64_t fileRotations;
+  uint64_t fileErrors;
+};
+
+/**
+ * Handles the dev log events of all devices on the sdk callback thread, so javascript never gets (or parses) the raw
+ * json strings:
+ *
+ * Events are decoded natively into a DevLogValue object, optionally keeping only the configured top-level fields, and
+ * converted straight to a javascript object on delivery. Optionally, the raw events are also appended as json lines
+ * to a size-bounded log file that is rotated (file -> file.1 -> file.2 ...) when full - independently of javascript
+ * listeners.
+ */
+class DevLogDecoder {
+  public:
+    static const int32_t DEFAULT_FILE_MAX_SIZE_BYTES = 10 * 1024 * 1024;
+    static const int32_t DEFAULT_FILE_COUNT = 3;
+
+    static DevLogDecoder& instance();
+
+    /**
+     * Set fields and log file from the devLogFields, devLogFile, devLogFileMaxSizeBytes and devLogFileCount config
+     * parameters. Must be called before events are handled.
+     */
+    void configure(Napi::Object& config);
+
+    /**
+     * Decode a dev log event into an object with the configured fields. Returns false (and logs) if the event is not
+     * a json object. Can be called from any thread.
+     */
+    bool decode(const char * json, DevLogValue& result);
+
+    /**
+     * Append a raw dev log event to the log file, if configured. Can be called from any thread.
+     */
+    void write(const char * json);
+
+    /**
+     * Close the log file (on uninitialize).
+     */
+    void close();
+
+    DevLogStats getStats() const;
+
+  private:
+    DevLogDecoder();
+    DevLogDecoder(const DevLogDecoder&) = delete;
+    DevLogDecoder& operator=(const DevLogDecoder&) = delete;
+
+    // Only written by configure:
+    std::unordered_set<std::string> fields; // Empty = all fields.
+    std::string filePath; // Empty = no log file.
+    uint64_t fileMaxSizeBytes;
+    int32_t fileCount;
+
+    bool openFile();
+    void rotateFile();
+
+    std::mutex fileMutex;
+    std::ofstream file;
+    uint64_t fileSize;
+
+    std::atomic<uint64_t> decodedCount;
+    std::atomic<uint64_t> decodeErrorCount;
+    std::atomic<uint64_t> fileWriteCount;
+    std::atomic<uint64_t> fileByteCount;
+    std::atomic<uint64_t> fileRotationCount;
+    std::atomic<uint64_t> fileErrorCount;
+};
@@ -1,7 +1,7 @@
 #include "enablers.h"
 
 Napi::Value napi_IsDevLogEnabled(const Napi::CallbackInfo& info) {   
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, info, [](unsigned short deviceId) {
+  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, util::AsyncOptions::ReadOnly(), info, [](unsigned short deviceId) {
     const bool result = Jabra_IsDevLogEnabled(deviceId);
     return result;
   }, [](const Napi::Env& env, bool cppResult) { return Napi::Boolean::New(env, cppResult); });
@@ -0,0 +1,478 @@
+#include "eventchannel.h"
+
+#include <cstring>
+
+std::atomic<uint64_t> EventChannel::postedCount(0);
+std::atomic<uint64_t> EventChannel::deliveredCount(0);
+std::atomic<uint64_t> EventChannel::batchCount(0);
+std::atomic<uint64_t> EventChannel::maxBatchSize(0);
+std::atomic<uint64_t> EventChannel::coalescedCount(0);
+std::atomic<uint64_t> EventChannel::binaryRecordCount(0);
+std::atomic<uint64_t> EventChannel::droppedCount[NATIVE_EVENT_TYPE_COUNT];
+EventChannel::LatencyHistograms EventChannel::latencies[NATIVE_EVENT_TYPE_COUNT];
+
+static thread_local uint64_t sdkCallbackEntryTimeNs = 0;
+
+SdkCallbackScope::SdkCallbackScope() : outerEntryTimeNs(sdkCallbackEntryTimeNs) {
+  sdkCallbackEntryTimeNs = util::monotonicTimeNs();
+}
+
+SdkCallbackScope::SdkCallbackScope(uint64_t entryTimeNs) : outerEntryTimeNs(sdkCallbackEntryTimeNs) {
+  sdkCallbackEntryTimeNs = entryTimeNs;
+}
+
+SdkCallbackScope::~SdkCallbackScope() {
+  sdkCallbackEntryTimeNs = outerEntryTimeNs;
+}
+
+uint64_t SdkCallbackScope::getEntryTimeNs() {
+  return sdkCallbackEntryTimeNs;
+}
+
+const char * toString(NativeEventType type) {
+  switch (type) {
+    case NativeEventType::INITIALIZED: return "initialized";
+    case NativeEventType::FIRST_SCAN_DONE: return "firstScanDone";
+    case NativeEventType::ATTACHED: return "attached";
+    case NativeEventType::DETACHED: return "detached";
+    case NativeEventType::BUTTON_IN_DATA_TRANSLATED: return "buttonInDataTranslated";
+    case NativeEventType::DEV_LOG: return "devLog";
+    case NativeEventType::BATTERY_STATUS: return "batteryStatus";
+    case NativeEventType::REMOTE_MMI: return "remoteMmi";
+    case NativeEventType::FIRMWARE_PROGRESS: return "firmwareProgress";
+    case NativeEventType::UPLOAD_PROGRESS: return "uploadProgress";
+    case NativeEventType::PAIRING_LIST: return "pairingList";
+    case NativeEventType::GNP_BUTTON: return "gnpButton";
+    case NativeEventType::DECT_INFO: return "dectInfo";
+    default: return "???";
+  }
+}
+
+NativeEventOverflowPolicy overflowPolicy(NativeEventType type) {
+  switch (type) {
+    // Periodic status - a newer event makes older ones obsolete:
+    case NativeEventType::BATTERY_STATUS:
+    case NativeEventType::FIRMWARE_PROGRESS:
+    case NativeEventType::UPLOAD_PROGRESS:
+    case NativeEventType::DECT_INFO:
+      return NativeEventOverflowPolicy::DROP_OLDEST;
+    // Lifecycle, button and log events are only meaningful in order:
+    default:
+      return NativeEventOverflowPolicy::DROP_NEWEST;
+  }
+}
+
+static NativeEventRecord newRecord(NativeEventType type, uint16_t deviceId) {
+  NativeEventRecord record = {};
+  record.type = type;
+  record.deviceId = deviceId;
+  return record;
+}
+
+NativeEventRecord NativeEventRecord::detached(uint16_t deviceId, uint64_t eventTime) {
+  NativeEventRecord record = newRecord(NativeEventType::DETACHED, deviceId);
+  record.time = (double)eventTime;
+  return record;
+}
+
+NativeEventRecord NativeEventRecord::buttonInDataTranslated(uint16_t deviceId, int translatedInData, bool buttonInData) {
+  NativeEventRecord record = newRecord(NativeEventType::BUTTON_IN_DATA_TRANSLATED, deviceId);
+  record.values[0] = translatedInData;
+  record.flags = buttonInData ? FLAG_0 : 0;
+  return record;
+}
+
+NativeEventRecord NativeEventRecord::batteryStatus(uint16_t deviceId, int levelInPercent, bool charging, bool batteryLow) {
+  NativeEventRecord record = newRecord(NativeEventType::BATTERY_STATUS, deviceId);
+  record.values[0] = levelInPercent;
+  record.flags = (charging ? FLAG_0 : 0) | (batteryLow ? FLAG_1 : 0);
+  return record;
+}
+
+NativeEventRecord NativeEventRecord::remoteMmi(uint16_t deviceId, int type, int input) {
+  NativeEventRecord record = newRecord(NativeEventType::REMOTE_MMI, deviceId);
+  record.values[0] = type;
+  record.values[1] = input;
+  return record;
+}
+
+NativeEventRecord NativeEventRecord::firmwareProgress(uint16_t deviceId, int type, int status, int percentage) {
+  NativeEventRecord record = newRecord(NativeEventType::FIRMWARE_PROGRESS, deviceId);
+  record.values[0] = type;
+  record.values[1] = status;
+  record.values[2] = percentage;
+  return record;
+}
+
+NativeEventRecord NativeEventRecord::uploadProgress(uint16_t deviceId, int status, int percentage) {
+  NativeEventRecord record = newRecord(NativeEventType::UPLOAD_PROGRESS, deviceId);
+  record.values[0] = status;
+  record.values[1] = percentage;
+  return record;
+}
+
+EventChannel::EventChannel(const Napi::Function& _dispatcher, size_t capacity, bool binaryEvents)
+  : receiver(Napi::Persistent(Napi::Object::New(_dispatcher.Env()))), dispatcher(Napi::Persistent(_dispatcher)),
+    handle(), ring(capacity), latestValues(new LatestValueSlot[LATEST_VALUE_SLOT_COUNT]), batch(), recordBuffer(),
+    closed(false) {
+  for (size_t i = 0; i < LATEST_VALUE_SLOT_COUNT; ++i) {
+    latestValues[i].key.store(0, std::memory_order_relaxed);
+    latestValues[i].value.store(nullptr, std::memory_order_relaxed);
+  }
+  batch.reserve(ring.getCapacity());
+  if (binaryEvents) {
+    // A batch never holds more than a ring full of events, so the buffer never needs to grow.
+    recordBuffer = Napi::Persistent(Napi::ArrayBuffer::New(_dispatcher.Env(), ring.getCapacity() * RECORD_SIZE));
+  }
+  uv_async_init(uv_default_loop(), &handle, &EventChannel::onAsync);
+  handle.data = this;
+}
+
+EventChannel::~EventChannel() {
+  for (size_t i = 0; i < LATEST_VALUE_SLOT_COUNT; ++i) {
+    delete latestValues[i].value.exchange(nullptr);
+  }
+}
+
+void EventChannel::post(NativeEventType type, arg_func_t argFunction) {
+  PendingEvent event = { type, std::move(argFunction), NativeEventRecord(), nullptr, 0, 0 };
+  postEvent(event);
+}
+
+void EventChannel::post(const NativeEventRecord& record) {
+  PendingEvent event = { record.type, arg_func_t(), record, nullptr, 0, 0 };
+  postEvent(event);
+}
+
+void EventChannel::postLatest(NativeEventType type, unsigned short deviceId, unsigned int subKind, arg_func_t argFunction) {
+  PendingEvent event = { type, std::move(argFunction), NativeEventRecord(), nullptr, 0, 0 };
+  postLatestEvent(event, deviceId, subKind);
+}
+
+void EventChannel::postLatest(const NativeEventRecord& record, unsigned int subKind) {
+  PendingEvent event = { record.type, arg_func_t(), record, nullptr, 0, 0 };
+  postLatestEvent(event, record.deviceId, subKind);
+}
+
+void EventChannel::postEvent(PendingEvent& event) {
+  if (closed.load(std::memory_order_acquire)) {
+    LOG_VERBOSE_(LOGINSTANCE) << "EventChannel: dropped " << toString(event.type) << " event posted after close";
+    return;
+  }
+
+  ++postedCount;
+  timestamp(event);
+  enqueue(event);
+  uv_async_send(&handle);
+}
+
+void EventChannel::postLatestEvent(PendingEvent& event, unsigned short deviceId, unsigned int subKind) {
+  if (closed.load(std::memory_order_acquire)) {
+    LOG_VERBOSE_(LOGINSTANCE) << "EventChannel: dropped " << toString(event.type) << " event posted after close";
+    return;
+  }
+
+  const uint64_t key = (1ull << 63) | ((uint64_t)event.type << 48) | ((uint64_t)deviceId << 32) | subKind;
+  LatestValueSlot * const slot = findLatestValueSlot(key);
+  if (slot == nullptr) {
+    postEvent(event);
+    return;
+  }
+
+  const NativeEventType type = event.type;
+  ++postedCount;
+  timestamp(event);
+  PendingEvent * const latest = new PendingEvent(std::move(event));
+  PendingEvent * const replaced = slot->value.exchange(latest, std::memory_order_acq_rel);
+  if (replaced != nullptr) {
+    // Still undelivered, so its marker is already queued.
+    delete replaced;
+    ++coalescedCount;
+    return;
+  }
+
+  PendingEvent marker = { type, arg_func_t(), NativeEventRecord(), slot, 0, 0 };
+  enqueue(marker);
+  uv_async_send(&handle);
+}
+
+void EventChannel::timestamp(PendingEvent& event) {
+  const uint64_t callbackNs = SdkCallbackScope::getEntryTimeNs();
+  event.enqueuedNs = util::monotonicTimeNs();
+  event.callbackNs = callbackNs != 0 ? callbackNs : event.enqueuedNs;
+
+  const size_t index = static_cast<size_t>(event.type);
+  if (callbackNs != 0 && index < NATIVE_EVENT_TYPE_COUNT) {
+    latencies[index].sdk.add(callbackNs, event.enqueuedNs);
+  }
+}
+
+EventChannel::LatestValueSlot * EventChannel::findLatestValueSlot(uint64_t key) {
+  // Open addressing with linear probing - slots are claimed with a CAS on the key and never released.
+  const size_t start = (size_t)((key * 0x9E3779B97F4A7C15ull) >> 32) % LATEST_VALUE_SLOT_COUNT;
+  for (size_t i = 0; i < LATEST_VALUE_SLOT_COUNT; ++i) {
+    LatestValueSlot& slot = latestValues[(start + i) % LATEST_VALUE_SLOT_COUNT];
+    uint64_t slotKey = slot.key.load(std::memory_order_acquire);
+    if (slotKey == 0 && slot.key.compare_exchange_strong(slotKey, key, std::memory_order_acq_rel)) {
+      return &slot;
+    }
+    if (slotKey == key) {
+      return &slot;
+    }
+  }
+  return nullptr;
+}
+
+bool EventChannel::enqueue(PendingEvent& event) {
+  // Only DROP_OLDEST events are evicted for newer DROP_OLDEST events - if the oldest queued event is of another
+  // policy, the new event is dropped instead.
+  bool queued;
+  if (overflowPolicy(event.type) == NativeEventOverflowPolicy::DROP_OLDEST) {
+    queued = ring.pushOrEvict(event, MAX_EVICTION_ATTEMPTS, [this](PendingEvent& oldest) {
+      if (oldest.latest != nullptr) {
+        // Without its marker, the coalesced value would never be delivered.
+        delete oldest.latest->value.exchange(nullptr, std::memory_order_acq_rel);
+      }
+      countDropped(oldest.type);
+    });
+  } else {
+    queued = ring.push(event);
+  }
+
+  if (!queued) {
+    if (event.latest != nullptr) {
+      delete event.latest->value.exchange(nullptr, std::memory_order_acq_rel);
+    }
+    countDropped(event.type);
+  }
+  return queued;
+}
+
+void EventChannel::close() {
+  closed.store(true, std::memory_order_release);
+  uv_async_send(&handle);
+}
+
+void EventChannel::countDropped(NativeEventType type) {
+  const size_t index = static_cast<size_t>(type);
+  if (index < NATIVE_EVENT_TYPE_COUNT && droppedCount[index]++ == 0) {
+    LOG_WARNING_(LOGINSTANCE) << "EventChannel: event queue full - dropping " << toString(type) << " events (further drops are only counted).";
+  }
+}
+
+EventChannelStats EventChannel::getStats() {
+  EventChannelStats stats;
+  stats.posted = postedCount;
+  stats.delivered = deliveredCount;
+  stats.batches = batchCount;
+  stats.maxBatchSize = maxBatchSize;
+  stats.coalesced = coalescedCount;
+  stats.binaryRecords = binaryRecordCount;
+  for (size_t i = 0; i < NATIVE_EVENT_TYPE_COUNT; ++i) {
+    stats.dropped[i] = droppedCount[i];
+    stats.latency[i].sdk = latencies[i].sdk.getSnapshot();
+    stats.latency[i].queue = latencies[i].queue.getSnapshot();
+    stats.latency[i].total = latencies[i].total.getSnapshot();
+  }
+  return stats;
+}
+
+void EventChannel::onAsync(uv_async_t * handle) {
+  try {
+    static_cast<EventChannel *>(handle->data)->drain();
+  } catch (const std::exception &e) {
+    LOG_ERROR_(LOGINSTANCE) << "EventChannel: event delivery failed: " << e.what();
+  } catch (...) {
+    LOG_ERROR_(LOGINSTANCE) << "EventChannel: event delivery failed with unknown exception";
+  }
+}
+
+void EventChannel::drain() {
+  // Deliver what is queued now as one batch - at most one ring full, so a storm of events can not keep the main
+  // thread here. Events posted meanwhile trigger a new wakeup.
+  const bool closing = closed.load(std::memory_order_acquire);
+  batch.clear(); // In case the previous delivery failed.
+  PendingEvent event;
+  size_t popped = 0;
+  while (popped < ring.getCapacity() && ring.pop(event)) {
+    ++popped;
+    if (event.latest != nullptr) {
+      // Marker of a coalesced event - take the latest value (unless it was dropped meanwhile).
+      std::unique_ptr<PendingEvent> latest(event.latest->value.exchange(nullptr, std::memory_order_acq_rel));
+      if (latest) {
+        batch.push_back(std::move(*latest));
+      }
+    } else {
+      batch.push_back(std::move(event));
+    }
+  }
+
+  if (!batch.empty()) {
+    deliver();
+    batch.clear();
+  }
+  if (popped == ring.getCapacity()) {
+    uv_async_send(&handle);
+    return;
+  }
+
+  if (closing) {
+    uv_close(reinterpret_cast<uv_handle_t *>(&handle), [](uv_handle_t * closedHandle) {
+      delete static_cast<EventChannel *>(closedHandle->data);
+    });
+  }
+}
+
+void EventChannel::toArgs(const Napi::Env& env, const NativeEventRecord& record, std::vector<napi_value>& args) {
+  const Napi::Number deviceId = Napi::Number::New(env, record.deviceId);
+  switch (record.type) {
+    case NativeEventType::DETACHED:
+      args = { deviceId, Napi::Number::New(env, record.time) };
+      break;
+    case NativeEventType::BUTTON_IN_DATA_TRANSLATED:
+      args = { deviceId, Napi::Number::New(env, record.values[0]), Napi::Boolean::New(env, (record.flags & NativeEventRecord::FLAG_0) != 0) };
+      break;
+    case NativeEventType::BATTERY_STATUS:
+      args = { deviceId, Napi::Number::New(env, record.values[0]), Napi::Boolean::New(env, (record.flags & NativeEventRecord::FLAG_0) != 0),
+               Napi::Boolean::New(env, (record.flags & NativeEventRecord::FLAG_1) != 0) };
+      break;
+    case NativeEventType::REMOTE_MMI:
+    case NativeEventType::UPLOAD_PROGRESS:
+      args = { deviceId, Napi::Number::New(env, record.values[0]), Napi::Number::New(env, record.values[1]) };
+      break;
+    case NativeEventType::FIRMWARE_PROGRESS:
+      args = { deviceId, Napi::Number::New(env, record.values[0]), Napi::Number::New(env, record.values[1]), Napi::Number::New(env, record.values[2]) };
+      break;
+    default:
+      throw std::runtime_error("no fixed-size record format");
+  }
+}
+
+static void writeLittleEndian(uint8_t * destination, uint64_t value, size_t byteCount) {
+  for (size_t i = 0; i < byteCount; ++i) {
+    destination[i] = (uint8_t)(value >> (8 * i));
+  }
+}
+
+void EventChannel::writeRecord(uint8_t * destination, const NativeEventRecord& record) {
+  destination[RECORD_TYPE_OFFSET] = (uint8_t)record.type;
+  destination[RECORD_FLAGS_OFFSET] = record.flags;
+  writeLittleEndian(destination + RECORD_DEVICE_ID_OFFSET, record.deviceId, 2);
+  for (size_t i = 0; i < 3; ++i) {
+    writeLittleEndian(destination + RECORD_VALUES_OFFSET + 4 * i, (uint32_t)record.values[i], 4);
+  }
+  uint64_t timeBits;
+  std::memcpy(&timeBits, &record.time, sizeof(timeBits));
+  writeLittleEndian(destination + RECORD_TIME_OFFSET, timeBits, 8);
+}
+
+Napi::Value EventChannel::toEntry(const Napi::Env& env, const PendingEvent& event, std::vector<napi_value>& args) {
+  args.clear();
+  try {
+    if (event.argFunction) {
+      event.argFunction(env, args);
+    } else {
+      toArgs(env, event.record, args);
+    }
+  } catch (const std::exception &e) {
+    LOG_ERROR_(LOGINSTANCE) << "EventChannel: could not convert " << toString(event.type) << " event: " << e.what();
+    return Napi::Value();
+  }
+
+  Napi::Array entry = Napi::Array::New(env, args.size() + 1);
+  entry.Set((uint32_t)0, Napi::Number::New(env, (int)event.type));
+  for (size_t i = 0; i < args.size(); ++i) {
+    entry.Set((uint32_t)(i + 1), args[i]);
+  }
+  return entry;
+}
+
+void EventChannel::countBatch(uint32_t eventCount) {
+  batchCount++;
+  deliveredCount += eventCount;
+  if (eventCount > maxBatchSize) {
+    maxBatchSize = eventCount; // Only written from the main thread.
+  }
+}
+
+void EventChannel::countLatencies(uint64_t dispatchNs) const {
+  for (const PendingEvent& event : batch) {
+    const size_t index = static_cast<size_t>(event.type);
+    if (index < NATIVE_EVENT_TYPE_COUNT) {
+      latencies[index].queue.add(event.enqueuedNs, dispatchNs);
+      latencies[index].total.add(event.callbackNs, dispatchNs);
+    }
+  }
+}
+
+void EventChannel::deliver() {
+  if (!recordBuffer.IsEmpty()) {
+    deliverBinary();
+    return;
+  }
+
+  const Napi::Env env = dispatcher.Env();
+  Napi::HandleScope scope(env);
+
+  Napi::Array events = Napi::Array::New(env, batch.size());
+  uint32_t eventCount = 0;
+  std::vector<napi_value> args;
+  for (const PendingEvent& event : batch) {
+    Napi::Value entry = toEntry(env, event, args);
+    if (!entry.IsEmpty()) {
+      events.Set(eventCount++, entry);
+    }
+  }
+  countBatch(eventCount);
+  countLatencies(util::monotonicTimeNs());
+
+  try {
+    dispatcher.MakeCallback(receiver.Value(), { events });
+  } catch (const Napi::Error &e) {
+    // The javascript dispatcher handles errors of each event, so this is unexpected.
+    LOG_ERROR_(LOGINSTANCE) << "EventChannel: javascript event dispatcher failed: " << e.Message();
+  }
+}
+
+void EventChannel::deliverBinary() {
+  const Napi::Env env = dispatcher.Env();
+  Napi::HandleScope scope(env);
+
+  Napi::ArrayBuffer buffer = recordBuffer.Value();
+  uint8_t * const records = static_cast<uint8_t *>(buffer.Data());
+  Napi::Array events; // Only created if there are events without a fixed-size record.
+  uint32_t recordCount = 0;
+  uint32_t boxedCount = 0;
+  std::vector<napi_value> args;
+  for (const PendingEvent& event : batch) {
+    uint8_t * const destination = records + recordCount * RECORD_SIZE;
+    if (!event.argFunction) {
+      writeRecord(destination, event.record);
+    } else {
+      Napi::Value entry = toEntry(env, event, args);
+      if (entry.IsEmpty()) {
+        continue;
+      }
+      if (boxedCount == 0) {
+        events = Napi::Array::New(env);
+      }
+      NativeEventRecord boxed = newRecord(event.type, 0);
+      boxed.flags = RECORD_FLAG_BOXED;
+      boxed.values[0] = (int32_t)boxedCount;
+      writeRecord(destination, boxed);
+      events.Set(boxedCount++, entry);
+    }
+    ++recordCount;
+  }
+  countBatch(recordCount);
+  binaryRecordCount += recordCount - boxedCount;
+  countLatencies(util::monotonicTimeNs());
+
+  try {
+    const napi_value eventsArg = boxedCount > 0 ? (napi_value)events : (napi_value)env.Undefined();
+    dispatcher.MakeCallback(receiver.Value(), { eventsArg, buffer, Napi::Number::New(env, recordCount) });
+  } catch (const Napi::Error &e) {
+    // The javascript dispatcher handles errors of each event, so this is unexpected.
+    LOG_ERROR_(LOGINSTANCE) << "EventChannel: javascript event dispatcher failed: " << e.Message();
+  }
+}
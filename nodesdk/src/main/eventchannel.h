@@ -0,0 +1,275 @@
+#pragma once
+
+#include "stdafx.h"
+#include "mpscring.h"
+#include "latencyhistogram.h"
+
+#include <atomic>
+#include <vector>
+
+/**
+ * Kinds of events delivered from the Jabra SDK to javascript.
+ *
+ * Nb. Values are sent to javascript, so they must be kept in sync with NativeEventType in nativeevents.ts.
+ */
+enum class NativeEventType {
+  INITIALIZED = 0,
+  FIRST_SCAN_DONE = 1,
+  ATTACHED = 2,
+  DETACHED = 3,
+  BUTTON_IN_DATA_TRANSLATED = 4,
+  DEV_LOG = 5,
+  BATTERY_STATUS = 6,
+  REMOTE_MMI = 7,
+  FIRMWARE_PROGRESS = 8,
+  UPLOAD_PROGRESS = 9,
+  PAIRING_LIST = 10,
+  GNP_BUTTON = 11,
+  DECT_INFO = 12
+};
+
+const size_t NATIVE_EVENT_TYPE_COUNT = 13;
+
+/**
+ * Get display name of event type (same as in javascript - for logging and metrics).
+ */
+const char * toString(NativeEventType type);
+
+/**
+ * What to do with an event when the event queue is full.
+ */
+enum class NativeEventOverflowPolicy {
+  /** Drop the oldest queued event to make room, if it is DROP_OLDEST too (for status events superseded by newer ones). */
+  DROP_OLDEST,
+  /** Drop the new event (for events that must be seen in order, like button presses). */
+  DROP_NEWEST
+};
+
+/**
+ * Get the overflow policy of an event type.
+ */
+NativeEventOverflowPolicy overflowPolicy(NativeEventType type);
+
+/**
+ * Fixed-size event that can be delivered without any per-event javascript allocations (see binary event mode of
+ * EventChannel). Create with the factory functions, which define the meaning of the generic fields per event type.
+ */
+struct NativeEventRecord {
+  NativeEventType type;
+  uint8_t flags;
+  uint16_t deviceId;
+  int32_t values[3];
+  double time;
+
+  static const uint8_t FLAG_0 = 0x01;
+  static const uint8_t FLAG_1 = 0x02;
+
+  static NativeEventRecord detached(uint16_t deviceId, uint64_t eventTime);
+  static NativeEventRecord buttonInDataTranslated(uint16_t deviceId, int translatedInData, bool buttonInData);
+  static NativeEventRecord batteryStatus(uint16_t deviceId, int levelInPercent, bool charging, bool batteryLow);
+  static NativeEventRecord remoteMmi(uint16_t deviceId, int type, int input);
+  static NativeEventRecord firmwareProgress(uint16_t deviceId, int type, int status, int percentage);
+  static NativeEventRecord uploadProgress(uint16_t deviceId, int status, int percentage);
+};
+
+/**
+ * Marks a Jabra SDK callback as running on the current thread, so the latency of events it posts is measured from the
+ * callback entry. Create one first thing in every sdk callback.
+ */
+class SdkCallbackScope {
+  public:
+    SdkCallbackScope();
+
+    /**
+     * Continue an sdk callback on another thread (f.x. attach prefetching), keeping the entry time of the callback.
+     */
+    explicit SdkCallbackScope(uint64_t entryTimeNs);
+
+    ~SdkCallbackScope();
+
+    /**
+     * Entry time (util::monotonicTimeNs) of the sdk callback running on this thread, or 0 if none.
+     */
+    static uint64_t getEntryTimeNs();
+
+  private:
+    SdkCallbackScope(const SdkCallbackScope&) = delete;
+    SdkCallbackScope& operator=(const SdkCallbackScope&) = delete;
+
+    uint64_t outerEntryTimeNs;
+};
+
+/**
+ * Latencies of an event type, measured at sdk callback entry, enqueue and javascript dispatch.
+ */
+struct EventLatencyStats {
+  util::LatencyHistogramSnapshot sdk;   // Sdk callback entry -> enqueue (event conversion, capability loading etc.).
+  util::LatencyHistogramSnapshot queue; // Enqueue -> javascript dispatch (waiting for a busy main thread).
+  util::LatencyHistogramSnapshot total; // Sdk callback entry -> javascript dispatch.
+};
+
+/**
+ * Snapshot of event channel counters (for diagnostics only).
+ */
+struct EventChannelStats {
+  uint64_t posted;
+  uint64_t delivered;
+  uint64_t batches;
+  uint64_t maxBatchSize;
+  uint64_t coalesced;
+  uint64_t binaryRecords;
+  uint64_t dropped[NATIVE_EVENT_TYPE_COUNT]; // Indexed by NativeEventType.
+  EventLatencyStats latency[NATIVE_EVENT_TYPE_COUNT]; // Indexed by NativeEventType.
+};
+
+/**
+ * Single channel delivering all events from Jabra SDK threads to a javascript dispatcher function.
+ *
+ * Events posted from any thread are queued and delivered in order from the node main thread. All events queued when
+ * the main thread wakes up are delivered as one batch (array) in a single javascript call, rather than one uv async
+ * handle and one javascript call per event type and event. Each batch entry is an array of the NativeEventType followed
+ * by the event arguments.
+ *
+ * Events are queued in a bounded lock-free ring, so posting sdk threads never wait for the main thread. When the ring is
+ * full, an event is dropped according to the overflow policy of its type (and counted in the stats). A DROP_OLDEST event
+ * only evicts the oldest queued event if that is a DROP_OLDEST event too, else it is dropped itself.
+ *
+ * High-rate status events (see postLatest) are coalesced: While an event of the same kind for the same device is still
+ * undelivered, a new event just replaces its value, so javascript only gets the latest value. Only a marker is queued
+ * in the ring, while the value is kept in a lock-free table of latest-value slots.
+ *
+ * In binary event mode, fixed-size events (NativeEventRecord) are written as packed little-endian records into an
+ * ArrayBuffer allocated once per channel and reused for every batch, so they cost no javascript allocations at all. The
+ * dispatcher is then called with (events, recordBuffer, recordCount), where every delivered event has a record in
+ * order, and records of other events (FLAG_BOXED) refer to their entry in the events array. See RECORD_* for the layout
+ * and nativeevents.ts for the decoder. Otherwise records are converted to the same arguments as other events.
+ *
+ * Event latencies are measured with monotonic timestamps taken at sdk callback entry (see SdkCallbackScope), when
+ * queued and when the batch is passed to javascript, and kept in histograms per event type (see the stats).
+ *
+ * Like ThreadSafeCallback, the channel keeps the node process alive until closed. It must be created from the node
+ * main thread. The channel deletes itself when closed (after delivering already queued events).
+ */
+class EventChannel {
+  public:
+    static const size_t DEFAULT_CAPACITY = 1024;
+
+    // Layout of binary event records - must be kept in sync with NativeEventRecordLayout in nativeevents.ts:
+    static const size_t RECORD_SIZE = 24;
+    static const size_t RECORD_TYPE_OFFSET = 0;      // uint8
+    static const size_t RECORD_FLAGS_OFFSET = 1;     // uint8
+    static const size_t RECORD_DEVICE_ID_OFFSET = 2; // uint16
+    static const size_t RECORD_VALUES_OFFSET = 4;    // 3 x int32 (value 0 is the events array index of boxed events)
+    static const size_t RECORD_TIME_OFFSET = 16;     // float64
+    static const uint8_t RECORD_FLAG_BOXED = 0x80;
+
+    /**
+     * Produces the javascript arguments of an event. Called on the node main thread with a handle scope open.
+     */
+    typedef ThreadSafeCallback::arg_func_t arg_func_t;
+
+    EventChannel(const Napi::Function& dispatcher, size_t capacity = DEFAULT_CAPACITY, bool binaryEvents = false);
+
+    /**
+     * Queue an event for delivery. Can be called from any thread. Events posted after close() are dropped.
+     */
+    void post(NativeEventType type, arg_func_t argFunction);
+
+    /**
+     * Queue a fixed-size event for delivery. Can be called from any thread.
+     */
+    void post(const NativeEventRecord& record);
+
+    /**
+     * Queue a status event that is superseded by newer events of the same kind, replacing an undelivered event of the
+     * same type and sub kind for the device if there is one. Can be called from any thread.
+     *
+     * Nb. Never use for terminal events (completion, errors etc.) that must always be delivered.
+     */
+    void postLatest(NativeEventType type, unsigned short deviceId, unsigned int subKind, arg_func_t argFunction);
+
+    /**
+     * Queue a fixed-size status event, coalesced like postLatest above.
+     */
+    void postLatest(const NativeEventRecord& record, unsigned int subKind);
+
+    /**
+     * Close the channel and free resources once queued events have been delivered. Can be called from any thread.
+     */
+    void close();
+
+    static EventChannelStats getStats();
+
+    /**
+     * Convert a fixed-size event to its javascript arguments (as for other events). Main thread only.
+     */
+    static void toArgs(const Napi::Env& env, const NativeEventRecord& record, std::vector<napi_value>& args);
+
+  private:
+    struct PendingEvent;
+
+    struct LatestValueSlot {
+      std::atomic<uint64_t> key; // 0 when unused - slots are never released once claimed.
+      std::atomic<PendingEvent *> value; // Undelivered latest value or null.
+    };
+
+    struct PendingEvent {
+      NativeEventType type;
+      arg_func_t argFunction; // Empty for fixed-size events (in record).
+      NativeEventRecord record;
+      LatestValueSlot * latest; // Set for markers of coalesced events (the event itself is in the slot).
+      uint64_t callbackNs; // util::monotonicTimeNs at sdk callback entry (enqueue time if not posted from a callback).
+      uint64_t enqueuedNs;
+    };
+
+    struct LatencyHistograms {
+      util::LatencyHistogram sdk;
+      util::LatencyHistogram queue;
+      util::LatencyHistogram total;
+    };
+
+    // Enough for a few kinds of status events for many devices - beyond that, events are not coalesced.
+    static const size_t LATEST_VALUE_SLOT_COUNT = 1024;
+
+    // Max attempts to make room for a DROP_OLDEST event (other producers may take the room first).
+    static const int MAX_EVICTION_ATTEMPTS = 4;
+
+    EventChannel(const EventChannel&) = delete;
+    EventChannel& operator=(const EventChannel&) = delete;
+    ~EventChannel();
+
+    static void onAsync(uv_async_t * handle);
+    static void countDropped(NativeEventType type);
+    static void writeRecord(uint8_t * destination, const NativeEventRecord& record);
+    static Napi::Value toEntry(const Napi::Env& env, const PendingEvent& event, std::vector<napi_value>& args);
+    static void countBatch(uint32_t eventCount);
+    static void timestamp(PendingEvent& event);
+
+    LatestValueSlot * findLatestValueSlot(uint64_t key);
+    void postEvent(PendingEvent& event);
+    void postLatestEvent(PendingEvent& event, unsigned short deviceId, unsigned int subKind);
+    bool enqueue(PendingEvent& event);
+    void drain();
+    void deliver();
+    void deliverBinary();
+    void countLatencies(uint64_t dispatchNs) const;
+
+    Napi::ObjectReference receiver;
+    Napi::FunctionReference dispatcher;
+    uv_async_t handle;
+
+    util::MpscRing<PendingEvent> ring;
+    std::unique_ptr<LatestValueSlot[]> latestValues;
+    std::vector<PendingEvent> batch; // Main thread only - reused between batches.
+    Napi::Reference<Napi::ArrayBuffer> recordBuffer; // Binary event mode only - room for a full ring of records.
+    std::atomic<bool> closed;
+
+    static std::atomic<uint64_t> postedCount;
+    static std::atomic<uint64_t> deliveredCount;
+    static std::atomic<uint64_t> batchCount;
+    static std::atomic<uint64_t> maxBatchSize;
+    static std::atomic<uint64_t> coalescedCount;
+    static std::atomic<uint64_t> binaryRecordCount;
+    static std::atomic<uint64_t> droppedCount[NATIVE_EVENT_TYPE_COUNT];
+    static LatencyHistograms latencies[NATIVE_EVENT_TYPE_COUNT];
+};
@@ -0,0 +1,154 @@
+#include "eventhistory.h"
+
+#include <algorithm>
+#include <chrono>
+
+/**
+ * Name of the javascript device event emitted for a native event type (as used in the eventHistoryCapacity config),
+ * or null if the native event is not a device event.
+ */
+static const char * toDeviceEventName(NativeEventType type) {
+  switch (type) {
+    case NativeEventType::BUTTON_IN_DATA_TRANSLATED: return "btnPress";
+    case NativeEventType::DEV_LOG: return "onDevLogEvent";
+    case NativeEventType::BATTERY_STATUS: return "onBatteryStatusUpdate";
+    case NativeEventType::REMOTE_MMI: return "onRemoteMmiEvent";
+    case NativeEventType::FIRMWARE_PROGRESS: return "downloadFirmwareProgress";
+    case NativeEventType::UPLOAD_PROGRESS: return "onUploadProgress";
+    case NativeEventType::PAIRING_LIST: return "onBTParingListChange";
+    case NativeEventType::GNP_BUTTON: return "onGNPBtnEvent";
+    case NativeEventType::DECT_INFO: return "onDectInfoEvent";
+    default: return nullptr;
+  }
+}
+
+static uint64_t getTimeSinceEpochMs() {
+  return (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+DeviceEventHistory& DeviceEventHistory::instance() {
+  static DeviceEventHistory history;
+  return history;
+}
+
+DeviceEventHistory::DeviceEventHistory() : capacities(), mutex(), devices() {
+  capacities[static_cast<size_t>(NativeEventType::BUTTON_IN_DATA_TRANSLATED)] = DEFAULT_BUTTON_CAPACITY;
+  capacities[static_cast<size_t>(NativeEventType::BATTERY_STATUS)] = DEFAULT_BATTERY_CAPACITY;
+  capacities[static_cast<size_t>(NativeEventType::DECT_INFO)] = DEFAULT_DECT_INFO_CAPACITY;
+}
+
+void DeviceEventHistory::configure(Napi::Object& config) {
+  for (size_t t = 0; t < NATIVE_EVENT_TYPE_COUNT; ++t) {
+    const char * const name = toDeviceEventName(static_cast<NativeEventType>(t));
+    if (name != nullptr) {
+      const int32_t capacity = util::getObjInt32OrDefault(config, name, (int32_t)capacities[t]);
+      capacities[t] = capacity > 0 ? (size_t)capacity : 0;
+    }
+  }
+}
+
+void DeviceEventHistory::add(unsigned short deviceId, NativeEventType type, EventChannel::arg_func_t argFunction) {
+  if (isRecorded(type)) {
+    Entry entry = { 0, getTimeSinceEpochMs(), type, std::move(argFunction), NativeEventRecord() };
+    addEntry(deviceId, entry);
+  }
+}
+
+void DeviceEventHistory::add(const NativeEventRecord& record) {
+  if (isRecorded(record.type)) {
+    Entry entry = { 0, getTimeSinceEpochMs(), record.type, EventChannel::arg_func_t(), record };
+    addEntry(record.deviceId, entry);
+  }
+}
+
+void DeviceEventHistory::addEntry(unsigned short deviceId, Entry& entry) {
+  const size_t index = static_cast<size_t>(entry.type);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  DeviceHistory& device = devices[deviceId];
+  entry.sequenceNumber = ++device.lastSequenceNumber;
+
+  std::deque<Entry>& entries = device.entries[index];
+  if (entries.size() >= capacities[index]) {
+    entries.pop_front();
+  }
+  entries.push_back(std::move(entry));
+}
+
+void DeviceEventHistory::remove(unsigned short deviceId) {
+  std::lock_guard<std::mutex> lock(mutex);
+  devices.erase(deviceId);
+}
+
+void DeviceEventHistory::clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  devices.clear();
+}
+
+Napi::Object DeviceEventHistory::getEvents(const Napi::Env& env, unsigned short deviceId, uint64_t sinceSequenceNumber) {
+  // Copy the events under the lock, but convert them to javascript without it, so sdk threads are not held up.
+  std::vector<Entry> selected;
+  uint64_t lastSequenceNumber = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto device = devices.find(deviceId);
+    if (device != devices.end()) {
+      lastSequenceNumber = device->second.lastSequenceNumber;
+      for (const std::deque<Entry>& entries : device->second.entries) {
+        for (const Entry& entry : entries) {
+          if (entry.sequenceNumber > sinceSequenceNumber) {
+            selected.push_back(entry);
+          }
+        }
+      }
+    }
+  }
+  std::sort(selected.begin(), selected.end(), [](const Entry& a, const Entry& b) {
+    return a.sequenceNumber < b.sequenceNumber;
+  });
+
+  Napi::Array events = Napi::Array::New(env);
+  uint32_t eventCount = 0;
+  std::vector<napi_value> args;
+  for (const Entry& entry : selected) {
+    args.clear();
+    try {
+      if (entry.argFunction) {
+        entry.argFunction(env, args);
+      } else {
+        EventChannel::toArgs(env, entry.record, args);
+      }
+    } catch (const std::exception &e) {
+      LOG_ERROR_(LOGINSTANCE) << "DeviceEventHistory: could not convert " << toString(entry.type) << " event: " << e.what();
+      continue;
+    }
+
+    Napi::Array event = Napi::Array::New(env, args.size() + 3);
+    event.Set((uint32_t)0, Napi::Number::New(env, (double)entry.sequenceNumber));
+    event.Set((uint32_t)1, Napi::Number::New(env, (double)entry.timeMs));
+    event.Set((uint32_t)2, Napi::Number::New(env, (int)entry.type));
+    for (size_t i = 0; i < args.size(); ++i) {
+      event.Set((uint32_t)(i + 3), args[i]);
+    }
+    events.Set(eventCount++, event);
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set(Napi::String::New(env, "lastSequenceNumber"), Napi::Number::New(env, (double)lastSequenceNumber));
+  result.Set(Napi::String::New(env, "events"), events);
+  return result;
+}
+
+Napi::Value napi_GetDeviceEventHistory(const Napi::CallbackInfo& info) {
+  return util::JSyncWrapper<Napi::Value>(__func__, info, [](const char * const functionName, const Napi::CallbackInfo& info) -> Napi::Value {
+    const Napi::Env env = info.Env();
+
+    if (util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER})) {
+      const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
+      const double since = info[1].As<Napi::Number>().DoubleValue();
+      return DeviceEventHistory::instance().getEvents(env, deviceId, since > 0 ? (uint64_t)since : 0);
+    }
+
+    return env.Undefined();
+  });
+}
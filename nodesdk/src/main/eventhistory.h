@@ -0,0 +1,97 @@
+#pragma once
+
+#include "stdafx.h"
+#include "eventchannel.h"
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * Bounded history of recent events per device, so javascript subscribing late (f.x. a reloaded electron renderer)
+ * can replay the events it missed instead of polling the device state.
+ *
+ * Events get a sequence number per device (starting at 1 when the device is attached). The number of events kept is
+ * configured per event type (0 = none), and the oldest event of a type is dropped when a newer one is added. Events
+ * are kept independently of javascript listeners and of the event queue.
+ */
+class DeviceEventHistory {
+  public:
+    // Events kept per device by default - enough to resync button, battery and DECT state:
+    static const size_t DEFAULT_BUTTON_CAPACITY = 16;
+    static const size_t DEFAULT_BATTERY_CAPACITY = 1;
+    static const size_t DEFAULT_DECT_INFO_CAPACITY = 2; // DECT info comes in two kinds (density and error counts).
+
+    static DeviceEventHistory& instance();
+
+    /**
+     * Set the events kept per device from the eventHistoryCapacity config object, keyed by device event name
+     * ("btnPress", "onBatteryStatusUpdate" etc.). Event types not in the object keep their default. Must be called
+     * before events are added.
+     */
+    void configure(Napi::Object& capacities);
+
+    /**
+     * Are events of this type kept at all? Cheap - check before preparing an event just for the history.
+     */
+    bool isRecorded(NativeEventType type) const {
+      const size_t index = static_cast<size_t>(type);
+      return index < NATIVE_EVENT_TYPE_COUNT && capacities[index] > 0;
+    }
+
+    /**
+     * Add an event. Can be called from any thread.
+     */
+    void add(unsigned short deviceId, NativeEventType type, EventChannel::arg_func_t argFunction);
+
+    /**
+     * Add a fixed-size event. Can be called from any thread.
+     */
+    void add(const NativeEventRecord& record);
+
+    /**
+     * Forget a detached device.
+     */
+    void remove(unsigned short deviceId);
+
+    /**
+     * Forget all devices (on uninitialize).
+     */
+    void clear();
+
+    /**
+     * Get the events of a device with a sequence number above sinceSequenceNumber as
+     * { lastSequenceNumber, events: [sequenceNumber, time_ms, NativeEventType, deviceId, ...args][] } in order.
+     * Must be called from the node main thread.
+     */
+    Napi::Object getEvents(const Napi::Env& env, unsigned short deviceId, uint64_t sinceSequenceNumber);
+
+  private:
+    struct Entry {
+      uint64_t sequenceNumber;
+      uint64_t timeMs;
+      NativeEventType type;
+      EventChannel::arg_func_t argFunction; // Empty for fixed-size events (in record).
+      NativeEventRecord record;
+    };
+
+    struct DeviceHistory {
+      uint64_t lastSequenceNumber;
+      std::deque<Entry> entries[NATIVE_EVENT_TYPE_COUNT]; // Indexed by NativeEventType, oldest first.
+    };
+
+    DeviceEventHistory();
+    DeviceEventHistory(const DeviceEventHistory&) = delete;
+    DeviceEventHistory& operator=(const DeviceEventHistory&) = delete;
+
+    void addEntry(unsigned short deviceId, Entry& entry);
+
+    size_t capacities[NATIVE_EVENT_TYPE_COUNT]; // Only written by configure.
+    std::mutex mutex;
+    std::unordered_map<unsigned short, DeviceHistory> devices;
+};
+
+/**
+ * GetDeviceEventHistory(deviceId, sinceSequenceNumber) - see DeviceEventHistory::getEvents.
+ */
+Napi::Value napi_GetDeviceEventHistory(const Napi::CallbackInfo& info);
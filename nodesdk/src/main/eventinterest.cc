@@ -0,0 +1,51 @@
+#include "eventinterest.h"
+
+DeviceEventInterest& DeviceEventInterest::instance() {
+  static DeviceEventInterest interest;
+  return interest;
+}
+
+void DeviceEventInterest::set(unsigned short deviceId, uint32_t eventMask) {
+  std::lock_guard<std::mutex> lock(mutex);
+  eventMasks[deviceId] = eventMask;
+}
+
+void DeviceEventInterest::remove(unsigned short deviceId) {
+  std::lock_guard<std::mutex> lock(mutex);
+  eventMasks.erase(deviceId);
+}
+
+void DeviceEventInterest::clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  eventMasks.clear();
+}
+
+bool DeviceEventInterest::isWanted(unsigned short deviceId, NativeEventType type) {
+  bool wanted = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    // Until javascript sets the first mask, it may still be adding listeners (f.x. in its attach handler):
+    auto it = eventMasks.find(deviceId);
+    wanted = it == eventMasks.end() || ((it->second >> static_cast<int>(type)) & 1) != 0;
+  }
+
+  if (!wanted) {
+    ++filteredCount;
+  }
+  return wanted;
+}
+
+Napi::Value napi_SetDeviceEventInterest(const Napi::CallbackInfo& info) {
+  return util::JSyncWrapper<Napi::Value>(__func__, info, [](const char * const functionName, const Napi::CallbackInfo& info) -> Napi::Value {
+    const Napi::Env env = info.Env();
+
+    if (util::verifyArguments(functionName, info, {util::NUMBER, util::NUMBER})) {
+      const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
+      const uint32_t eventMask = info[1].As<Napi::Number>().Uint32Value();
+      LOG_VERBOSE_(LOGINSTANCE) << "Device #" << deviceId << " event interest set to " << eventMask;
+      DeviceEventInterest::instance().set(deviceId, eventMask);
+    }
+
+    return env.Undefined();
+  });
+}
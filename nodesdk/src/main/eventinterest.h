@@ -0,0 +1,60 @@
+#pragma once
+
+#include "stdafx.h"
+#include "eventchannel.h"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * Which device events javascript has listeners for, per device. Device events nobody listens for are dropped in the
+ * sdk callbacks, before they are converted and queued for javascript. All events of a device are wanted until
+ * javascript sets its first mask, so events are not lost while listeners are added after the device is attached.
+ *
+ * Nb. libjabra can only be told not to produce DEVICE_EVENT_AUDIO_READY (Jabra_SetSubscribedDeviceEvents), which is
+ * not one of the events delivered to javascript, so filtering is done here only.
+ */
+class DeviceEventInterest {
+  public:
+    static DeviceEventInterest& instance();
+
+    /**
+     * Set the events javascript listens for on a device (bit n set = interested in NativeEventType n).
+     */
+    void set(unsigned short deviceId, uint32_t eventMask);
+
+    /**
+     * Forget a detached device.
+     */
+    void remove(unsigned short deviceId);
+
+    /**
+     * Forget all devices (on uninitialize).
+     */
+    void clear();
+
+    /**
+     * Does javascript listen for events of this type from the device (or has not set a mask for it yet)? Counts the
+     * event as filtered if not.
+     */
+    bool isWanted(unsigned short deviceId, NativeEventType type);
+
+    uint64_t getFilteredCount() const {
+      return filteredCount;
+    }
+
+  private:
+    DeviceEventInterest() : filteredCount(0) {}
+    DeviceEventInterest(const DeviceEventInterest&) = delete;
+    DeviceEventInterest& operator=(const DeviceEventInterest&) = delete;
+
+    std::mutex mutex;
+    std::unordered_map<unsigned short, uint32_t> eventMasks;
+    std::atomic<uint64_t> filteredCount;
+};
+
+/**
+ * SetDeviceEventInterest(deviceId, eventMask) - see DeviceEventInterest::set.
+ */
+Napi::Value napi_SetDeviceEventInterest(const Napi::CallbackInfo& info);
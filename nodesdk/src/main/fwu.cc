@@ -3,81 +3,115 @@
 Napi::Value napi_DownloadFirmware(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::STRING, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING, util::STRING}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const std::string version = info[1].As<Napi::String>();
     const std::string authorization = info[2].As<Napi::String>();
-    Napi::Function javascriptResultCallback = info[3].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, version, authorization](){ 
         Jabra_ReturnCode ret = Jabra_DownloadFirmware(deviceId, version.c_str(), authorization.c_str());
         if (ret != Return_Async && ret != Return_Ok) {
           throw util::JabraReturnCodeException(functionName, ret);
         }
       }
-    ))->Queue();
+    );
+    worker->SetPriority(util::SdkPriority::BULK);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_UpdateFirmware(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const std::string firmFile = info[1].As<Napi::String>();
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, firmFile](){ 
         Jabra_ReturnCode ret = Jabra_UpdateFirmware(deviceId, firmFile.c_str());
         if (ret != Return_Async && ret != Return_Ok) {
           throw util::JabraReturnCodeException(functionName, ret);
         }
       }
-    ))->Queue();
+    );
+    worker->SetPriority(util::SdkPriority::BULK);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_DownloadFirmwareUpdater(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const std::string authorization = info[1].As<Napi::String>();
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, authorization](){ 
         Jabra_ReturnCode ret = Jabra_DownloadFirmwareUpdater(deviceId, authorization.c_str());
         if (ret != Return_Async && ret != Return_Ok) {
           throw util::JabraReturnCodeException(functionName, ret);
         }
       }
-    ))->Queue();
+    );
+    worker->SetPriority(util::SdkPriority::BULK);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_GetFirmwareFilePath(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const std::string version = info[1].As<Napi::String>();
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<std::string, Napi::String>(
+    auto * const worker = new util::JAsyncWorker<std::string, Napi::String>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, version](){ 
         if (char * result = Jabra_GetFirmwareFilePath(deviceId, version.c_str())) {
           std::string managedResult(result);
@@ -89,14 +123,20 @@ Napi::Value napi_GetFirmwareFilePath(const Napi::CallbackInfo& info) {
       [](const Napi::Env& env, const std::string& filePath) { 
         Napi::String napiResult = Napi::String::New(env, filePath.c_str());
         return napiResult;
-      }))->Queue();
+      });
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_IsFirmwareLockEnabled(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, info, [](unsigned short deviceId) {
+  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, util::AsyncOptions::ReadOnly(), info, [](unsigned short deviceId) {
     bool retv = Jabra_IsFirmwareLockEnabled(deviceId);
     return retv;
   }, [](const Napi::Env& env, bool cppResult) {  return Napi::Boolean::New(env, cppResult); });
@@ -114,7 +154,7 @@ Napi::Value napi_EnableFirmwareLock(const Napi::CallbackInfo& info) {
 
 Napi::Value napi_GetFirmwareVersion(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
-  return util::SimpleDeviceAsyncFunction<Napi::String, std::string>(functionName, info, 
+  return util::SimpleDeviceAsyncFunction<Napi::String, std::string>(functionName, util::AsyncOptions::ReadOnly(), info, 
     [functionName](unsigned short deviceId) {
       char buf[64];
       Jabra_ReturnCode retv;
@@ -133,14 +173,18 @@ Napi::Value napi_GetLatestFirmwareInformation(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const std::string authorizationId = info[1].As<Napi::String>();
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<Jabra_FirmwareInfo *, Napi::Object>(
+    auto * const worker = new util::JAsyncWorker<Jabra_FirmwareInfo *, Napi::Object>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, authorizationId](){ 
         Jabra_FirmwareInfo * fwInfo = Jabra_GetLatestFirmwareInformation(deviceId, authorizationId.c_str());
 
@@ -177,47 +221,66 @@ Napi::Value napi_GetLatestFirmwareInformation(const Napi::CallbackInfo& info) {
           Jabra_FreeFirmwareInfo(fwInfo);
         }
       }
-    ))->Queue();
+    );
+    worker->SetPriority(util::SdkPriority::BULK);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }  
 
 Napi::Value napi_CancelFirmwareDownload(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
-    Napi::Function javascriptResultCallback = info[1].As<Napi::Function>();
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId](){ 
         Jabra_ReturnCode retv;                       
         if ((retv = Jabra_CancelFirmwareDownload(deviceId)) != Return_Ok) {
           util::JabraReturnCodeException::LogAndThrow(functionName, retv);
         }
       }
-    ))->Queue();
+    );
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_CheckForFirmwareUpdate(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const std::string authorizationId = info[1].As<Napi::String>();
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<bool, Napi::Boolean>(
+    auto * const worker = new util::JAsyncWorker<bool, Napi::Boolean>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName,deviceId,authorizationId](){
         Jabra_ReturnCode retv = Jabra_CheckForFirmwareUpdate(deviceId, authorizationId.c_str());
 
@@ -234,8 +297,14 @@ Napi::Value napi_CheckForFirmwareUpdate(const Napi::CallbackInfo& info) {
       [](const Napi::Env& env, const bool result) {
         return Napi::Boolean::New(env, result);
       }
-    ))->Queue();
+    );
+    worker->SetPriority(util::SdkPriority::BULK);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
@@ -8,6 +8,13 @@
 #include "bt.h"
 #include "app.h"
 #include "callControl.h"
+#include "metrics.h"
+#include "batch.h"
+#include "cancellation.h"
+#include "propertykeys.h"
+#include "eventinterest.h"
+#include "eventhistory.h"
+#include "buttoncatalogue.h"
 
 
 /**
@@ -20,6 +27,7 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
   // App:
   EXPORTS_SET(Initialize)
   EXPORTS_SET(UnInitialize)
+  EXPORTS_SET(GetAttachedDevices)
 
   EXPORTS_SET(ConnectToJabraApplication)
   EXPORTS_SET(DisconnectFromJabraApplication)
@@ -95,6 +103,9 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
   EXPORTS_SET(SetSettings)
   EXPORTS_SET(GetSetting)
   EXPORTS_SET(GetSettings)
+  EXPORTS_SET(GetSettingsSchema)
+  EXPORTS_SET(GetSettingValues)
+  EXPORTS_SET(GetSettingValue)
   EXPORTS_SET(FactoryReset)
   EXPORTS_SET(IsFactoryResetSupported)
   EXPORTS_SET(IsSettingProtectionEnabled)
@@ -152,6 +163,20 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
   EXPORTS_SET(NativeAddonLog);
   EXPORTS_SET(GetNativeAddonLogConfig);
 
+  // Diagnostics:
+  EXPORTS_SET(GetNativeMetrics);
+
+  // Events:
+  EXPORTS_SET(SetDeviceEventInterest);
+  EXPORTS_SET(GetDeviceEventHistory);
+  EXPORTS_SET(GetButtonCatalogue);
+
+  // Batches:
+  EXPORTS_SET(ExecuteBatch);
+
+  // Cancellation:
+  EXPORTS_SET(CancelCall);
+
   // Call control
   EXPORTS_SET(SetHold);
   EXPORTS_SET(GetBusyLightStatus);
@@ -169,6 +194,13 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
   EXPORTS_SET(SetZoom);
   EXPORTS_SET(GetZoomLimits);
 
+#ifdef BUILD_BENCHMARKS
+  EXPORTS_SET(BenchmarkSettingsConversion);
+  EXPORTS_SET(BenchmarkSettingValuesConversion);
+#endif
+
+  PropertyKeys::init(env);
+
   try {
     configureLogging();
   } catch (const std::exception &e) {
@@ -0,0 +1,166 @@
+#include "stdafx.h"
+#include "latencyhistogram.h"
+
+#include <mutex>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+// Set by binding.gyp to the file name of the libjabra build copied next to the addon.
+#ifndef JABRA_LIBRARY_FILE
+#if defined(_WIN32)
+#define JABRA_LIBRARY_FILE "libjabra.dll"
+#elif defined(__APPLE__)
+#define JABRA_LIBRARY_FILE "libjabra.dylib"
+#else
+#define JABRA_LIBRARY_FILE "libjabra.so"
+#endif
+#endif
+
+namespace jabralib {
+
+std::atomic<void *> functions[static_cast<size_t>(Function::COUNT)];
+
+static const char * const functionNames[] = {
+#define JABRA_LIBRARY_FUNCTION_NAME(name) #name,
+  JABRA_LIBRARY_FUNCTIONS(JABRA_LIBRARY_FUNCTION_NAME)
+#undef JABRA_LIBRARY_FUNCTION_NAME
+};
+
+static std::mutex mutex;
+static void * library = nullptr; // Never unloaded - libjabra threads may outlive uninitialize.
+static LibraryStats stats = { false, "", 0.0, 0, 0.0, "" };
+
+#ifdef _WIN32
+static void * openLibrary(const std::string& file) {
+  // Let dependencies of libjabra be found next to it too:
+  return LoadLibraryExA(file.c_str(), NULL, file.find_first_of("\\/") != std::string::npos ? LOAD_WITH_ALTERED_SEARCH_PATH : 0);
+}
+
+static std::string lastError() {
+  return "error code " + std::to_string(GetLastError());
+}
+
+static void * findFunction(void * handle, const char * name) {
+  return reinterpret_cast<void *>(GetProcAddress(static_cast<HMODULE>(handle), name));
+}
+
+static std::string addonDirectory() {
+  HMODULE module = NULL;
+  char path[MAX_PATH];
+  if (!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                          reinterpret_cast<LPCSTR>(&addonDirectory), &module)) {
+    return "";
+  }
+  const DWORD length = GetModuleFileNameA(module, path, MAX_PATH);
+  const std::string file(path, length < MAX_PATH ? length : 0);
+  const size_t separator = file.find_last_of("\\/");
+  return separator != std::string::npos ? file.substr(0, separator + 1) : "";
+}
+#else
+static void * openLibrary(const std::string& file) {
+  // Functions are looked up on first use anyway, so let libjabra bind its own dependencies lazily too:
+  return dlopen(file.c_str(), RTLD_LAZY | RTLD_LOCAL);
+}
+
+static std::string lastError() {
+  const char * const error = dlerror();
+  return error ? error : "unknown error";
+}
+
+static void * findFunction(void * handle, const char * name) {
+  return dlsym(handle, name);
+}
+
+static std::string addonDirectory() {
+  Dl_info info;
+  if (!dladdr(reinterpret_cast<void *>(&addonDirectory), &info) || !info.dli_fname) {
+    return "";
+  }
+  const std::string file(info.dli_fname);
+  const size_t separator = file.find_last_of('/');
+  return separator != std::string::npos ? file.substr(0, separator + 1) : "";
+}
+#endif
+
+static bool loadLocked(std::string& error) {
+  if (library) {
+    return true;
+  }
+
+  const uint64_t startNs = util::monotonicTimeNs();
+
+  // Prefer the build copied next to the addon by binding.gyp, then whatever the system finds:
+  const std::string bundled = addonDirectory() + JABRA_LIBRARY_FILE;
+  stats.file = bundled;
+  library = openLibrary(bundled);
+  if (!library) {
+    const std::string bundledError = lastError();
+    library = openLibrary(JABRA_LIBRARY_FILE);
+    if (!library) {
+      stats.error = "Could not load the Jabra SDK library " + bundled + " (" + bundledError + ") or " + JABRA_LIBRARY_FILE
+                    + " from the library search path (" + lastError() + ")";
+    } else {
+      stats.file = JABRA_LIBRARY_FILE;
+    }
+  }
+
+  stats.loadMs = (double)(util::monotonicTimeNs() - startNs) / 1000000.0;
+  stats.loaded = library != nullptr;
+
+  if (!library) {
+    LOG_ERROR_(LOGINSTANCE) << stats.error;
+    error = stats.error;
+    return false;
+  }
+
+  stats.error.clear();
+  LOG_INFO_(LOGINSTANCE) << "Loaded " << stats.file << " in " << stats.loadMs << " ms";
+  return true;
+}
+
+bool load(std::string& error) {
+  std::lock_guard<std::mutex> lock(mutex);
+  return loadLocked(error);
+}
+
+void * resolve(Function function) {
+  const size_t index = static_cast<size_t>(function);
+  const char * const name = functionNames[index];
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  void * address = functions[index].load(std::memory_order_relaxed);
+  if (address) {
+    return address; // Resolved by another thread meanwhile.
+  }
+
+  std::string error;
+  if (!loadLocked(error)) {
+    throw util::JabraException(name, error);
+  }
+
+  const uint64_t startNs = util::monotonicTimeNs();
+  address = findFunction(library, name);
+  stats.resolveMs += (double)(util::monotonicTimeNs() - startNs) / 1000000.0;
+  if (!address) {
+    LOG_ERROR_(LOGINSTANCE) << "Function " << name << " not found in " << stats.file;
+    throw util::JabraException(name, "Function not found in the Jabra SDK library " + stats.file);
+  }
+
+  ++stats.resolved;
+  functions[index].store(address, std::memory_order_release);
+  return address;
+}
+
+LibraryStats getStats() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return stats;
+}
+
+}
@@ -0,0 +1,443 @@
+#pragma once
+
+/**
+ * Lazy loading of libjabra.
+ *
+ * The addon is not linked against libjabra - the library is only loaded (with all its dependencies) when the sdk is
+ * first initialized or called, so requiring the addon stays cheap for applications and tools that never use devices.
+ * Each libjabra function is looked up the first time it is called and the address cached for later calls.
+ *
+ * All code calls libjabra functions as before: Below, every function declared by the libjabra headers is redefined
+ * as a macro calling through the cached address (with the same signature, taken from the header declaration).
+ *
+ * Nb. Must be included after the libjabra headers (done by stdafx.h).
+ */
+
+#include <Common.h>
+#include <JabraDeviceConfig.h>
+#include <JabraNativeHid.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+/**
+ * All functions declared by the libjabra headers (in header order).
+ */
+#define JABRA_LIBRARY_FUNCTIONS(X) \
+  /* Common.h: */ \
+  X(Jabra_GetVersion) \
+  X(Jabra_SetAppID) \
+  X(Jabra_InitializeV2) \
+  X(Jabra_Initialize) \
+  X(Jabra_Uninitialize) \
+  X(Jabra_SetHidEventsFromNonJabraDevices) \
+  X(Jabra_IsHidEventsFromNonJabraDevicesEnabled) \
+  X(Jabra_SetStdHidEventsFromJabraDevices) \
+  X(Jabra_IsStdHidEventsFromJabraDevicesEnabled) \
+  X(Jabra_IsFirstScanForDevicesDone) \
+  X(Jabra_IsDeviceAttached) \
+  X(Jabra_GetAttachedJabraDevices) \
+  X(Jabra_FreeDeviceInfo) \
+  X(Jabra_GetSerialNumber) \
+  X(Jabra_GetESN) \
+  X(Jabra_GetSku) \
+  X(Jabra_GetHwAndConfigVersion) \
+  X(Jabra_GetMultiESN) \
+  X(Jabra_FreeMap) \
+  X(Jabra_GetFirmwareVersion) \
+  X(Jabra_GetCurrentLanguageCode) \
+  X(Jabra_GetDeviceImagePath) \
+  X(Jabra_GetDeviceImageThumbnailPath) \
+  X(Jabra_GetBatteryStatusV2) \
+  X(Jabra_CopyJabraBatteryStatus) \
+  X(Jabra_FreeBatteryStatus) \
+  X(Jabra_GetBatteryStatus) \
+  X(Jabra_RegisterBatteryStatusUpdateCallbackV2) \
+  X(Jabra_RegisterBatteryStatusUpdateCallback) \
+  X(Jabra_GetWarrantyEndDate) \
+  X(Jabra_ConnectToJabraApplication) \
+  X(Jabra_DisconnectFromJabraApplication) \
+  X(Jabra_SetSoftphoneReady) \
+  X(Jabra_IsSoftphoneInFocus) \
+  X(Jabra_SetBTPairing) \
+  X(Jabra_SearchNewDevices) \
+  X(Jabra_GetSearchDeviceList) \
+  X(Jabra_StopBTPairing) \
+  X(Jabra_SetAutoPairing) \
+  X(Jabra_GetAutoPairing) \
+  X(Jabra_ConnectBTDevice) \
+  X(Jabra_ConnectNewDevice) \
+  X(Jabra_DisconnectBTDevice) \
+  X(Jabra_ConnectPairedDevice) \
+  X(Jabra_DisConnectPairedDevice) \
+  X(Jabra_GetConnectedBTDeviceName) \
+  X(Jabra_IsPairingListSupported) \
+  X(Jabra_GetSecureConnectionMode) \
+  X(Jabra_GetPairingList) \
+  X(Jabra_ClearPairingList) \
+  X(Jabra_FreePairingList) \
+  X(Jabra_ClearPairedDevice) \
+  X(Jabra_RegisterPairingListCallback) \
+  X(Jabra_GetErrorString) \
+  X(Jabra_GetReturnCodeString) \
+  X(Jabra_IsBusylightSupported) \
+  X(Jabra_GetBusylightStatus) \
+  X(Jabra_SetBusylightStatus) \
+  X(Jabra_RegisterBusylightEvent) \
+  X(Jabra_IsLeftEarbudStatusSupported) \
+  X(Jabra_GetLeftEarbudStatus) \
+  X(Jabra_RegisterLeftEarbudStatus) \
+  X(Jabra_RegisterHearThroughSettingChangeHandler) \
+  X(Jabra_IsEqualizerSupported) \
+  X(Jabra_IsEqualizerEnabled) \
+  X(Jabra_EnableEqualizer) \
+  X(Jabra_GetEqualizerParameters) \
+  X(Jabra_SetEqualizerParameters) \
+  X(Jabra_IsRemoteMMISupported) \
+  X(Jabra_GetButtonFocus) \
+  X(Jabra_ReleaseButtonFocus) \
+  X(Jabra_GetSupportedButtonEvents) \
+  X(Jabra_FreeButtonEvents) \
+  X(Jabra_RegisterForGNPButtonEvent) \
+  X(Jabra_IsSettingProtectionEnabled) \
+  X(Jabra_GetCustomerSupportUrl) \
+  X(Jabra_GetNpsUrlForApplication) \
+  X(Jabra_GetNpsUrl) \
+  X(Jabra_ProductRegistration) \
+  X(Jabra_ExecuteAVRCPCommand) \
+  X(Jabra_ConfigureLogging) \
+  X(Jabra_RegisterLoggingCallback) \
+  X(Jabra_RegisterDevLogCallback) \
+  X(Jabra_EnableDevLog) \
+  X(Jabra_IsDevLogEnabled) \
+  X(Jabra_IsFirmwareLockEnabled) \
+  X(Jabra_EnableFirmwareLock) \
+  X(Jabra_CheckForFirmwareUpdate) \
+  X(Jabra_GetLatestFirmwareInformation) \
+  X(Jabra_FreeFirmwareInfo) \
+  X(Jabra_GetFirmwareFilePath) \
+  X(Jabra_GetAllFirmwareInformation) \
+  X(Jabra_FreeFirmwareInfoList) \
+  X(Jabra_DownloadFirmware) \
+  X(Jabra_DownloadFirmwareUpdater) \
+  X(Jabra_UpdateFirmware) \
+  X(Jabra_CancelFirmwareDownload) \
+  X(Jabra_RegisterFirmwareProgressCallBack) \
+  X(Jabra_Reconnect) \
+  X(Jabra_IsFeatureSupported) \
+  X(Jabra_GetSupportedFeatures) \
+  X(Jabra_FreeSupportedFeatures) \
+  X(Jabra_RequestNoHangupToneNextTime) \
+  X(Jabra_IsCertifiedForSkypeForBusiness) \
+  X(Jabra_FreeCharArray) \
+  X(Jabra_IsUploadRingtoneSupported) \
+  X(Jabra_UploadRingtone) \
+  X(Jabra_UploadWavRingtone) \
+  X(Jabra_GetAudioFileParametersForUpload) \
+  X(Jabra_RegisterUploadProgress) \
+  X(Jabra_IsUploadImageSupported) \
+  X(Jabra_UploadImage) \
+  X(Jabra_SetWizardMode) \
+  X(Jabra_GetWizardMode) \
+  X(Jabra_IsSetDateTimeSupported) \
+  X(Jabra_SetDateTime) \
+  X(Jabra_GetSupportedDeviceEvents) \
+  X(Jabra_SetSubscribedDeviceEvents) \
+  X(Jabra_GetRemoteMmiTypes) \
+  X(Jabra_FreeRemoteMmiTypes) \
+  X(Jabra_IsRemoteMmiInFocus) \
+  X(Jabra_GetRemoteMmiFocus) \
+  X(Jabra_ReleaseRemoteMmiFocus) \
+  X(Jabra_SetRemoteMmiAction) \
+  X(Jabra_RegisterRemoteMmiCallback) \
+  X(Jabra_GetPanics) \
+  X(Jabra_FreePanicListType) \
+  X(Jabra_SetTimestamp) \
+  X(Jabra_GetTimestamp) \
+  X(Jabra_PreloadDeviceInfo) \
+  X(Jabra_PlayRingtone) \
+  X(Jabra_SetJackConnectorStatusListener) \
+  X(Jabra_SetHeadDetectionStatusListener) \
+  X(Jabra_SetLinkConnectionStatusListener) \
+  X(Jabra_RebootDevice) \
+  X(Jabra_RegisterDectInfoHandler) \
+  X(Jabra_FreeDectInfoStr) \
+  X(Jabra_SetWhiteboardPosition) \
+  X(Jabra_GetWhiteboardPosition) \
+  X(Jabra_SetZoom) \
+  X(Jabra_GetZoom) \
+  X(Jabra_GetZoomLimits) \
+  X(Jabra_NewportRemoteManagementEnable) \
+  X(Jabra_IsNewportRemoteManagementEnabled) \
+  X(Jabra_SetXpressUrl) \
+  X(Jabra_GetXpressUrl) \
+  /* JabraDeviceConfig.h: */ \
+  X(Jabra_GetSetting) \
+  X(Jabra_GetSettings) \
+  X(Jabra_SetSettings) \
+  X(Jabra_FactoryReset) \
+  X(Jabra_FreeDeviceSettings) \
+  X(Jabra_FreeString) \
+  X(Jabra_SaveSettingsToFile) \
+  X(Jabra_LoadSettingsFromFile) \
+  X(Jabra_SaveSettingsToCloud) \
+  X(Jabra_GetCloudListOfConfigs) \
+  X(Jabra_FreeConfigList) \
+  X(Jabra_FreeInvalidList) \
+  X(Jabra_LoadSettingsFromCloud) \
+  X(Jabra_UpdateSettingsOfCloud) \
+  X(Jabra_DeleteSettingsOfCloud) \
+  X(Jabra_GetFailedSettingNames) \
+  X(Jabra_FreeFailedSettings) \
+  X(Jabra_IsFactoryResetSupported) \
+  X(Jabra_GetInvalidSettings) \
+  X(Jabra_GetNamedAsset) \
+  X(Jabra_FreeAsset) \
+  X(Jabra_SetSettingsChangeListener) \
+  /* JabraNativeHid.h: */ \
+  X(Jabra_WriteHIDCommand) \
+  X(Jabra_SetOffHook) \
+  X(Jabra_IsOffHookSupported) \
+  X(Jabra_SetRinger) \
+  X(Jabra_IsRingerSupported) \
+  X(Jabra_SetMute) \
+  X(Jabra_IsMuteSupported) \
+  X(Jabra_SetHold) \
+  X(Jabra_IsHoldSupported) \
+  X(Jabra_SetOnline) \
+  X(Jabra_IsOnlineSupported) \
+  X(Jabra_IsGnHidStdHidSupported) \
+  X(Jabra_GetHidWorkingState) \
+  X(Jabra_SetHidWorkingState)
+
+namespace jabralib {
+
+enum class Function : size_t {
+#define JABRA_LIBRARY_FUNCTION_ENUM(name) name,
+  JABRA_LIBRARY_FUNCTIONS(JABRA_LIBRARY_FUNCTION_ENUM)
+#undef JABRA_LIBRARY_FUNCTION_ENUM
+  COUNT
+};
+
+struct LibraryStats {
+  bool loaded;
+  std::string file;        // Loaded library, or the one that failed to load.
+  double loadMs;           // Time spent loading the library.
+  uint64_t resolved;       // Functions looked up so far.
+  double resolveMs;        // Total time spent looking up functions.
+  std::string error;       // Why loading failed (if it did).
+};
+
+/**
+ * Load libjabra from the directory of the addon (falling back to the default library search path) unless already
+ * loaded. Returns false with a diagnostic in error if the library could not be loaded. Thread-safe.
+ */
+bool load(std::string& error);
+
+/**
+ * Get a function of libjabra, loading the library first if needed. Throws JabraException if the library or the
+ * function is missing.
+ */
+void * resolve(Function function);
+
+LibraryStats getStats();
+
+extern std::atomic<void *> functions[static_cast<size_t>(Function::COUNT)];
+
+inline void * get(Function function) {
+  void * const address = functions[static_cast<size_t>(function)].load(std::memory_order_acquire);
+  return address ? address : resolve(function);
+}
+
+}
+
+#define JABRA_LAZY_FUNCTION(name) (reinterpret_cast<decltype(&name)>(::jabralib::get(::jabralib::Function::name)))
+
+// Common.h:
+#define Jabra_GetVersion JABRA_LAZY_FUNCTION(Jabra_GetVersion)
+#define Jabra_SetAppID JABRA_LAZY_FUNCTION(Jabra_SetAppID)
+#define Jabra_InitializeV2 JABRA_LAZY_FUNCTION(Jabra_InitializeV2)
+#define Jabra_Initialize JABRA_LAZY_FUNCTION(Jabra_Initialize)
+#define Jabra_Uninitialize JABRA_LAZY_FUNCTION(Jabra_Uninitialize)
+#define Jabra_SetHidEventsFromNonJabraDevices JABRA_LAZY_FUNCTION(Jabra_SetHidEventsFromNonJabraDevices)
+#define Jabra_IsHidEventsFromNonJabraDevicesEnabled JABRA_LAZY_FUNCTION(Jabra_IsHidEventsFromNonJabraDevicesEnabled)
+#define Jabra_SetStdHidEventsFromJabraDevices JABRA_LAZY_FUNCTION(Jabra_SetStdHidEventsFromJabraDevices)
+#define Jabra_IsStdHidEventsFromJabraDevicesEnabled JABRA_LAZY_FUNCTION(Jabra_IsStdHidEventsFromJabraDevicesEnabled)
+#define Jabra_IsFirstScanForDevicesDone JABRA_LAZY_FUNCTION(Jabra_IsFirstScanForDevicesDone)
+#define Jabra_IsDeviceAttached JABRA_LAZY_FUNCTION(Jabra_IsDeviceAttached)
+#define Jabra_GetAttachedJabraDevices JABRA_LAZY_FUNCTION(Jabra_GetAttachedJabraDevices)
+#define Jabra_FreeDeviceInfo JABRA_LAZY_FUNCTION(Jabra_FreeDeviceInfo)
+#define Jabra_GetSerialNumber JABRA_LAZY_FUNCTION(Jabra_GetSerialNumber)
+#define Jabra_GetESN JABRA_LAZY_FUNCTION(Jabra_GetESN)
+#define Jabra_GetSku JABRA_LAZY_FUNCTION(Jabra_GetSku)
+#define Jabra_GetHwAndConfigVersion JABRA_LAZY_FUNCTION(Jabra_GetHwAndConfigVersion)
+#define Jabra_GetMultiESN JABRA_LAZY_FUNCTION(Jabra_GetMultiESN)
+#define Jabra_FreeMap JABRA_LAZY_FUNCTION(Jabra_FreeMap)
+#define Jabra_GetFirmwareVersion JABRA_LAZY_FUNCTION(Jabra_GetFirmwareVersion)
+#define Jabra_GetCurrentLanguageCode JABRA_LAZY_FUNCTION(Jabra_GetCurrentLanguageCode)
+#define Jabra_GetDeviceImagePath JABRA_LAZY_FUNCTION(Jabra_GetDeviceImagePath)
+#define Jabra_GetDeviceImageThumbnailPath JABRA_LAZY_FUNCTION(Jabra_GetDeviceImageThumbnailPath)
+#define Jabra_GetBatteryStatusV2 JABRA_LAZY_FUNCTION(Jabra_GetBatteryStatusV2)
+#define Jabra_CopyJabraBatteryStatus JABRA_LAZY_FUNCTION(Jabra_CopyJabraBatteryStatus)
+#define Jabra_FreeBatteryStatus JABRA_LAZY_FUNCTION(Jabra_FreeBatteryStatus)
+#define Jabra_GetBatteryStatus JABRA_LAZY_FUNCTION(Jabra_GetBatteryStatus)
+#define Jabra_RegisterBatteryStatusUpdateCallbackV2 JABRA_LAZY_FUNCTION(Jabra_RegisterBatteryStatusUpdateCallbackV2)
+#define Jabra_RegisterBatteryStatusUpdateCallback JABRA_LAZY_FUNCTION(Jabra_RegisterBatteryStatusUpdateCallback)
+#define Jabra_GetWarrantyEndDate JABRA_LAZY_FUNCTION(Jabra_GetWarrantyEndDate)
+#define Jabra_ConnectToJabraApplication JABRA_LAZY_FUNCTION(Jabra_ConnectToJabraApplication)
+#define Jabra_DisconnectFromJabraApplication JABRA_LAZY_FUNCTION(Jabra_DisconnectFromJabraApplication)
+#define Jabra_SetSoftphoneReady JABRA_LAZY_FUNCTION(Jabra_SetSoftphoneReady)
+#define Jabra_IsSoftphoneInFocus JABRA_LAZY_FUNCTION(Jabra_IsSoftphoneInFocus)
+#define Jabra_SetBTPairing JABRA_LAZY_FUNCTION(Jabra_SetBTPairing)
+#define Jabra_SearchNewDevices JABRA_LAZY_FUNCTION(Jabra_SearchNewDevices)
+#define Jabra_GetSearchDeviceList JABRA_LAZY_FUNCTION(Jabra_GetSearchDeviceList)
+#define Jabra_StopBTPairing JABRA_LAZY_FUNCTION(Jabra_StopBTPairing)
+#define Jabra_SetAutoPairing JABRA_LAZY_FUNCTION(Jabra_SetAutoPairing)
+#define Jabra_GetAutoPairing JABRA_LAZY_FUNCTION(Jabra_GetAutoPairing)
+#define Jabra_ConnectBTDevice JABRA_LAZY_FUNCTION(Jabra_ConnectBTDevice)
+#define Jabra_ConnectNewDevice JABRA_LAZY_FUNCTION(Jabra_ConnectNewDevice)
+#define Jabra_DisconnectBTDevice JABRA_LAZY_FUNCTION(Jabra_DisconnectBTDevice)
+#define Jabra_ConnectPairedDevice JABRA_LAZY_FUNCTION(Jabra_ConnectPairedDevice)
+#define Jabra_DisConnectPairedDevice JABRA_LAZY_FUNCTION(Jabra_DisConnectPairedDevice)
+#define Jabra_GetConnectedBTDeviceName JABRA_LAZY_FUNCTION(Jabra_GetConnectedBTDeviceName)
+#define Jabra_IsPairingListSupported JABRA_LAZY_FUNCTION(Jabra_IsPairingListSupported)
+#define Jabra_GetSecureConnectionMode JABRA_LAZY_FUNCTION(Jabra_GetSecureConnectionMode)
+#define Jabra_GetPairingList JABRA_LAZY_FUNCTION(Jabra_GetPairingList)
+#define Jabra_ClearPairingList JABRA_LAZY_FUNCTION(Jabra_ClearPairingList)
+#define Jabra_FreePairingList JABRA_LAZY_FUNCTION(Jabra_FreePairingList)
+#define Jabra_ClearPairedDevice JABRA_LAZY_FUNCTION(Jabra_ClearPairedDevice)
+#define Jabra_RegisterPairingListCallback JABRA_LAZY_FUNCTION(Jabra_RegisterPairingListCallback)
+#define Jabra_GetErrorString JABRA_LAZY_FUNCTION(Jabra_GetErrorString)
+#define Jabra_GetReturnCodeString JABRA_LAZY_FUNCTION(Jabra_GetReturnCodeString)
+#define Jabra_IsBusylightSupported JABRA_LAZY_FUNCTION(Jabra_IsBusylightSupported)
+#define Jabra_GetBusylightStatus JABRA_LAZY_FUNCTION(Jabra_GetBusylightStatus)
+#define Jabra_SetBusylightStatus JABRA_LAZY_FUNCTION(Jabra_SetBusylightStatus)
+#define Jabra_RegisterBusylightEvent JABRA_LAZY_FUNCTION(Jabra_RegisterBusylightEvent)
+#define Jabra_IsLeftEarbudStatusSupported JABRA_LAZY_FUNCTION(Jabra_IsLeftEarbudStatusSupported)
+#define Jabra_GetLeftEarbudStatus JABRA_LAZY_FUNCTION(Jabra_GetLeftEarbudStatus)
+#define Jabra_RegisterLeftEarbudStatus JABRA_LAZY_FUNCTION(Jabra_RegisterLeftEarbudStatus)
+#define Jabra_RegisterHearThroughSettingChangeHandler JABRA_LAZY_FUNCTION(Jabra_RegisterHearThroughSettingChangeHandler)
+#define Jabra_IsEqualizerSupported JABRA_LAZY_FUNCTION(Jabra_IsEqualizerSupported)
+#define Jabra_IsEqualizerEnabled JABRA_LAZY_FUNCTION(Jabra_IsEqualizerEnabled)
+#define Jabra_EnableEqualizer JABRA_LAZY_FUNCTION(Jabra_EnableEqualizer)
+#define Jabra_GetEqualizerParameters JABRA_LAZY_FUNCTION(Jabra_GetEqualizerParameters)
+#define Jabra_SetEqualizerParameters JABRA_LAZY_FUNCTION(Jabra_SetEqualizerParameters)
+#define Jabra_IsRemoteMMISupported JABRA_LAZY_FUNCTION(Jabra_IsRemoteMMISupported)
+#define Jabra_GetButtonFocus JABRA_LAZY_FUNCTION(Jabra_GetButtonFocus)
+#define Jabra_ReleaseButtonFocus JABRA_LAZY_FUNCTION(Jabra_ReleaseButtonFocus)
+#define Jabra_GetSupportedButtonEvents JABRA_LAZY_FUNCTION(Jabra_GetSupportedButtonEvents)
+#define Jabra_FreeButtonEvents JABRA_LAZY_FUNCTION(Jabra_FreeButtonEvents)
+#define Jabra_RegisterForGNPButtonEvent JABRA_LAZY_FUNCTION(Jabra_RegisterForGNPButtonEvent)
+#define Jabra_IsSettingProtectionEnabled JABRA_LAZY_FUNCTION(Jabra_IsSettingProtectionEnabled)
+#define Jabra_GetCustomerSupportUrl JABRA_LAZY_FUNCTION(Jabra_GetCustomerSupportUrl)
+#define Jabra_GetNpsUrlForApplication JABRA_LAZY_FUNCTION(Jabra_GetNpsUrlForApplication)
+#define Jabra_GetNpsUrl JABRA_LAZY_FUNCTION(Jabra_GetNpsUrl)
+#define Jabra_ProductRegistration JABRA_LAZY_FUNCTION(Jabra_ProductRegistration)
+#define Jabra_ExecuteAVRCPCommand JABRA_LAZY_FUNCTION(Jabra_ExecuteAVRCPCommand)
+#define Jabra_ConfigureLogging JABRA_LAZY_FUNCTION(Jabra_ConfigureLogging)
+#define Jabra_RegisterLoggingCallback JABRA_LAZY_FUNCTION(Jabra_RegisterLoggingCallback)
+#define Jabra_RegisterDevLogCallback JABRA_LAZY_FUNCTION(Jabra_RegisterDevLogCallback)
+#define Jabra_EnableDevLog JABRA_LAZY_FUNCTION(Jabra_EnableDevLog)
+#define Jabra_IsDevLogEnabled JABRA_LAZY_FUNCTION(Jabra_IsDevLogEnabled)
+#define Jabra_IsFirmwareLockEnabled JABRA_LAZY_FUNCTION(Jabra_IsFirmwareLockEnabled)
+#define Jabra_EnableFirmwareLock JABRA_LAZY_FUNCTION(Jabra_EnableFirmwareLock)
+#define Jabra_CheckForFirmwareUpdate JABRA_LAZY_FUNCTION(Jabra_CheckForFirmwareUpdate)
+#define Jabra_GetLatestFirmwareInformation JABRA_LAZY_FUNCTION(Jabra_GetLatestFirmwareInformation)
+#define Jabra_FreeFirmwareInfo JABRA_LAZY_FUNCTION(Jabra_FreeFirmwareInfo)
+#define Jabra_GetFirmwareFilePath JABRA_LAZY_FUNCTION(Jabra_GetFirmwareFilePath)
+#define Jabra_GetAllFirmwareInformation JABRA_LAZY_FUNCTION(Jabra_GetAllFirmwareInformation)
+#define Jabra_FreeFirmwareInfoList JABRA_LAZY_FUNCTION(Jabra_FreeFirmwareInfoList)
+#define Jabra_DownloadFirmware JABRA_LAZY_FUNCTION(Jabra_DownloadFirmware)
+#define Jabra_DownloadFirmwareUpdater JABRA_LAZY_FUNCTION(Jabra_DownloadFirmwareUpdater)
+#define Jabra_UpdateFirmware JABRA_LAZY_FUNCTION(Jabra_UpdateFirmware)
+#define Jabra_CancelFirmwareDownload JABRA_LAZY_FUNCTION(Jabra_CancelFirmwareDownload)
+#define Jabra_RegisterFirmwareProgressCallBack JABRA_LAZY_FUNCTION(Jabra_RegisterFirmwareProgressCallBack)
+#define Jabra_Reconnect JABRA_LAZY_FUNCTION(Jabra_Reconnect)
+#define Jabra_IsFeatureSupported JABRA_LAZY_FUNCTION(Jabra_IsFeatureSupported)
+#define Jabra_GetSupportedFeatures JABRA_LAZY_FUNCTION(Jabra_GetSupportedFeatures)
+#define Jabra_FreeSupportedFeatures JABRA_LAZY_FUNCTION(Jabra_FreeSupportedFeatures)
+#define Jabra_RequestNoHangupToneNextTime JABRA_LAZY_FUNCTION(Jabra_RequestNoHangupToneNextTime)
+#define Jabra_IsCertifiedForSkypeForBusiness JABRA_LAZY_FUNCTION(Jabra_IsCertifiedForSkypeForBusiness)
+#define Jabra_FreeCharArray JABRA_LAZY_FUNCTION(Jabra_FreeCharArray)
+#define Jabra_IsUploadRingtoneSupported JABRA_LAZY_FUNCTION(Jabra_IsUploadRingtoneSupported)
+#define Jabra_UploadRingtone JABRA_LAZY_FUNCTION(Jabra_UploadRingtone)
+#define Jabra_UploadWavRingtone JABRA_LAZY_FUNCTION(Jabra_UploadWavRingtone)
+#define Jabra_GetAudioFileParametersForUpload JABRA_LAZY_FUNCTION(Jabra_GetAudioFileParametersForUpload)
+#define Jabra_RegisterUploadProgress JABRA_LAZY_FUNCTION(Jabra_RegisterUploadProgress)
+#define Jabra_IsUploadImageSupported JABRA_LAZY_FUNCTION(Jabra_IsUploadImageSupported)
+#define Jabra_UploadImage JABRA_LAZY_FUNCTION(Jabra_UploadImage)
+#define Jabra_SetWizardMode JABRA_LAZY_FUNCTION(Jabra_SetWizardMode)
+#define Jabra_GetWizardMode JABRA_LAZY_FUNCTION(Jabra_GetWizardMode)
+#define Jabra_IsSetDateTimeSupported JABRA_LAZY_FUNCTION(Jabra_IsSetDateTimeSupported)
+#define Jabra_SetDateTime JABRA_LAZY_FUNCTION(Jabra_SetDateTime)
+#define Jabra_GetSupportedDeviceEvents JABRA_LAZY_FUNCTION(Jabra_GetSupportedDeviceEvents)
+#define Jabra_SetSubscribedDeviceEvents JABRA_LAZY_FUNCTION(Jabra_SetSubscribedDeviceEvents)
+#define Jabra_GetRemoteMmiTypes JABRA_LAZY_FUNCTION(Jabra_GetRemoteMmiTypes)
+#define Jabra_FreeRemoteMmiTypes JABRA_LAZY_FUNCTION(Jabra_FreeRemoteMmiTypes)
+#define Jabra_IsRemoteMmiInFocus JABRA_LAZY_FUNCTION(Jabra_IsRemoteMmiInFocus)
+#define Jabra_GetRemoteMmiFocus JABRA_LAZY_FUNCTION(Jabra_GetRemoteMmiFocus)
+#define Jabra_ReleaseRemoteMmiFocus JABRA_LAZY_FUNCTION(Jabra_ReleaseRemoteMmiFocus)
+#define Jabra_SetRemoteMmiAction JABRA_LAZY_FUNCTION(Jabra_SetRemoteMmiAction)
+#define Jabra_RegisterRemoteMmiCallback JABRA_LAZY_FUNCTION(Jabra_RegisterRemoteMmiCallback)
+#define Jabra_GetPanics JABRA_LAZY_FUNCTION(Jabra_GetPanics)
+#define Jabra_FreePanicListType JABRA_LAZY_FUNCTION(Jabra_FreePanicListType)
+#define Jabra_SetTimestamp JABRA_LAZY_FUNCTION(Jabra_SetTimestamp)
+#define Jabra_GetTimestamp JABRA_LAZY_FUNCTION(Jabra_GetTimestamp)
+#define Jabra_PreloadDeviceInfo JABRA_LAZY_FUNCTION(Jabra_PreloadDeviceInfo)
+#define Jabra_PlayRingtone JABRA_LAZY_FUNCTION(Jabra_PlayRingtone)
+#define Jabra_SetJackConnectorStatusListener JABRA_LAZY_FUNCTION(Jabra_SetJackConnectorStatusListener)
+#define Jabra_SetHeadDetectionStatusListener JABRA_LAZY_FUNCTION(Jabra_SetHeadDetectionStatusListener)
+#define Jabra_SetLinkConnectionStatusListener JABRA_LAZY_FUNCTION(Jabra_SetLinkConnectionStatusListener)
+#define Jabra_RebootDevice JABRA_LAZY_FUNCTION(Jabra_RebootDevice)
+#define Jabra_RegisterDectInfoHandler JABRA_LAZY_FUNCTION(Jabra_RegisterDectInfoHandler)
+#define Jabra_FreeDectInfoStr JABRA_LAZY_FUNCTION(Jabra_FreeDectInfoStr)
+#define Jabra_SetWhiteboardPosition JABRA_LAZY_FUNCTION(Jabra_SetWhiteboardPosition)
+#define Jabra_GetWhiteboardPosition JABRA_LAZY_FUNCTION(Jabra_GetWhiteboardPosition)
+#define Jabra_SetZoom JABRA_LAZY_FUNCTION(Jabra_SetZoom)
+#define Jabra_GetZoom JABRA_LAZY_FUNCTION(Jabra_GetZoom)
+#define Jabra_GetZoomLimits JABRA_LAZY_FUNCTION(Jabra_GetZoomLimits)
+#define Jabra_NewportRemoteManagementEnable JABRA_LAZY_FUNCTION(Jabra_NewportRemoteManagementEnable)
+#define Jabra_IsNewportRemoteManagementEnabled JABRA_LAZY_FUNCTION(Jabra_IsNewportRemoteManagementEnabled)
+#define Jabra_SetXpressUrl JABRA_LAZY_FUNCTION(Jabra_SetXpressUrl)
+#define Jabra_GetXpressUrl JABRA_LAZY_FUNCTION(Jabra_GetXpressUrl)
+
+// JabraDeviceConfig.h:
+#define Jabra_GetSetting JABRA_LAZY_FUNCTION(Jabra_GetSetting)
+#define Jabra_GetSettings JABRA_LAZY_FUNCTION(Jabra_GetSettings)
+#define Jabra_SetSettings JABRA_LAZY_FUNCTION(Jabra_SetSettings)
+#define Jabra_FactoryReset JABRA_LAZY_FUNCTION(Jabra_FactoryReset)
+#define Jabra_FreeDeviceSettings JABRA_LAZY_FUNCTION(Jabra_FreeDeviceSettings)
+#define Jabra_FreeString JABRA_LAZY_FUNCTION(Jabra_FreeString)
+#define Jabra_SaveSettingsToFile JABRA_LAZY_FUNCTION(Jabra_SaveSettingsToFile)
+#define Jabra_LoadSettingsFromFile JABRA_LAZY_FUNCTION(Jabra_LoadSettingsFromFile)
+#define Jabra_SaveSettingsToCloud JABRA_LAZY_FUNCTION(Jabra_SaveSettingsToCloud)
+#define Jabra_GetCloudListOfConfigs JABRA_LAZY_FUNCTION(Jabra_GetCloudListOfConfigs)
+#define Jabra_FreeConfigList JABRA_LAZY_FUNCTION(Jabra_FreeConfigList)
+#define Jabra_FreeInvalidList JABRA_LAZY_FUNCTION(Jabra_FreeInvalidList)
+#define Jabra_LoadSettingsFromCloud JABRA_LAZY_FUNCTION(Jabra_LoadSettingsFromCloud)
+#define Jabra_UpdateSettingsOfCloud JABRA_LAZY_FUNCTION(Jabra_UpdateSettingsOfCloud)
+#define Jabra_DeleteSettingsOfCloud JABRA_LAZY_FUNCTION(Jabra_DeleteSettingsOfCloud)
+#define Jabra_GetFailedSettingNames JABRA_LAZY_FUNCTION(Jabra_GetFailedSettingNames)
+#define Jabra_FreeFailedSettings JABRA_LAZY_FUNCTION(Jabra_FreeFailedSettings)
+#define Jabra_IsFactoryResetSupported JABRA_LAZY_FUNCTION(Jabra_IsFactoryResetSupported)
+#define Jabra_GetInvalidSettings JABRA_LAZY_FUNCTION(Jabra_GetInvalidSettings)
+#define Jabra_GetNamedAsset JABRA_LAZY_FUNCTION(Jabra_GetNamedAsset)
+#define Jabra_FreeAsset JABRA_LAZY_FUNCTION(Jabra_FreeAsset)
+#define Jabra_SetSettingsChangeListener JABRA_LAZY_FUNCTION(Jabra_SetSettingsChangeListener)
+
+// JabraNativeHid.h:
+#define Jabra_WriteHIDCommand JABRA_LAZY_FUNCTION(Jabra_WriteHIDCommand)
+#define Jabra_SetOffHook JABRA_LAZY_FUNCTION(Jabra_SetOffHook)
+#define Jabra_IsOffHookSupported JABRA_LAZY_FUNCTION(Jabra_IsOffHookSupported)
+#define Jabra_SetRinger JABRA_LAZY_FUNCTION(Jabra_SetRinger)
+#define Jabra_IsRingerSupported JABRA_LAZY_FUNCTION(Jabra_IsRingerSupported)
+#define Jabra_SetMute JABRA_LAZY_FUNCTION(Jabra_SetMute)
+#define Jabra_IsMuteSupported JABRA_LAZY_FUNCTION(Jabra_IsMuteSupported)
+#define Jabra_SetHold JABRA_LAZY_FUNCTION(Jabra_SetHold)
+#define Jabra_IsHoldSupported JABRA_LAZY_FUNCTION(Jabra_IsHoldSupported)
+#define Jabra_SetOnline JABRA_LAZY_FUNCTION(Jabra_SetOnline)
+#define Jabra_IsOnlineSupported JABRA_LAZY_FUNCTION(Jabra_IsOnlineSupported)
+#define Jabra_IsGnHidStdHidSupported JABRA_LAZY_FUNCTION(Jabra_IsGnHidStdHidSupported)
+#define Jabra_GetHidWorkingState JABRA_LAZY_FUNCTION(Jabra_GetHidWorkingState)
+#define Jabra_SetHidWorkingState JABRA_LAZY_FUNCTION(Jabra_SetHidWorkingState)
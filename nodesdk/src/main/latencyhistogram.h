@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace util {
+
+/**
+ * Monotonic time in nanoseconds (steady clock - only meaningful for measuring intervals).
+ */
+inline uint64_t monotonicTimeNs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Snapshot of a LatencyHistogram.
+ */
+struct LatencyHistogramSnapshot {
+    static const size_t BUCKET_COUNT = 24;
+
+    uint64_t count;
+    uint64_t totalNs;
+    uint64_t maxNs;
+    // Bucket 0 counts latencies below 1 us, bucket i > 0 latencies from 2^(i-1) up to 2^i us, and the last bucket
+    // everything longer.
+    uint64_t buckets[BUCKET_COUNT];
+};
+
+/**
+ * Histogram of latencies with power of two microsecond buckets. Can be updated from any thread without locking.
+ */
+class LatencyHistogram {
+  public:
+    static const size_t BUCKET_COUNT = LatencyHistogramSnapshot::BUCKET_COUNT;
+
+    LatencyHistogram() : count(0), totalNs(0), maxNs(0) {
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            buckets[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    /**
+     * Add the latency between two monotonicTimeNs() values (ignored if 'from' is unknown, i.e. 0).
+     */
+    void add(uint64_t fromNs, uint64_t toNs) {
+        if (fromNs == 0) {
+            return;
+        }
+        const uint64_t latencyNs = toNs > fromNs ? toNs - fromNs : 0;
+
+        size_t bucket = 0;
+        for (uint64_t us = latencyNs / 1000; us > 0 && bucket < BUCKET_COUNT - 1; us >>= 1) {
+            ++bucket;
+        }
+
+        buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+        totalNs.fetch_add(latencyNs, std::memory_order_relaxed);
+        uint64_t max = maxNs.load(std::memory_order_relaxed);
+        while (latencyNs > max && !maxNs.compare_exchange_weak(max, latencyNs, std::memory_order_relaxed)) {
+        }
+    }
+
+    LatencyHistogramSnapshot getSnapshot() const {
+        LatencyHistogramSnapshot snapshot;
+        snapshot.count = count.load(std::memory_order_relaxed);
+        snapshot.totalNs = totalNs.load(std::memory_order_relaxed);
+        snapshot.maxNs = maxNs.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            snapshot.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+        }
+        return snapshot;
+    }
+
+  private:
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> totalNs;
+    std::atomic<uint64_t> maxNs;
+    std::atomic<uint64_t> buckets[BUCKET_COUNT];
+};
+
+} // namespace util
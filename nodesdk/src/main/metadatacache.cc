@@ -0,0 +1,213 @@
+#include "metadatacache.h"
+
+DeviceMetadataCache& DeviceMetadataCache::instance() {
+  static DeviceMetadataCache cache;
+  return cache;
+}
+
+DeviceMetadataCache::DeviceMetadataCache() : directory(), maxSizeBytes(DEFAULT_MAX_SIZE_BYTES), libraryVersion(),
+  sizeBytes(0), fileCount(0), hitCount(0), missCount(0), corruptCount(0), writeCount(0), writeErrorCount(0), evictedCount(0) {
+}
+
+void DeviceMetadataCache::configure(Napi::Object& config) {
+  std::string configuredDirectory = util::getObjStringOrDefault(config, "metadataCacheDir", "");
+  while (configuredDirectory.size() > 1 && (configuredDirectory.back() == '/' || configuredDirectory.back() == '\\')) {
+    configuredDirectory.pop_back();
+  }
+  const int32_t configuredMaxSizeBytes = util::getObjInt32OrDefault(config, "metadataCacheMaxSizeBytes", DEFAULT_MAX_SIZE_BYTES);
+
+  if (!configuredDirectory.empty() && !MetadataFile::createDirectory(configuredDirectory)) {
+    LOG_WARNING_(LOGINSTANCE) << "DeviceMetadataCache: could not create directory " << configuredDirectory << " - cache disabled";
+    configuredDirectory.clear();
+  }
+
+  // Metadata may change with the libjabra version too, so it is part of the key:
+  std::string version;
+  if (!configuredDirectory.empty()) {
+    char buffer[64] = "";
+    if (Jabra_GetVersion(&buffer[0], sizeof(buffer)) == Return_Ok) {
+      version = buffer;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  directory = configuredDirectory;
+  maxSizeBytes = configuredMaxSizeBytes > 0 ? (uint64_t)configuredMaxSizeBytes : DEFAULT_MAX_SIZE_BYTES;
+  libraryVersion = version;
+}
+
+void DeviceMetadataCache::loadDevice(unsigned short deviceId, unsigned short productId) {
+  const uint64_t startNs = util::monotonicTimeNs();
+
+  Metadata metadata;
+  metadata.productId = productId;
+  std::string cacheDirectory;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    cacheDirectory = directory;
+    metadata.libraryVersion = libraryVersion;
+  }
+
+  if (!cacheDirectory.empty()) {
+    char firmwareVersion[64];
+    const Jabra_ReturnCode retv = Jabra_GetFirmwareVersion(deviceId, &firmwareVersion[0], sizeof(firmwareVersion));
+    if (retv == Return_Ok) {
+      metadata.firmwareVersion = firmwareVersion;
+    } else {
+      LOG_WARNING_(LOGINSTANCE) << "DeviceMetadataCache: no firmware version of device #" << deviceId << " (Jabra_SDK error "
+                                << retv << ") - metadata not cached";
+      cacheDirectory.clear();
+    }
+  }
+
+  if (!cacheDirectory.empty() && read(cacheDirectory, metadata)) {
+    metadata.persistent = true;
+    DeviceCapabilityCache::instance().set(deviceId, metadata.capabilities);
+    DeviceButtonCatalogue::instance().set(deviceId, metadata.buttonTypes);
+    hitLatency.add(startNs, util::monotonicTimeNs());
+
+    LOG_VERBOSE_(LOGINSTANCE) << "DeviceMetadataCache: read metadata of device #" << deviceId << " from disk";
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ++hitCount;
+    devices[deviceId] = std::move(metadata);
+    return;
+  }
+
+  metadata.capabilities = DeviceCapabilityCache::instance().load(deviceId);
+  metadata.buttonTypes = DeviceButtonCatalogue::instance().load(deviceId);
+  metadata.persistent = !cacheDirectory.empty();
+
+  if (metadata.persistent) {
+    write(cacheDirectory, metadata);
+    missLatency.add(startNs, util::monotonicTimeNs());
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (metadata.persistent) {
+    ++missCount;
+  }
+  devices[deviceId] = std::move(metadata);
+}
+
+std::shared_ptr<const SettingSchema> DeviceMetadataCache::getSettingSchema(unsigned short deviceId) {
+  std::lock_guard<std::mutex> lock(mutex);
+  const auto found = devices.find(deviceId);
+  return found != devices.end() ? found->second.settingSchema : nullptr;
+}
+
+std::shared_ptr<const SettingSchema> DeviceMetadataCache::storeSettings(unsigned short deviceId, const DeviceSettings& settings) {
+  std::shared_ptr<const SettingSchema> known;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto found = devices.find(deviceId);
+    if (found != devices.end()) {
+      known = found->second.settingSchema;
+    }
+  }
+  if (known && known->matches(settings)) {
+    return known; // The usual case - nothing to build.
+  }
+
+  auto schema = std::make_shared<SettingSchema>(SettingSchema::fromDeviceSettings(settings));
+  schema->revision = known ? known->revision + 1 : 1;
+
+  std::string cacheDirectory;
+  Metadata metadata;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto found = devices.find(deviceId);
+    if (found == devices.end()) {
+      schema->revision = 0; // Detached meanwhile, or not loaded (in firmware update mode) - not cached.
+      return schema;
+    }
+    if (found->second.settingSchema != known) {
+      return found->second.settingSchema; // Stored by another thread meanwhile.
+    }
+    found->second.settingSchema = schema;
+    if (!found->second.persistent || directory.empty()) {
+      return schema;
+    }
+    cacheDirectory = directory;
+    metadata = found->second;
+  }
+
+  write(cacheDirectory, metadata);
+  return schema;
+}
+
+void DeviceMetadataCache::remove(unsigned short deviceId) {
+  std::lock_guard<std::mutex> lock(mutex);
+  devices.erase(deviceId);
+}
+
+void DeviceMetadataCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  devices.clear();
+}
+
+bool DeviceMetadataCache::read(const std::string& directory, Metadata& metadata) {
+  switch (MetadataFile::read(directory, metadata)) {
+    case MetadataFile::ReadResult::READ:
+      return true;
+    case MetadataFile::ReadResult::DROPPED:
+      break;
+    default:
+      return false; // Not cached yet.
+  }
+
+  LOG_WARNING_(LOGINSTANCE) << "DeviceMetadataCache: dropping invalid cache file " << MetadataFile::path(directory, metadata);
+  std::lock_guard<std::mutex> lock(mutex);
+  ++corruptCount;
+  return false;
+}
+
+void DeviceMetadataCache::write(const std::string& directory, const Metadata& metadata) {
+  uint64_t limit;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    limit = maxSizeBytes;
+  }
+
+  MetadataFile::WriteResult result;
+  {
+    std::lock_guard<std::mutex> fileLock(fileMutex);
+    result = MetadataFile::write(directory, metadata, limit);
+  }
+
+  if (result.written) {
+    LOG_VERBOSE_(LOGINSTANCE) << "DeviceMetadataCache: wrote " << MetadataFile::path(directory, metadata);
+  } else {
+    LOG_WARNING_(LOGINSTANCE) << "DeviceMetadataCache: could not write " << MetadataFile::path(directory, metadata);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (result.written) {
+    ++writeCount;
+  } else {
+    ++writeErrorCount;
+  }
+  evictedCount += result.evicted;
+  sizeBytes = result.sizeBytes;
+  fileCount = result.fileCount;
+}
+
+MetadataCacheStats DeviceMetadataCache::getStats() {
+  MetadataCacheStats stats;
+  stats.hitLatency = hitLatency.getSnapshot();
+  stats.missLatency = missLatency.getSnapshot();
+
+  std::lock_guard<std::mutex> lock(mutex);
+  stats.enabled = !directory.empty();
+  stats.directory = directory;
+  stats.maxSizeBytes = maxSizeBytes;
+  stats.sizeBytes = sizeBytes;
+  stats.fileCount = fileCount;
+  stats.hits = hitCount;
+  stats.misses = missCount;
+  stats.corrupt = corruptCount;
+  stats.writes = writeCount;
+  stats.writeErrors = writeErrorCount;
+  stats.evicted = evictedCount;
+  return stats;
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "stdafx.h"
+#include "latencyhistogram.h"
+#include "metadatafile.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Counters of the device metadata cache (for diagnostics only).
+ */
+struct MetadataCacheStats {
+  bool enabled;
+  std::string directory;
+  uint64_t maxSizeBytes;
+  uint64_t sizeBytes;      // Size of the cache files as of the last write.
+  uint64_t fileCount;      // Number of cache files as of the last write.
+  uint64_t hits;           // Attached devices whose metadata was read from disk.
+  uint64_t misses;         // Attached devices whose metadata had to be fetched from libjabra.
+  uint64_t corrupt;        // Cache files dropped as unreadable, corrupt or of another format version.
+  uint64_t writes;
+  uint64_t writeErrors;
+  uint64_t evicted;        // Cache files removed to stay within maxSizeBytes.
+  util::LatencyHistogramSnapshot hitLatency;
+  util::LatencyHistogramSnapshot missLatency;
+};
+
+/**
+ * Persistent cache of the static metadata of devices (capabilities and supported features, button catalogue and
+ * settings schema), which is the same for all devices with the same product ID and firmware version. Lets a warm
+ * start skip the libjabra calls for it when devices are attached, so only current values need to be fetched.
+ *
+ * There is one file per (product ID, firmware version, libjabra version) in the configured directory (see
+ * MetadataFile). Files that fail any check are dropped and rebuilt. The least recently used files are evicted when
+ * the directory grows beyond the configured size.
+ *
+ * Without a configured directory, the metadata is only kept in memory while devices stay attached.
+ *
+ * Thread-safe: Used from sdk executor threads (devices are loaded by AttachPrefetch on their strand).
+ */
+class DeviceMetadataCache {
+  public:
+    static const uint32_t DEFAULT_MAX_SIZE_BYTES = 16 * 1024 * 1024;
+
+    static DeviceMetadataCache& instance();
+
+    /**
+     * Set up the cache from the native config params (metadataCacheDir, metadataCacheMaxSizeBytes).
+     */
+    void configure(Napi::Object& config);
+
+    /**
+     * Fill the DeviceCapabilityCache and DeviceButtonCatalogue for a newly attached device, from disk if the
+     * product ID and firmware version have been seen before, else from libjabra (and then write them to disk).
+     */
+    void loadDevice(unsigned short deviceId, unsigned short productId);
+
+    /**
+     * The settings schema of an attached device, if known from disk or from a previous storeSettings, else nullptr.
+     */
+    std::shared_ptr<const SettingSchema> getSettingSchema(unsigned short deviceId);
+
+    /**
+     * Remember the schema of settings fetched with Jabra_GetSettings for an attached device and write it to disk,
+     * unless the same schema is already known. A different schema replaces the known one with the next revision.
+     * Returns the schema in effect (not remembered if the device is not loaded).
+     */
+    std::shared_ptr<const SettingSchema> storeSettings(unsigned short deviceId, const DeviceSettings& settings);
+
+    /**
+     * Forget a detached device (its files are kept).
+     */
+    void remove(unsigned short deviceId);
+
+    /**
+     * Forget all devices (on uninitialize).
+     */
+    void clear();
+
+    MetadataCacheStats getStats();
+
+  private:
+    struct Metadata : DeviceMetadata {
+      bool persistent; // Written to disk (directory configured and firmware known).
+    };
+
+    DeviceMetadataCache();
+    DeviceMetadataCache(const DeviceMetadataCache&) = delete;
+    DeviceMetadataCache& operator=(const DeviceMetadataCache&) = delete;
+
+    /**
+     * Read the cache file of metadata.productId and metadata.firmwareVersion into metadata. Drops the file if corrupt.
+     */
+    bool read(const std::string& directory, Metadata& metadata);
+
+    /**
+     * Write (or replace) the cache file of the metadata, then evict files beyond the size limit.
+     */
+    void write(const std::string& directory, const Metadata& metadata);
+
+    util::LatencyHistogram hitLatency;
+    util::LatencyHistogram missLatency;
+
+    // Serializes file writes and evictions of this process (see MetadataFile).
+    std::mutex fileMutex;
+
+    // Guards everything below.
+    std::mutex mutex;
+    std::string directory; // Empty = disabled.
+    uint64_t maxSizeBytes;
+    std::string libraryVersion;
+    std::unordered_map<unsigned short, Metadata> devices;
+    uint64_t sizeBytes;
+    uint64_t fileCount;
+    uint64_t hitCount;
+    uint64_t missCount;
+    uint64_t corruptCount;
+    uint64_t writeCount;
+    uint64_t writeErrorCount;
+    uint64_t evictedCount;
+};
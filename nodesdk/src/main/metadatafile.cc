@@ -0,0 +1,557 @@
+#include "metadatafile.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+// Cache file layout: FileHeader followed by payloadSize bytes of payload (see writeMetadata), in native byte order
+// as the files are never shared between machines. Bump FORMAT_VERSION on any change to the layout.
+static const char FILE_MAGIC[4] = { 'J', 'M', 'D', 'C' };
+static const uint32_t FORMAT_VERSION = 1;
+static const char * const FILE_EXTENSION = ".jmdc";
+
+struct FileHeader {
+  char magic[4];
+  uint32_t formatVersion;
+  uint32_t payloadSize;
+  uint32_t crc;           // CRC-32 of the payload.
+};
+
+static uint32_t crc32(const uint8_t * data, size_t size) {
+  static const std::array<uint32_t, 256> table = [] {
+    std::array<uint32_t, 256> result;
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t crc = i;
+      for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc & 1) ? 0xEDB88320u ^ (crc >> 1) : crc >> 1;
+      }
+      result[i] = crc;
+    }
+    return result;
+  }();
+
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < size; ++i) {
+    crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+static uint32_t fnv1a(const std::string& text) {
+  uint32_t hash = 2166136261u;
+  for (const char c : text) {
+    hash = (hash ^ (uint8_t)c) * 16777619u;
+  }
+  return hash;
+}
+
+/**
+ * Appends values to a cache file payload.
+ */
+class PayloadWriter {
+  public:
+    void u8(uint8_t value) {
+      buffer.push_back((char)value);
+    }
+
+    void u16(uint16_t value) {
+      buffer.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    void u32(uint32_t value) {
+      buffer.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    void i32(int32_t value) {
+      buffer.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    void str(const std::string& value) {
+      u32((uint32_t)value.size());
+      buffer.append(value);
+    }
+
+    std::string buffer;
+};
+
+/**
+ * Reads values of a cache file payload. Reading beyond the end fails the reader instead of throwing, so corrupt files
+ * can be detected with a single check of good() at the end.
+ */
+class PayloadReader {
+  public:
+    PayloadReader(const uint8_t * data, size_t size) : pos(data), end(data + size), ok(true) {
+    }
+
+    uint8_t u8() {
+      uint8_t value = 0;
+      take(&value, sizeof(value));
+      return value;
+    }
+
+    uint16_t u16() {
+      uint16_t value = 0;
+      take(&value, sizeof(value));
+      return value;
+    }
+
+    uint32_t u32() {
+      uint32_t value = 0;
+      take(&value, sizeof(value));
+      return value;
+    }
+
+    int32_t i32() {
+      int32_t value = 0;
+      take(&value, sizeof(value));
+      return value;
+    }
+
+    std::string str() {
+      const uint32_t size = u32();
+      if (!ok || size > (size_t)(end - pos)) {
+        ok = false;
+        return "";
+      }
+      std::string value(reinterpret_cast<const char *>(pos), size);
+      pos += size;
+      return value;
+    }
+
+    /**
+     * Read an item count, failing if the remaining payload can not possibly hold that many items of minItemSize
+     * bytes (so a corrupt count never leads to a huge allocation).
+     */
+    uint32_t count(size_t minItemSize) {
+      const uint32_t value = u32();
+      if (!ok || (uint64_t)value * minItemSize > (uint64_t)(end - pos)) {
+        ok = false;
+        return 0;
+      }
+      return value;
+    }
+
+    bool good() const {
+      return ok && pos == end;
+    }
+
+  private:
+    void take(void * dest, size_t size) {
+      if (!ok || size > (size_t)(end - pos)) {
+        ok = false;
+        return;
+      }
+      memcpy(dest, pos, size);
+      pos += size;
+    }
+
+    const uint8_t * pos;
+    const uint8_t * const end;
+    bool ok;
+};
+
+/**
+ * Read-only memory mapping of a whole file (data() is nullptr if the file could not be mapped).
+ */
+class MappedFile {
+  public:
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const uint8_t * data() const {
+      return mapped;
+    }
+
+    size_t size() const {
+      return mappedSize;
+    }
+
+  private:
+    const uint8_t * mapped;
+    size_t mappedSize;
+};
+
+struct CacheFile {
+  std::string path;
+  uint64_t size;
+  int64_t lastUsed; // Modification time, updated on each hit.
+};
+
+#ifdef _WIN32
+MappedFile::MappedFile(const std::string& path) : mapped(nullptr), mappedSize(0) {
+  // Share delete access, so other processes can still replace or evict the file while it is mapped:
+  const HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    return;
+  }
+  LARGE_INTEGER size;
+  if (GetFileSizeEx(file, &size) && size.QuadPart > 0 && (uint64_t)size.QuadPart <= SIZE_MAX) {
+    const HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping) {
+      mapped = static_cast<const uint8_t *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+      mappedSize = mapped ? (size_t)size.QuadPart : 0;
+      CloseHandle(mapping); // The view keeps the mapping alive.
+    }
+  }
+  CloseHandle(file);
+}
+
+MappedFile::~MappedFile() {
+  if (mapped) {
+    UnmapViewOfFile(mapped);
+  }
+}
+
+bool MetadataFile::createDirectory(const std::string& directory) {
+  return CreateDirectoryA(directory.c_str(), NULL) || GetLastError() == ERROR_ALREADY_EXISTS;
+}
+
+static void touch(const std::string& path) {
+  const HANDLE file = CreateFileA(path.c_str(), FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                  NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file != INVALID_HANDLE_VALUE) {
+    FILETIME now;
+    GetSystemTimeAsFileTime(&now);
+    SetFileTime(file, NULL, NULL, &now);
+    CloseHandle(file);
+  }
+}
+
+static bool replaceFile(const std::string& from, const std::string& to) {
+  return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+}
+
+static int processId() {
+  return (int)GetCurrentProcessId();
+}
+
+static std::vector<CacheFile> listCacheFiles(const std::string& directory) {
+  std::vector<CacheFile> result;
+  WIN32_FIND_DATAA found;
+  const HANDLE search = FindFirstFileA((directory + "/*" + FILE_EXTENSION).c_str(), &found);
+  if (search == INVALID_HANDLE_VALUE) {
+    return result;
+  }
+  do {
+    if (!(found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+      result.push_back({ directory + "/" + found.cFileName,
+                         ((uint64_t)found.nFileSizeHigh << 32) | found.nFileSizeLow,
+                         (int64_t)(((uint64_t)found.ftLastWriteTime.dwHighDateTime << 32) | found.ftLastWriteTime.dwLowDateTime) });
+    }
+  } while (FindNextFileA(search, &found));
+  FindClose(search);
+  return result;
+}
+#else
+MappedFile::MappedFile(const std::string& path) : mapped(nullptr), mappedSize(0) {
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+  struct stat info;
+  if (fstat(fd, &info) == 0 && info.st_size > 0) {
+    void * const address = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (address != MAP_FAILED) {
+      mapped = static_cast<const uint8_t *>(address);
+      mappedSize = (size_t)info.st_size;
+    }
+  }
+  close(fd); // The mapping stays valid, even if the file is replaced or evicted meanwhile.
+}
+
+MappedFile::~MappedFile() {
+  if (mapped) {
+    munmap(const_cast<uint8_t *>(mapped), mappedSize);
+  }
+}
+
+bool MetadataFile::createDirectory(const std::string& directory) {
+  return mkdir(directory.c_str(), 0755) == 0 || errno == EEXIST;
+}
+
+static void touch(const std::string& path) {
+  utimes(path.c_str(), nullptr);
+}
+
+static bool replaceFile(const std::string& from, const std::string& to) {
+  return rename(from.c_str(), to.c_str()) == 0;
+}
+
+static int processId() {
+  return (int)getpid();
+}
+
+static std::vector<CacheFile> listCacheFiles(const std::string& directory) {
+  std::vector<CacheFile> result;
+  DIR * const dir = opendir(directory.c_str());
+  if (!dir) {
+    return result;
+  }
+  const size_t extensionLength = strlen(FILE_EXTENSION);
+  while (const struct dirent * const entry = readdir(dir)) {
+    const std::string name(entry->d_name);
+    if (name.size() <= extensionLength || name.compare(name.size() - extensionLength, extensionLength, FILE_EXTENSION) != 0) {
+      continue;
+    }
+    const std::string path = directory + "/" + name;
+    struct stat info;
+    if (stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode)) {
+      result.push_back({ path, (uint64_t)info.st_size, (int64_t)info.st_mtime });
+    }
+  }
+  closedir(dir);
+  return result;
+}
+#endif
+
+static void writeMetadata(PayloadWriter& out, const DeviceMetadata& metadata) {
+  out.u16(metadata.productId);
+  out.str(metadata.firmwareVersion);
+  out.str(metadata.libraryVersion);
+
+  out.u32((uint32_t)DEVICE_CAPABILITY_COUNT);
+  for (size_t i = 0; i < DEVICE_CAPABILITY_COUNT; ++i) {
+    out.u8(metadata.capabilities.known[i] ? 1 : 0);
+    out.u8(metadata.capabilities.supported[i] ? 1 : 0);
+  }
+  out.u32((uint32_t)metadata.capabilities.features.size());
+  for (const DeviceFeature feature : metadata.capabilities.features) {
+    out.i32((int32_t)feature);
+  }
+
+  out.u32((uint32_t)metadata.buttonTypes.size());
+  for (const auto& buttonType : metadata.buttonTypes) {
+    out.u16(buttonType.key);
+    out.str(buttonType.value);
+    out.u32((uint32_t)buttonType.events.size());
+    for (const auto& event : buttonType.events) {
+      out.u16(event.first);
+      out.str(event.second);
+    }
+  }
+
+  const SettingSchema * const settingSchema = metadata.settingSchema.get();
+  out.u8(settingSchema ? 1 : 0);
+  if (settingSchema) {
+    out.u32((uint32_t)settingSchema->settings.size());
+    for (const auto& setting : settingSchema->settings) {
+      out.str(setting.guid);
+      out.str(setting.name);
+      out.str(setting.helpText);
+      out.u8(setting.isValidationSupport ? 1 : 0);
+      out.u8(setting.hasValidationRule ? 1 : 0);
+      out.i32(setting.minLength);
+      out.i32(setting.maxLength);
+      out.str(setting.regExp);
+      out.str(setting.errorMessage);
+      out.u8(setting.isDeviceRestart ? 1 : 0);
+      out.u8(setting.isSettingProtected ? 1 : 0);
+      out.u8(setting.isWirelessConnect ? 1 : 0);
+      out.i32((int32_t)setting.cntrlType);
+      out.i32((int32_t)setting.settingDataType);
+      out.str(setting.groupName);
+      out.str(setting.groupHelpText);
+      out.u8(setting.isDepedentsetting ? 1 : 0);
+      out.u8(setting.hasDependentDefaultValue ? 1 : 0);
+      out.str(setting.dependentDefaultValue);
+      out.u8(setting.isPCsetting ? 1 : 0);
+      out.u8(setting.isChildDeviceSetting ? 1 : 0);
+      out.u32((uint32_t)setting.listKeyValue.size());
+      for (const auto& entry : setting.listKeyValue) {
+        out.u16(entry.key);
+        out.str(entry.value);
+        out.u32((uint32_t)entry.dependents.size());
+        for (const auto& dependent : entry.dependents) {
+          out.str(dependent.first);
+          out.u8(dependent.second ? 1 : 0);
+        }
+      }
+    }
+  }
+}
+
+static std::shared_ptr<const SettingSchema> readSettingSchema(PayloadReader& in) {
+  auto schema = std::make_shared<SettingSchema>();
+  schema->revision = 1;
+
+  // Minimum sizes are the sizes of the fixed fields plus four bytes per string length:
+  const uint32_t settingCount = in.count(61);
+  schema->settings.resize(settingCount);
+  for (auto& setting : schema->settings) {
+    setting.guid = in.str();
+    setting.name = in.str();
+    setting.helpText = in.str();
+    setting.isValidationSupport = in.u8() != 0;
+    setting.hasValidationRule = in.u8() != 0;
+    setting.minLength = in.i32();
+    setting.maxLength = in.i32();
+    setting.regExp = in.str();
+    setting.errorMessage = in.str();
+    setting.isDeviceRestart = in.u8() != 0;
+    setting.isSettingProtected = in.u8() != 0;
+    setting.isWirelessConnect = in.u8() != 0;
+    setting.cntrlType = (ControlType)in.i32();
+    setting.settingDataType = (DataType)in.i32();
+    setting.groupName = in.str();
+    setting.groupHelpText = in.str();
+    setting.isDepedentsetting = in.u8() != 0;
+    setting.hasDependentDefaultValue = in.u8() != 0;
+    setting.dependentDefaultValue = in.str();
+    setting.isPCsetting = in.u8() != 0;
+    setting.isChildDeviceSetting = in.u8() != 0;
+    setting.listKeyValue.resize(in.count(10));
+    for (auto& entry : setting.listKeyValue) {
+      entry.key = in.u16();
+      entry.value = in.str();
+      entry.dependents.resize(in.count(5));
+      for (auto& dependent : entry.dependents) {
+        dependent.first = in.str();
+        dependent.second = in.u8() != 0;
+      }
+    }
+  }
+
+  return schema;
+}
+
+std::string MetadataFile::path(const std::string& directory, const DeviceMetadata& metadata) {
+  char name[32];
+  snprintf(name, sizeof(name), "%04x-%08x", (unsigned int)metadata.productId,
+           (unsigned int)fnv1a(metadata.firmwareVersion + '\0' + metadata.libraryVersion));
+  return directory + "/" + name + FILE_EXTENSION;
+}
+
+MetadataFile::ReadResult MetadataFile::read(const std::string& directory, DeviceMetadata& metadata) {
+  const std::string path = MetadataFile::path(directory, metadata);
+
+  bool valid = false;
+  {
+    const MappedFile file(path);
+    if (!file.data()) {
+      return ReadResult::MISSING;
+    }
+
+    FileHeader header;
+    if (file.size() >= sizeof(header)) {
+      memcpy(&header, file.data(), sizeof(header));
+    }
+    const uint8_t * const payload = file.data() + sizeof(header);
+    if (file.size() >= sizeof(header) && memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) == 0
+        && header.formatVersion == FORMAT_VERSION && header.payloadSize == file.size() - sizeof(header)
+        && header.crc == crc32(payload, header.payloadSize)) {
+      PayloadReader in(payload, header.payloadSize);
+
+      const bool sameKey = in.u16() == metadata.productId && in.str() == metadata.firmwareVersion
+                           && in.str() == metadata.libraryVersion; // Else a file name hash collision.
+
+      const bool sameCapabilities = in.u32() == DEVICE_CAPABILITY_COUNT;
+      for (size_t i = 0; i < DEVICE_CAPABILITY_COUNT; ++i) {
+        metadata.capabilities.known[i] = in.u8() != 0;
+        metadata.capabilities.supported[i] = in.u8() != 0;
+      }
+      metadata.capabilities.features.resize(in.count(4));
+      for (auto& feature : metadata.capabilities.features) {
+        feature = (DeviceFeature)in.i32();
+      }
+
+      metadata.buttonTypes.resize(in.count(10));
+      for (auto& buttonType : metadata.buttonTypes) {
+        buttonType.key = in.u16();
+        buttonType.value = in.str();
+        buttonType.events.resize(in.count(6));
+        for (auto& event : buttonType.events) {
+          event.first = in.u16();
+          event.second = in.str();
+        }
+      }
+
+      metadata.settingSchema = in.u8() != 0 ? readSettingSchema(in) : nullptr;
+
+      valid = sameKey && sameCapabilities && in.good();
+    }
+  } // Unmapped here, so the file can be removed on Windows too.
+
+  if (valid) {
+    touch(path); // For evicting the least recently used files.
+    return ReadResult::READ;
+  }
+
+  std::remove(path.c_str());
+  metadata.capabilities.features.clear();
+  metadata.buttonTypes.clear();
+  metadata.settingSchema = nullptr;
+  return ReadResult::DROPPED;
+}
+
+MetadataFile::WriteResult MetadataFile::write(const std::string& directory, const DeviceMetadata& metadata,
+                                              uint64_t maxSizeBytes) {
+  PayloadWriter out;
+  writeMetadata(out, metadata);
+
+  FileHeader header;
+  memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+  header.formatVersion = FORMAT_VERSION;
+  header.payloadSize = (uint32_t)out.buffer.size();
+  header.crc = crc32(reinterpret_cast<const uint8_t *>(out.buffer.data()), out.buffer.size());
+
+  // Unique per process and write, as other processes may share the directory:
+  static std::atomic<uint32_t> tmpCounter(0);
+  const std::string path = MetadataFile::path(directory, metadata);
+  const std::string tmpPath = path + "." + std::to_string(processId()) + "." + std::to_string(++tmpCounter) + ".tmp";
+
+  bool written;
+  {
+    std::ofstream file(tmpPath, std::ios::out | std::ios::trunc | std::ios::binary);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(out.buffer.data(), out.buffer.size());
+    file.close();
+    written = !file.fail();
+  }
+  written = written && replaceFile(tmpPath, path);
+  if (!written) {
+    std::remove(tmpPath.c_str());
+  }
+
+  // Evict the least recently used files (but never the one just written) beyond the size limit:
+  std::vector<CacheFile> files = listCacheFiles(directory);
+  uint64_t totalSize = 0;
+  for (const auto& file : files) {
+    totalSize += file.size;
+  }
+  std::sort(files.begin(), files.end(), [](const CacheFile& a, const CacheFile& b) {
+    return a.lastUsed < b.lastUsed;
+  });
+  uint64_t evicted = 0;
+  for (const auto& file : files) {
+    if (totalSize <= maxSizeBytes) {
+      break;
+    }
+    if (file.path != path && std::remove(file.path.c_str()) == 0) {
+      totalSize -= file.size;
+      ++evicted;
+    }
+  }
+
+  return WriteResult{ written, evicted, totalSize, files.size() - evicted };
+}
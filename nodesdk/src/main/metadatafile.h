@@ -0,0 +1,75 @@
+#pragma once
+
+#include "stdafx.h"
+#include "capabilities.h"
+#include "buttoncatalogue.h"
+#include "settings.h"
+
+#include <memory>
+#include <vector>
+
+/**
+ * Static metadata of a device as kept in a cache file of DeviceMetadataCache.
+ */
+struct DeviceMetadata {
+  // Key - one file per product ID, firmware version and libjabra version:
+  unsigned short productId;
+  std::string firmwareVersion;
+  std::string libraryVersion;
+
+  DeviceCapabilityCache::Capabilities capabilities;
+  std::vector<DeviceButtonCatalogue::ButtonType> buttonTypes;
+  std::shared_ptr<const SettingSchema> settingSchema; // nullptr until settings are fetched once.
+};
+
+/**
+ * The cache files of DeviceMetadataCache in a directory, read through a memory mapping.
+ *
+ * Each file has a format version, is checked by CRC-32 and records its full key, as the file name only has a hash of
+ * it. Files that fail any check are dropped. Files are written to a temporary file that is then renamed, so other
+ * processes sharing the directory never read a partial file. The least recently used files are evicted when the
+ * directory grows beyond its size limit.
+ *
+ * Neither napi nor libjabra is called, so the files can be tested on their own (see src/test/metadatafile.cc).
+ *
+ * Not thread-safe: Writes of a process must be serialized by the caller.
+ */
+class MetadataFile {
+  public:
+    enum class ReadResult {
+      MISSING, // Not cached yet.
+      READ,
+      DROPPED  // Unreadable, corrupt, of another format version or of another key - removed.
+    };
+
+    struct WriteResult {
+      bool written;
+      uint64_t evicted;   // Files removed to stay within the size limit.
+      uint64_t sizeBytes; // Size of the files left.
+      uint64_t fileCount; // Number of files left.
+    };
+
+    /**
+     * Create the directory unless it exists. Returns false if it could not be created.
+     */
+    static bool createDirectory(const std::string& directory);
+
+    /**
+     * Path of the cache file of the key of metadata.
+     */
+    static std::string path(const std::string& directory, const DeviceMetadata& metadata);
+
+    /**
+     * Read the cache file of the key of metadata into metadata, marking the file as recently used.
+     */
+    static ReadResult read(const std::string& directory, DeviceMetadata& metadata);
+
+    /**
+     * Write (or replace) the cache file of the metadata, then evict the least recently used other files beyond
+     * maxSizeBytes.
+     */
+    static WriteResult write(const std::string& directory, const DeviceMetadata& metadata, uint64_t maxSizeBytes);
+
+  private:
+    MetadataFile() = delete;
+};
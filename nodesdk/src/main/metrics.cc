@@ -0,0 +1,190 @@
+#include "metrics.h"
+#include "eventchannel.h"
+#include "eventinterest.h"
+#include "devlog.h"
+#include "startup.h"
+#include "attachprefetch.h"
+#include "metadatacache.h"
+
+static Napi::Object toNapiExecutorStats(const Napi::Env& env, const util::SdkExecutorStats& stats) {
+  Napi::Object result = Napi::Object::New(env);
+
+  result.Set(Napi::String::New(env, "threadCount"), Napi::Number::New(env, stats.threadCount));
+  result.Set(Napi::String::New(env, "callControlThreadCount"), Napi::Number::New(env, stats.callControlThreadCount));
+  result.Set(Napi::String::New(env, "watchdogThresholdMs"), Napi::Number::New(env, stats.watchdogThresholdMs));
+  result.Set(Napi::String::New(env, "queued"), Napi::Number::New(env, (double)stats.queued));
+  result.Set(Napi::String::New(env, "running"), Napi::Number::New(env, (double)stats.running));
+  result.Set(Napi::String::New(env, "submitted"), Napi::Number::New(env, (double)stats.submitted));
+  result.Set(Napi::String::New(env, "completed"), Napi::Number::New(env, (double)stats.completed));
+  result.Set(Napi::String::New(env, "stuckCallsReported"), Napi::Number::New(env, (double)stats.stuckCallsReported));
+  result.Set(Napi::String::New(env, "coalesced"), Napi::Number::New(env, (double)stats.coalesced));
+  result.Set(Napi::String::New(env, "activeStrands"), Napi::Number::New(env, (double)stats.activeStrands));
+  result.Set(Napi::String::New(env, "timedOut"), Napi::Number::New(env, (double)stats.timedOut));
+  result.Set(Napi::String::New(env, "cancelled"), Napi::Number::New(env, (double)stats.cancelled));
+  result.Set(Napi::String::New(env, "skipped"), Napi::Number::New(env, (double)stats.skipped));
+
+  Napi::Object queueWait = Napi::Object::New(env);
+  for (size_t p = 0; p < util::SDK_PRIORITY_COUNT; ++p) {
+    const util::SdkQueueWaitStats& waitStats = stats.queueWait[p];
+    Napi::Object item = Napi::Object::New(env);
+    item.Set(Napi::String::New(env, "count"), Napi::Number::New(env, (double)waitStats.count));
+    item.Set(Napi::String::New(env, "averageMs"), Napi::Number::New(env, waitStats.count ? ((double)waitStats.totalUs / waitStats.count) / 1000.0 : 0.0));
+    item.Set(Napi::String::New(env, "maxMs"), Napi::Number::New(env, (double)waitStats.maxUs / 1000.0));
+    queueWait.Set(Napi::String::New(env, util::toString(static_cast<util::SdkPriority>(p))), item);
+  }
+  result.Set(Napi::String::New(env, "queueWait"), queueWait);
+
+  Napi::Array stuckCalls = Napi::Array::New(env);
+  uint32_t i = 0;
+  for (const auto& stuckCall : stats.stuckCalls) {
+    Napi::Object item = Napi::Object::New(env);
+    item.Set(Napi::String::New(env, "name"), Napi::String::New(env, stuckCall.first));
+    item.Set(Napi::String::New(env, "runningMs"), Napi::Number::New(env, (double)stuckCall.second));
+    stuckCalls[i++] = item;
+  }
+  result.Set(Napi::String::New(env, "stuckCalls"), stuckCalls);
+
+  return result;
+}
+
+static Napi::Object toNapiWorkerPoolStats(const Napi::Env& env, const util::SdkWorkerPoolStats& stats) {
+  Napi::Object result = Napi::Object::New(env);
+
+  result.Set(Napi::String::New(env, "capacity"), Napi::Number::New(env, stats.capacity));
+  result.Set(Napi::String::New(env, "pooled"), Napi::Number::New(env, (double)stats.pooled));
+  result.Set(Napi::String::New(env, "hits"), Napi::Number::New(env, (double)stats.hits));
+  result.Set(Napi::String::New(env, "misses"), Napi::Number::New(env, (double)stats.misses));
+  result.Set(Napi::String::New(env, "discarded"), Napi::Number::New(env, (double)stats.discarded));
+
+  return result;
+}
+
+static Napi::Object toNapiLatencyHistogram(const Napi::Env& env, const util::LatencyHistogramSnapshot& histogram) {
+  Napi::Object result = Napi::Object::New(env);
+
+  result.Set(Napi::String::New(env, "count"), Napi::Number::New(env, (double)histogram.count));
+  result.Set(Napi::String::New(env, "averageMs"), Napi::Number::New(env, histogram.count ? ((double)histogram.totalNs / histogram.count) / 1000000.0 : 0.0));
+  result.Set(Napi::String::New(env, "maxMs"), Napi::Number::New(env, (double)histogram.maxNs / 1000000.0));
+
+  Napi::Array buckets = Napi::Array::New(env, util::LatencyHistogramSnapshot::BUCKET_COUNT);
+  for (size_t i = 0; i < util::LatencyHistogramSnapshot::BUCKET_COUNT; ++i) {
+    buckets.Set((uint32_t)i, Napi::Number::New(env, (double)histogram.buckets[i]));
+  }
+  result.Set(Napi::String::New(env, "buckets"), buckets);
+
+  return result;
+}
+
+static Napi::Object toNapiEventChannelStats(const Napi::Env& env, const EventChannelStats& stats) {
+  Napi::Object result = Napi::Object::New(env);
+
+  result.Set(Napi::String::New(env, "posted"), Napi::Number::New(env, (double)stats.posted));
+  result.Set(Napi::String::New(env, "delivered"), Napi::Number::New(env, (double)stats.delivered));
+  result.Set(Napi::String::New(env, "batches"), Napi::Number::New(env, (double)stats.batches));
+  result.Set(Napi::String::New(env, "maxBatchSize"), Napi::Number::New(env, (double)stats.maxBatchSize));
+  result.Set(Napi::String::New(env, "coalesced"), Napi::Number::New(env, (double)stats.coalesced));
+  result.Set(Napi::String::New(env, "binaryRecords"), Napi::Number::New(env, (double)stats.binaryRecords));
+  result.Set(Napi::String::New(env, "filtered"), Napi::Number::New(env, (double)DeviceEventInterest::instance().getFilteredCount()));
+
+  Napi::Object dropped = Napi::Object::New(env);
+  for (size_t t = 0; t < NATIVE_EVENT_TYPE_COUNT; ++t) {
+    dropped.Set(Napi::String::New(env, toString(static_cast<NativeEventType>(t))), Napi::Number::New(env, (double)stats.dropped[t]));
+  }
+  result.Set(Napi::String::New(env, "dropped"), dropped);
+
+  Napi::Object latency = Napi::Object::New(env);
+  for (size_t t = 0; t < NATIVE_EVENT_TYPE_COUNT; ++t) {
+    const EventLatencyStats& latencyStats = stats.latency[t];
+    if (latencyStats.sdk.count > 0 || latencyStats.total.count > 0) {
+      Napi::Object item = Napi::Object::New(env);
+      item.Set(Napi::String::New(env, "sdk"), toNapiLatencyHistogram(env, latencyStats.sdk));
+      item.Set(Napi::String::New(env, "queue"), toNapiLatencyHistogram(env, latencyStats.queue));
+      item.Set(Napi::String::New(env, "total"), toNapiLatencyHistogram(env, latencyStats.total));
+      latency.Set(Napi::String::New(env, toString(static_cast<NativeEventType>(t))), item);
+    }
+  }
+  result.Set(Napi::String::New(env, "latency"), latency);
+
+  return result;
+}
+
+static Napi::Object toNapiDevLogStats(const Napi::Env& env, const DevLogStats& stats) {
+  Napi::Object result = Napi::Object::New(env);
+
+  result.Set(Napi::String::New(env, "decoded"), Napi::Number::New(env, (double)stats.decoded));
+  result.Set(Napi::String::New(env, "decodeErrors"), Napi::Number::New(env, (double)stats.decodeErrors));
+  result.Set(Napi::String::New(env, "fileWrites"), Napi::Number::New(env, (double)stats.fileWrites));
+  result.Set(Napi::String::New(env, "fileBytes"), Napi::Number::New(env, (double)stats.fileBytes));
+  result.Set(Napi::String::New(env, "fileRotations"), Napi::Number::New(env, (double)stats.fileRotations));
+  result.Set(Napi::String::New(env, "fileErrors"), Napi::Number::New(env, (double)stats.fileErrors));
+
+  return result;
+}
+
+static Napi::Object toNapiAttachPrefetchStats(const Napi::Env& env, const AttachPrefetchStats& stats) {
+  Napi::Object result = Napi::Object::New(env);
+
+  result.Set(Napi::String::New(env, "enabled"), Napi::Boolean::New(env, stats.items != 0));
+  result.Set(Napi::String::New(env, "prefetched"), Napi::Number::New(env, (double)stats.prefetched));
+  result.Set(Napi::String::New(env, "failed"), Napi::Number::New(env, (double)stats.failed));
+  result.Set(Napi::String::New(env, "cancelled"), Napi::Number::New(env, (double)stats.cancelled));
+  result.Set(Napi::String::New(env, "latency"), toNapiLatencyHistogram(env, stats.latency));
+
+  return result;
+}
+
+static Napi::Object toNapiMetadataCacheStats(const Napi::Env& env, const MetadataCacheStats& stats) {
+  Napi::Object result = Napi::Object::New(env);
+
+  result.Set(Napi::String::New(env, "enabled"), Napi::Boolean::New(env, stats.enabled));
+  result.Set(Napi::String::New(env, "directory"), Napi::String::New(env, stats.directory));
+  result.Set(Napi::String::New(env, "maxSizeBytes"), Napi::Number::New(env, (double)stats.maxSizeBytes));
+  result.Set(Napi::String::New(env, "sizeBytes"), Napi::Number::New(env, (double)stats.sizeBytes));
+  result.Set(Napi::String::New(env, "fileCount"), Napi::Number::New(env, (double)stats.fileCount));
+  result.Set(Napi::String::New(env, "hits"), Napi::Number::New(env, (double)stats.hits));
+  result.Set(Napi::String::New(env, "misses"), Napi::Number::New(env, (double)stats.misses));
+  result.Set(Napi::String::New(env, "corrupt"), Napi::Number::New(env, (double)stats.corrupt));
+  result.Set(Napi::String::New(env, "writes"), Napi::Number::New(env, (double)stats.writes));
+  result.Set(Napi::String::New(env, "writeErrors"), Napi::Number::New(env, (double)stats.writeErrors));
+  result.Set(Napi::String::New(env, "evicted"), Napi::Number::New(env, (double)stats.evicted));
+  result.Set(Napi::String::New(env, "hitLatency"), toNapiLatencyHistogram(env, stats.hitLatency));
+  result.Set(Napi::String::New(env, "missLatency"), toNapiLatencyHistogram(env, stats.missLatency));
+
+  return result;
+}
+
+static Napi::Object toNapiLibraryStats(const Napi::Env& env, const jabralib::LibraryStats& stats) {
+  Napi::Object result = Napi::Object::New(env);
+
+  result.Set(Napi::String::New(env, "loaded"), Napi::Boolean::New(env, stats.loaded));
+  result.Set(Napi::String::New(env, "file"), Napi::String::New(env, stats.file));
+  result.Set(Napi::String::New(env, "loadMs"), Napi::Number::New(env, stats.loadMs));
+  result.Set(Napi::String::New(env, "resolvedFunctions"), Napi::Number::New(env, (double)stats.resolved));
+  result.Set(Napi::String::New(env, "resolveMs"), Napi::Number::New(env, stats.resolveMs));
+  if (!stats.error.empty()) {
+    result.Set(Napi::String::New(env, "error"), Napi::String::New(env, stats.error));
+  }
+
+  return result;
+}
+
+Napi::Value napi_GetNativeMetrics(const Napi::CallbackInfo& info) {
+  return util::JSyncWrapper<Napi::Value>(__func__, info, [](const char * const functionName, const Napi::CallbackInfo& info) -> Napi::Value {
+    const Napi::Env env = info.Env();
+
+    if (util::verifyArguments(functionName, info, { })) {
+      Napi::Object result = Napi::Object::New(env);
+      result.Set(Napi::String::New(env, "executor"), toNapiExecutorStats(env, util::SdkExecutor::instance().getStats()));
+      result.Set(Napi::String::New(env, "workerPool"), toNapiWorkerPoolStats(env, util::SdkWorkerPool::instance().getStats()));
+      result.Set(Napi::String::New(env, "events"), toNapiEventChannelStats(env, EventChannel::getStats()));
+      result.Set(Napi::String::New(env, "devLog"), toNapiDevLogStats(env, DevLogDecoder::instance().getStats()));
+      result.Set(Napi::String::New(env, "startup"), StartupTiming::instance().toNapi(env));
+      result.Set(Napi::String::New(env, "library"), toNapiLibraryStats(env, jabralib::getStats()));
+      result.Set(Napi::String::New(env, "attachPrefetch"), toNapiAttachPrefetchStats(env, AttachPrefetch::instance().getStats()));
+      result.Set(Napi::String::New(env, "metadataCache"), toNapiMetadataCacheStats(env, DeviceMetadataCache::instance().getStats()));
+      return result;
+    }
+
+    return env.Undefined();
+  });
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "stdafx.h"
+
+/**
+ * Get native diagnostics/metrics (executor state etc.) from node.
+ */
+Napi::Value napi_GetNativeMetrics(const Napi::CallbackInfo& info);
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace util {
+
+/**
+ * Bounded lock-free queue with preallocated slots for passing items from many producer threads to a single
+ * consumer thread (a Vyukov style ring where every slot has a sequence number).
+ *
+ * Producers never take a lock or wait for the consumer: push() fails right away when the ring is full. To let a
+ * producer make room for a new item instead (drop-oldest overflow policy), items can be pushed as evictable and
+ * pushOrEvict() then removes the oldest item - but only if it is evictable itself, so items that must not be lost are
+ * never removed for newer ones. All operations are safe to call concurrently from any thread.
+ *
+ * Capacity is rounded up to a power of two.
+ */
+template <typename T>
+class MpscRing {
+  public:
+    explicit MpscRing(size_t requestedCapacity)
+      : capacity(roundUpToPowerOfTwo(requestedCapacity)), mask(capacity - 1), slots(new Slot[capacity]),
+        padding1(), enqueuePos(0), padding2(), dequeuePos(0) {
+        for (size_t i = 0; i < capacity; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+            slots[i].evictable.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    size_t getCapacity() const {
+        return capacity;
+    }
+
+    /**
+     * Add an item, which pushOrEvict() may remove to make room if evictable. Returns false (and leaves item
+     * untouched) if the ring is full.
+     */
+    bool push(T& item, bool evictable = false) {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Slot * slot;
+        for (;;) {
+            slot = &slots[pos & mask];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // Full.
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->item = std::move(item);
+        slot->evictable.store(evictable, std::memory_order_relaxed);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Add an evictable item, removing the oldest item to make room while the ring is full and the oldest item is
+     * evictable. Each removed item is passed to onEvicted. Gives up after maxAttempts, as other producers may take the
+     * room first. Returns false (and leaves item untouched) if the item was not added.
+     */
+    template <typename EvictedFunction>
+    bool pushOrEvict(T& item, int maxAttempts, EvictedFunction onEvicted) {
+        if (push(item, true)) {
+            return true;
+        }
+
+        T oldest;
+        for (int attempt = 0; attempt < maxAttempts; ++attempt) {
+            if (!take(oldest, true)) {
+                // Not evictable (or taken by the consumer meanwhile):
+                return push(item, true);
+            }
+            onEvicted(oldest);
+            if (push(item, true)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Remove the oldest item. Returns false if the ring is empty (or the oldest item is not completely added yet).
+     */
+    bool pop(T& item) {
+        return take(item, false);
+    }
+
+  private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        std::atomic<bool> evictable; // Written before and read after the sequence, only valid while it is queued.
+        T item;
+    };
+
+    bool take(T& item, bool evictableOnly) {
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        Slot * slot;
+        for (;;) {
+            slot = &slots[pos & mask];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+            if (diff == 0) {
+                // If the slot is taken and reused meanwhile, the flag may be of a newer item, but the CAS then fails.
+                if (evictableOnly && !slot->evictable.load(std::memory_order_relaxed)) {
+                    return false;
+                }
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false; // Empty.
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        item = std::move(slot->item);
+        slot->item = T();
+        slot->sequence.store(pos + mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    static size_t roundUpToPowerOfTwo(size_t value) {
+        size_t result = 2;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    const size_t capacity;
+    const size_t mask;
+    std::unique_ptr<Slot[]> slots;
+
+    // Padded to keep them on separate cache lines, as they are written by different threads:
+    char padding1[64];
+    std::atomic<size_t> enqueuePos;
+    char padding2[64];
+    std::atomic<size_t> dequeuePos;
+};
+
+} // namespace util
@@ -1,5 +1,8 @@
 #include "napiutil.h"
 
+#include <algorithm>
+#include <cstdint>
+
 // OS-specific macros
 #if (defined(_WIN32) || defined(__WIN32__)) && !defined(WIN32)
 #define WIN32
@@ -174,17 +177,9 @@ namespace util {
 
     #endif
 
-    bool verifyArguments(const char * const functionName, const Napi::CallbackInfo& info, std::initializer_list<FormalParameterType> expectedArgumentTypes) {
+    static bool verifyArgumentTypes(const char * const functionName, const Napi::CallbackInfo& info, std::initializer_list<FormalParameterType> expectedArgumentTypes) {
         const Napi::Env env = info.Env();
 
-        if (info.Length() != expectedArgumentTypes.size()) {
-            const std::string errMsg = "Wrong number of arguments to " + std::string(functionName) + " (got #" + std::to_string(info.Length()) + ",  expected #" + std::to_string( expectedArgumentTypes.size()) + ")";
-            LOG_ERROR_(LOGINSTANCE) << errMsg;
-            Napi::TypeError::New(env, errMsg).ThrowAsJavaScriptException();
-            return false;
-        }
-
-
         int j = 0;
         for (std::initializer_list<FormalParameterType>::iterator it=expectedArgumentTypes.begin(); it!=expectedArgumentTypes.end(); ++it) {
             if (!verifyValueType(info[j], *it)) {
@@ -199,6 +194,77 @@ namespace util {
         return true;
     }
 
+    bool verifyArguments(const char * const functionName, const Napi::CallbackInfo& info, std::initializer_list<FormalParameterType> expectedArgumentTypes) {
+        const Napi::Env env = info.Env();
+
+        if (info.Length() != expectedArgumentTypes.size()) {
+            const std::string errMsg = "Wrong number of arguments to " + std::string(functionName) + " (got #" + std::to_string(info.Length()) + ",  expected #" + std::to_string( expectedArgumentTypes.size()) + ")";
+            LOG_ERROR_(LOGINSTANCE) << errMsg;
+            Napi::TypeError::New(env, errMsg).ThrowAsJavaScriptException();
+            return false;
+        }
+
+        return verifyArgumentTypes(functionName, info, expectedArgumentTypes);
+    }
+
+    bool verifyArgumentsWithCallOptions(const char * const functionName, const Napi::CallbackInfo& info, std::initializer_list<FormalParameterType> expectedArgumentTypes, CallOptions& callOptions) {
+        const Napi::Env env = info.Env();
+        const size_t optionsIndex = expectedArgumentTypes.size();
+
+        callOptions = CallOptions();
+
+        if (info.Length() != optionsIndex && info.Length() != optionsIndex + 1) {
+            const std::string errMsg = "Wrong number of arguments to " + std::string(functionName) + " (got #" + std::to_string(info.Length()) + ",  expected #" + std::to_string(optionsIndex) + " + optional call options)";
+            LOG_ERROR_(LOGINSTANCE) << errMsg;
+            Napi::TypeError::New(env, errMsg).ThrowAsJavaScriptException();
+            return false;
+        }
+
+        if (!verifyArgumentTypes(functionName, info, expectedArgumentTypes)) {
+            return false;
+        }
+
+        if (info.Length() == optionsIndex || info[optionsIndex].IsUndefined() || info[optionsIndex].IsNull()) {
+            return true;
+        }
+
+        if (!info[optionsIndex].IsObject()) {
+            const std::string errMsg = "Wrong type of call options argument to " + std::string(functionName) + " (expected object)";
+            LOG_ERROR_(LOGINSTANCE) << errMsg;
+            Napi::TypeError::New(env, errMsg).ThrowAsJavaScriptException();
+            return false;
+        }
+
+        Napi::Object options = info[optionsIndex].As<Napi::Object>();
+        const Napi::Value timeoutMs = options.Get("timeoutMs");
+        const Napi::Value cancellationId = options.Get("cancellationId");
+        const Napi::Value aborted = options.Get("aborted");
+
+        if ((!timeoutMs.IsUndefined() && !timeoutMs.IsNumber()) || (!cancellationId.IsUndefined() && !cancellationId.IsNumber()) || (!aborted.IsUndefined() && !aborted.IsBoolean())) {
+            const std::string errMsg = "Wrong type of call options to " + std::string(functionName) + " (expected numeric timeoutMs and cancellationId and boolean aborted)";
+            LOG_ERROR_(LOGINSTANCE) << errMsg;
+            Napi::TypeError::New(env, errMsg).ThrowAsJavaScriptException();
+            return false;
+        }
+
+        if (timeoutMs.IsNumber()) {
+            const int64_t timeout = timeoutMs.As<Napi::Number>().Int64Value();
+            callOptions.hasTimeout = true;
+            // Explicit 0 means no timeout (overrides the default).
+            callOptions.timeoutMs = timeout > 0 ? (unsigned int)std::min<int64_t>(timeout, UINT32_MAX) : SdkExecutor::NO_TIMEOUT;
+        }
+
+        if (cancellationId.IsNumber()) {
+            callOptions.cancellationId = cancellationId.As<Napi::Number>().Int32Value();
+        }
+
+        if (aborted.IsBoolean()) {
+            callOptions.aborted = aborted.As<Napi::Boolean>().Value();
+        }
+
+        return true;
+    }
+
 
     /**
      * Create a C-string from a std:string 
@@ -1,5 +1,9 @@
 #pragma once
 
+// Needs to go first because of winsock issues
+#include "sdkexecutor.h"
+#include "workerpool.h"
+
 #include <iostream>
 #include <memory>
 #include <thread>
@@ -172,31 +176,372 @@ enum FormalParameterType
  **/
 bool verifyArguments(const char * const callerFunctionName, const Napi::CallbackInfo &info, std::initializer_list<FormalParameterType> expectedFormalParameterTypes);
 
+/**
+ * Per-call options that javascript may pass as an optional trailing {timeoutMs, cancellationId, aborted} argument
+ * to async functions.
+ */
+struct CallOptions {
+    /** Timeout overriding the default timeout (SdkExecutor::NO_TIMEOUT for none) - only used if hasTimeout is set. */
+    unsigned int timeoutMs;
+    bool hasTimeout;
+    /** Id passed to CancelCall to cancel the call or SdkTask::NO_CANCELLATION. */
+    int cancellationId;
+    /** The cancellation token was already aborted when the call was made. */
+    bool aborted;
+
+    CallOptions() : timeoutMs(SdkExecutor::NO_TIMEOUT), hasTimeout(false), cancellationId(SdkTask::NO_CANCELLATION), aborted(false) {}
+};
+
+/**
+ * As verifyArguments, but also accepts (and parses) an optional trailing CallOptions argument.
+ **/
+bool verifyArgumentsWithCallOptions(const char * const callerFunctionName, const Napi::CallbackInfo &info, std::initializer_list<FormalParameterType> expectedFormalParameterTypes, CallOptions& callOptions);
+
+/**
+ * Create the error an abandoned call is rejected with. Named TimeoutError or AbortError like the errors of the DOM
+ * AbortSignal API.
+ */
+inline Napi::Error AbandonedError(const Napi::Env& env, const char * const callerFunctionName, SdkAbandonReason reason) {
+    const bool timeout = reason == SdkAbandonReason::TIMEOUT;
+    Napi::Error error = Napi::Error::New(env, std::string(callerFunctionName) + (timeout ? " timed out" : " was cancelled"));
+    error.Set(Napi::String::New(env, "name"), Napi::String::New(env, timeout ? "TimeoutError" : "AbortError"));
+    return error;
+}
+
 // --- Async helpers ------------------------------------------------------------------------------------------------
 
 /**
- * Async worker utility that can run any Jabra (lambda) work function asynchronously.
+ * Optional scheduling hints for async work passed to JAsyncWorker's and high-level helpers.
+ */
+struct AsyncOptions {
+    /**
+     * Work only reads device/sdk state and returns a plain value (no cleanup that frees the result!), so
+     * identical calls (same function and arguments) already in flight can share one sdk call.
+     */
+    bool readOnly;
+
+    /**
+     * Scheduling priority class of the work.
+     */
+    SdkPriority priority;
+
+    AsyncOptions() : readOnly(false), priority(SdkPriority::NORMAL) {}
+
+    static AsyncOptions ReadOnly() {
+        AsyncOptions options;
+        options.readOnly = true;
+        return options;
+    }
+
+    static AsyncOptions CallControl() {
+        AsyncOptions options;
+        options.priority = SdkPriority::CALL_CONTROL;
+        return options;
+    }
+
+    static AsyncOptions Bulk() {
+        AsyncOptions options;
+        options.priority = SdkPriority::BULK;
+        return options;
+    }
+};
+
+/**
+ * Base class for async workers that run on the dedicated SdkExecutor rather than on the shared libuv threadpool.
  * 
- * This is the central worker that (almost all) n-api implementations of Jabra functions 
- * should use to make sure code is non-blocking. This utility may be used directly for
- * complex cases or indirectly thorugh high-level helpers like f.x. SimpleDeviceAsyncFunction 
- * for simple cases.
+ * Mirrors the parts of the Napi::AsyncWorker interface used by our workers (Execute/OnOK/OnError/SetError etc.), so
+ * subclasses are written exactly as they would be for Napi::AsyncWorker. Like Napi::AsyncWorker, OnOK is called if
+ * Execute did not call SetError, otherwise OnError is called. Both are called inside a callback scope so promise
+ * jobs etc. are run when the javascript callback returns.
+ *
+ * A worker delivers its result either to a javascript callback or, when constructed without one, through a
+ * promise (see Promise()) that is settled directly from native code using Deliver/DeliverError.
+ *
+ * A worker may have a timeout and a cancellation id (see SetCallOptions). If it is abandoned, the callback/promise
+ * gets a TimeoutError/AbortError right away, and the eventual result is dropped - OnAbandoned is called instead of
+ * OnOK/OnError, so it can still be cleaned up.
  * 
- * The sole exception where this worker should NOT be used, is for handling Jabra c-callbacks
- * in init and eventhandlers!
+ * Nb. Queued workers are owned and deleted by the executor (no explicit delete required). Worker memory is reused
+ * through the SdkWorkerPool.
+ */
+class SdkAsyncWorker : public SdkTask
+{
+  private:
+    Napi::Env env;
+    const char * const taskName;
+    Napi::AsyncContext asyncContext;
+    Napi::ObjectReference receiver;
+    Napi::FunctionReference callback;
+    napi_deferred deferred; // Only set for promise based workers.
+    napi_value promise;
+    std::string errorMessage;
+    int strandKey;
+    std::string coalesceKeyValue;
+    SdkPriority priorityClass;
+    CallOptions callOptions;
+    std::chrono::steady_clock::time_point deadlineValue;
+    bool settled; // Main thread only.
+    bool skipped; // Set instead of running Execute when no longer wanted.
+    SdkAbandonReason skipReason;
+
+  public:
+    SdkAsyncWorker(const char * const taskName, const Napi::Function &callback)
+      : env(callback.Env()), taskName(taskName), asyncContext(callback.Env(), taskName), 
+        receiver(Napi::Persistent(Napi::Object::New(callback.Env()))), callback(Napi::Persistent(callback)), 
+        deferred(nullptr), promise(nullptr), errorMessage(),
+        strandKey(NO_STRAND), coalesceKeyValue(), priorityClass(SdkPriority::NORMAL), callOptions(),
+        deadlineValue(std::chrono::steady_clock::time_point::max()), settled(false), skipped(false), skipReason(SdkAbandonReason::TIMEOUT) {}
+
+    /**
+     * Create a promise based worker - use Promise() to get the promise to return to javascript.
+     */
+    SdkAsyncWorker(const char * const taskName, const Napi::Env &env)
+      : env(env), taskName(taskName), asyncContext(env, taskName), receiver(), callback(),
+        deferred(nullptr), promise(nullptr), errorMessage(),
+        strandKey(NO_STRAND), coalesceKeyValue(), priorityClass(SdkPriority::NORMAL), callOptions(),
+        deadlineValue(std::chrono::steady_clock::time_point::max()), settled(false), skipped(false), skipReason(SdkAbandonReason::TIMEOUT) {
+        if (napi_create_promise(env, &deferred, &promise) != napi_ok) {
+            throw Napi::Error::New(env);
+        }
+    }
+    SdkAsyncWorker(const SdkAsyncWorker&) = delete;
+    virtual ~SdkAsyncWorker() {}
+
+    // Workers are allocated from the SdkWorkerPool. As the destructor is virtual, delete passes the size of the
+    // most derived worker type.
+    static void * operator new(size_t size) {
+        return SdkWorkerPool::instance().allocate(size);
+    }
+
+    static void operator delete(void * memory, size_t size) {
+        SdkWorkerPool::instance().release(memory, size);
+    }
+
+    /**
+     * Submit the worker to the SdkExecutor. Must be called from the node main thread.
+     *
+     * Without an explicit timeout, the default timeout of the executor applies to all but BULK workers (as
+     * firmware updates and file transfers may legitimately run for minutes).
+     */
+    void Queue() {
+        SdkExecutor& executor = SdkExecutor::instance();
+
+        const unsigned int timeoutMs = callOptions.hasTimeout ? callOptions.timeoutMs 
+                                     : (priorityClass != SdkPriority::BULK ? executor.getDefaultTimeout() : SdkExecutor::NO_TIMEOUT);
+        if (timeoutMs != SdkExecutor::NO_TIMEOUT) {
+            deadlineValue = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        }
+
+        executor.submit(env, this);
+    }
+
+    /**
+     * Run the worker on the serial strand of a device, so it is executed in order with other work for the
+     * same device. Must be called before Queue().
+     */
+    void SetDeviceStrand(unsigned short deviceId) {
+        strandKey = deviceId;
+    }
+
+    /**
+     * Let the worker share the result of an identical in-flight worker. The key must identify the function
+     * and all its arguments. Only use for read-only work with value results. Must be called before Queue().
+     */
+    void SetCoalesceKey(const std::string& key) {
+        coalesceKeyValue = key;
+    }
+
+    /**
+     * Set scheduling priority class (default is NORMAL). Must be called before Queue().
+     */
+    void SetPriority(SdkPriority priority) {
+        priorityClass = priority;
+    }
+
+    /**
+     * Set timeout and cancellation id passed from javascript. Must be called before Queue().
+     */
+    void SetCallOptions(const CallOptions& options) {
+        callOptions = options;
+    }
+
+    int strand() const override {
+        return strandKey;
+    }
+
+    SdkPriority priority() const override {
+        return priorityClass;
+    }
+
+    const std::string& coalesceKey() const override {
+        return coalesceKeyValue;
+    }
+
+    std::chrono::steady_clock::time_point deadline() const override {
+        return deadlineValue;
+    }
+
+    int cancellationId() const override {
+        return callOptions.cancellationId;
+    }
+
+    void adoptResult(SdkTask& leader) override {
+        const SdkAsyncWorker& leaderWorker = static_cast<SdkAsyncWorker&>(leader);
+        errorMessage = leaderWorker.errorMessage;
+        skipped = leaderWorker.skipped;
+        skipReason = leaderWorker.skipReason;
+    }
+
+    void abandon(SdkAbandonReason reason) override {
+        Napi::HandleScope scope(env);
+        Napi::CallbackScope callbackScope(env, asyncContext);
+
+        DeliverError(AbandonedError(env, taskName, reason).Value());
+    }
+
+    void skip(SdkAbandonReason reason) override {
+        skipped = true;
+        skipReason = reason;
+    }
+
+    /**
+     * The promise settled with the result of a promise based worker. Only valid in the handle scope that created
+     * the worker, so get it before calling Queue().
+     */
+    Napi::Value Promise() const {
+        return Napi::Value(env, promise);
+    }
+
+    const char * name() const override {
+        return taskName;
+    }
+
+    void run() override {
+        Execute();
+    }
+
+    void complete() override {
+        Napi::HandleScope scope(env);
+        Napi::CallbackScope callbackScope(env, asyncContext);
+
+        if (settled) {
+            // Abandoned - javascript already has its error.
+            OnAbandoned();
+        } else if (skipped) {
+            DeliverError(AbandonedError(env, taskName, skipReason).Value());
+            OnAbandoned();
+        } else if (errorMessage.empty()) {
+            OnOK();
+        } else {
+            OnError(Napi::Error::New(env, errorMessage));
+        }
+    }
+
+  protected:
+    // Executed inside an executor thread - must NOT use any javascript / napi code or types.
+    virtual void Execute() = 0;
+
+    // Executed inside the main event loop when Execute succeeded.
+    virtual void OnOK() = 0;
+
+    // Executed inside the main event loop when Execute called SetError.
+    virtual void OnError(const Napi::Error& e) = 0;
+
+    // Executed inside the main event loop instead of OnOK/OnError when the worker was abandoned or skipped.
+    virtual void OnAbandoned() {}
+
+    Napi::Env Env() const {
+        return env;
+    }
+
+    Napi::FunctionReference& Callback() {
+        return callback;
+    }
+
+    Napi::ObjectReference& Receiver() {
+        return receiver;
+    }
+
+    bool HasPromise() const {
+        return deferred != nullptr;
+    }
+
+    /**
+     * Resolve the promise or call back with (undefined, result). Ignored if already settled.
+     */
+    void Deliver(napi_value result) {
+        if (settled) {
+            return;
+        }
+        settled = true;
+
+        if (deferred) {
+            const napi_status status = napi_resolve_deferred(env, deferred, result);
+            deferred = nullptr;
+            if (status != napi_ok) {
+                throw Napi::Error::New(env);
+            }
+        } else {
+            Callback().Call({ env.Undefined(), result });
+        }
+    }
+
+    /**
+     * Reject the promise or call back with (error). Ignored if already settled.
+     */
+    void DeliverError(napi_value error) {
+        if (settled) {
+            return;
+        }
+        settled = true;
+
+        if (deferred) {
+            const napi_status status = napi_reject_deferred(env, deferred, error);
+            deferred = nullptr;
+            if (status != napi_ok) {
+                throw Napi::Error::New(env);
+            }
+        } else {
+            Callback().Call(Receiver().Value(), std::initializer_list<napi_value>{ error });
+        }
+    }
+
+    void SetError(const std::string& error) {
+        errorMessage = error;
+    }
+};
+
+/**
+ * Cleanup function object doing nothing - default cleanup of BasicJAsyncWorker's and the high-level helpers.
+ */
+struct NoCleanup {
+    template <typename T>
+    void operator()(T& jabraData) const {}
+
+    void operator()() const {}
+};
+
+/**
+ * Async worker that can run any Jabra work function asynchronously, with the work, mapper and cleanup
+ * callables as template parameters.
  * 
- * Nb. Based on Napi::AsyncWorker that self-destorys (no explicit delete required)
+ * Unlike JAsyncWorker (which wraps its callables in std::function's), calls to the callables can be inlined
+ * and no memory is allocated beyond the worker itself. Used by the high-level helpers like f.x.
+ * SimpleDeviceAsyncFunction - create instances with MakeJAsyncWorker to get the callable types deduced.
+ * 
+ * Nb. Based on SdkAsyncWorker, so the work runs on the dedicated SdkExecutor and the worker 
+ * self-destroys (no explicit delete required).
  */
-template <typename JabraWorkReturnType, typename NapiReturnType>
-class JAsyncWorker : public Napi::AsyncWorker
+template <typename JabraWorkReturnType, typename NapiReturnType, typename WorkFunc, typename MapperFunc, typename CleanupFunc>
+class BasicJAsyncWorker : public SdkAsyncWorker
 {
   private:
     Jabra_ReturnCode errorCode;
     JabraWorkReturnType jabraResult;
     const char * const callerFunctionName;
-    const std::function<JabraWorkReturnType()> jabraWorkFunc;
-    const std::function<NapiReturnType(const Napi::Env& env, const JabraWorkReturnType& jabraData)> jabraToNapiMapperFunc;
-    const std::function<void(JabraWorkReturnType& jabraData)> jabraCleanupFunc;
+    WorkFunc jabraWorkFunc;
+    MapperFunc jabraToNapiMapperFunc;
+    CleanupFunc jabraCleanupFunc;
 
   public:
     /**
@@ -208,20 +553,36 @@ class JAsyncWorker : public Napi::AsyncWorker
      * @jabraToNapiMapperFunc Synchronous code converting the C data type to a javascript napi type.
      * @jabraCleanupFunc Synchronous code doing cleanup. 
      */
-    JAsyncWorker(const char * const callerFunctionName, 
-                 const Napi::Function &javascriptResultCallback, 
-                 const std::function<JabraWorkReturnType()>& jabraWorkFunc,
-                 const std::function<NapiReturnType(const Napi::Env& env, const JabraWorkReturnType& jabraData)>& jabraToNapiMapperFunc,
-                 const std::function<void(JabraWorkReturnType& jabraData)>& jabraCleanupFunc = [](JabraWorkReturnType& jabraData) {}
-                ) : Napi::AsyncWorker(javascriptResultCallback), errorCode(Jabra_ReturnCode::Return_Ok), jabraResult(), callerFunctionName(callerFunctionName), jabraWorkFunc(jabraWorkFunc), jabraToNapiMapperFunc(jabraToNapiMapperFunc), jabraCleanupFunc(jabraCleanupFunc) {}
-    JAsyncWorker(const JAsyncWorker&) = delete;
-    ~JAsyncWorker() {}
+    BasicJAsyncWorker(const char * const callerFunctionName, 
+                      const Napi::Function &javascriptResultCallback, 
+                      WorkFunc jabraWorkFunc,
+                      MapperFunc jabraToNapiMapperFunc,
+                      CleanupFunc jabraCleanupFunc
+                     ) : SdkAsyncWorker(callerFunctionName, javascriptResultCallback), errorCode(Jabra_ReturnCode::Return_Ok), jabraResult(), callerFunctionName(callerFunctionName), 
+                         jabraWorkFunc(std::move(jabraWorkFunc)), jabraToNapiMapperFunc(std::move(jabraToNapiMapperFunc)), jabraCleanupFunc(std::move(jabraCleanupFunc)) {}
+
+    /**
+     * Construct a new promise based worker (see Promise()). Arguments as above except for the callback.
+     */
+    BasicJAsyncWorker(const char * const callerFunctionName, 
+                      const Napi::Env &env, 
+                      WorkFunc jabraWorkFunc,
+                      MapperFunc jabraToNapiMapperFunc,
+                      CleanupFunc jabraCleanupFunc
+                     ) : SdkAsyncWorker(callerFunctionName, env), errorCode(Jabra_ReturnCode::Return_Ok), jabraResult(), callerFunctionName(callerFunctionName), 
+                         jabraWorkFunc(std::move(jabraWorkFunc)), jabraToNapiMapperFunc(std::move(jabraToNapiMapperFunc)), jabraCleanupFunc(std::move(jabraCleanupFunc)) {}
+    BasicJAsyncWorker(const BasicJAsyncWorker&) = delete;
+    ~BasicJAsyncWorker() {}
 
     void okError(const Napi::Env& env, const std::string& errorMsg, bool duringJsCallback) {
         LOG_ERROR_(LOGINSTANCE) << errorMsg;
         try {
             if (!duringJsCallback) {
-                Callback().Call({ Napi::String::New(env, errorMsg), env.Undefined() });
+                if (HasPromise()) {
+                    DeliverError(Napi::Error::New(env, errorMsg).Value());
+                } else {
+                    Callback().Call({ Napi::String::New(env, errorMsg), env.Undefined() });
+                }
             }
         } catch (const std::exception &e) {
             LOG_ERROR_(LOGINSTANCE) << "Failed calling error callback with details " + std::string(e.what());
@@ -240,7 +601,7 @@ class JAsyncWorker : public Napi::AsyncWorker
     // It is not safe to access JS engine data structure
     // here, so everything we need for input and output
     // should go on `this`.
-    void Execute()
+    void Execute() override
     {
         try
         {
@@ -270,6 +631,16 @@ class JAsyncWorker : public Napi::AsyncWorker
         }
     }
 
+    // Executed inside the worker-thread (instead of Execute) when coalesced with an identical worker.
+    void adoptResult(SdkTask& leader) override
+    {
+        BasicJAsyncWorker& leaderWorker = static_cast<BasicJAsyncWorker&>(leader);
+        SdkAsyncWorker::adoptResult(leader);
+        errorCode = leaderWorker.errorCode;
+        jabraResult = leaderWorker.jabraResult;
+        LOG_VERBOSE_(LOGINSTANCE) << "JAsyncWorker: " << callerFunctionName << " shared result of identical call in flight.";
+    }
+
     void cleanup() {
         try {
             LOG_VERBOSE_(LOGINSTANCE) << "JAsyncWorker: " << callerFunctionName << " started cleanup.";
@@ -285,7 +656,7 @@ class JAsyncWorker : public Napi::AsyncWorker
     // Executed when the async work is complete
     // this function will be run inside the main event loop
     // so it is safe to use JS engine data again
-    void OnOK()
+    void OnOK() override
     {
         Napi::Env env = Env();
         Napi::HandleScope scope(env);
@@ -299,7 +670,7 @@ class JAsyncWorker : public Napi::AsyncWorker
             
             callBackError = true;
             // TODO: Should Receiver().Value() be passed as first arg ?
-            Callback().Call({ env.Undefined(), napiResult });
+            Deliver(napiResult);
             callBackError = false;
         }
         catch (const JabraReturnCodeException &e)
@@ -329,7 +700,7 @@ class JAsyncWorker : public Napi::AsyncWorker
     // Executed when the async work fails.
     // this function will be run inside the main event loop
     // so it is safe to use JS engine data again
-    void OnError(const Napi::Error& e) 
+    void OnError(const Napi::Error& e) override
     {
         try {
             Napi::Env env = e.Env();
@@ -340,7 +711,7 @@ class JAsyncWorker : public Napi::AsyncWorker
                 mutableError.Set(Napi::String::New(env, "code"), (Napi::Number::New(env, (int)errorCode)));
             }
 
-            Callback().Call(Receiver().Value(), std::initializer_list<napi_value>{ mutableError.Value() });
+            DeliverError(mutableError.Value());
         } catch (const std::exception &e) {
             LOG_ERROR_(LOGINSTANCE) << "Failed calling error callback with details " + std::string(e.what());
         } catch (...) {
@@ -349,26 +720,28 @@ class JAsyncWorker : public Napi::AsyncWorker
 
         cleanup();
     }
+
+    // Executed instead of OnOK/OnError when the worker was abandoned or skipped.
+    void OnAbandoned() override
+    {
+        LOG_VERBOSE_(LOGINSTANCE) << "JAsyncWorker: " << callerFunctionName << " result dropped as call was abandoned.";
+        cleanup();
+    }
 };
 
 /**
- * Async worker utility specilization that can run any Jabra (lambda) work procedure asynchronously.
- * 
- * Use this version when nothing should be returned from the async work other than a notification that
- * it is completed (by calling the callback).
- * 
- * See full template of JAsyncWorker template for additional information !
+ * As BasicJAsyncWorker, but for Jabra work procedures where nothing should be returned from the async work other
+ * than a notification that it is completed. Create instances with MakeJAsyncVoidWorker.
  */
-template <>
-class JAsyncWorker<void,void> : public Napi::AsyncWorker
+template <typename WorkFunc, typename CleanupFunc>
+class BasicJAsyncVoidWorker : public SdkAsyncWorker
 {
   private:
-    typedef Napi::AsyncWorker base;
 
     Jabra_ReturnCode errorCode;
     const char * const callerFunctionName;
-    const std::function<void()> jabraWorkFunc;
-    const std::function<void()> jabraCleanupFunc;
+    WorkFunc jabraWorkFunc;
+    CleanupFunc jabraCleanupFunc;
 
   public:
     /**
@@ -378,13 +751,24 @@ class JAsyncWorker<void,void> : public Napi::AsyncWorker
      * @jabraWorkFunc The async code (jabra sdk call) return a C data type (must NOT use any javascript / napi code or types).
      * @jabraCleanupFunc Synchronous code doing cleanup.
      */
-    JAsyncWorker(const char * const callerFunctionName, 
-                 const Napi::Function &javascriptResultCallback, 
-                 const std::function<void()>& jabraWorkFunc,
-                 const std::function<void()>& jabraCleanupFunc = [](){}
-                ) : Napi::AsyncWorker(javascriptResultCallback), errorCode(Jabra_ReturnCode::Return_Ok), callerFunctionName(callerFunctionName), jabraWorkFunc(jabraWorkFunc), jabraCleanupFunc(jabraCleanupFunc) {}
-    JAsyncWorker(const JAsyncWorker&) = delete;
-    ~JAsyncWorker() {}
+    BasicJAsyncVoidWorker(const char * const callerFunctionName, 
+                          const Napi::Function &javascriptResultCallback, 
+                          WorkFunc jabraWorkFunc,
+                          CleanupFunc jabraCleanupFunc
+                         ) : SdkAsyncWorker(callerFunctionName, javascriptResultCallback), errorCode(Jabra_ReturnCode::Return_Ok), callerFunctionName(callerFunctionName), 
+                             jabraWorkFunc(std::move(jabraWorkFunc)), jabraCleanupFunc(std::move(jabraCleanupFunc)) {}
+
+    /**
+     * Create a new promise based worker (see Promise()). Arguments as above except for the callback.
+     */
+    BasicJAsyncVoidWorker(const char * const callerFunctionName, 
+                          const Napi::Env &env, 
+                          WorkFunc jabraWorkFunc,
+                          CleanupFunc jabraCleanupFunc
+                         ) : SdkAsyncWorker(callerFunctionName, env), errorCode(Jabra_ReturnCode::Return_Ok), callerFunctionName(callerFunctionName), 
+                             jabraWorkFunc(std::move(jabraWorkFunc)), jabraCleanupFunc(std::move(jabraCleanupFunc)) {}
+    BasicJAsyncVoidWorker(const BasicJAsyncVoidWorker&) = delete;
+    ~BasicJAsyncVoidWorker() {}
 
     void executeError(const std::string& errorMsg, const Jabra_ReturnCode _errorCode = Jabra_ReturnCode::Return_Ok) {
         LOG_ERROR_(LOGINSTANCE) << errorMsg;
@@ -396,7 +780,7 @@ class JAsyncWorker<void,void> : public Napi::AsyncWorker
     // It is not safe to access JS engine data structure
     // here, so everything we need for input and output
     // should go on `this`.
-    void Execute()
+    void Execute() override
     {
         try
         {
@@ -426,6 +810,13 @@ class JAsyncWorker<void,void> : public Napi::AsyncWorker
         }
     }
 
+    // Executed inside the worker-thread (instead of Execute) when coalesced with an identical worker.
+    void adoptResult(SdkTask& leader) override
+    {
+        SdkAsyncWorker::adoptResult(leader);
+        errorCode = static_cast<BasicJAsyncVoidWorker&>(leader).errorCode;
+    }
+
     void cleanup() {
         try {
             LOG_VERBOSE_(LOGINSTANCE) << "JAsyncWorker: " << callerFunctionName << " started cleanup.";
@@ -441,13 +832,13 @@ class JAsyncWorker<void,void> : public Napi::AsyncWorker
     // Executed when the async work is complete
     // this function will be run inside the main event loop
     // so it is safe to use JS engine data again
-    void OnOK()
+    void OnOK() override
     {
         Napi::Env env = Env();
         Napi::HandleScope scope(env);
 
         try {
-            Callback().Call({ env.Undefined(), env.Undefined() });
+            Deliver(env.Undefined());
         } catch (const std::exception &e) {
             LOG_ERROR_(LOGINSTANCE) << "JAsyncWorker ok callback failure with details " + std::string(e.what());
         } catch (...) {
@@ -460,7 +851,7 @@ class JAsyncWorker<void,void> : public Napi::AsyncWorker
     // Executed when the async work fails.
     // this function will be run inside the main event loop
     // so it is safe to use JS engine data again
-    void OnError(const Napi::Error& e) 
+    void OnError(const Napi::Error& e) override
     {
         try {
             Napi::Env env = e.Env();
@@ -471,7 +862,7 @@ class JAsyncWorker<void,void> : public Napi::AsyncWorker
                 mutableError.Set(Napi::String::New(env, "code"), (Napi::Number::New(env, (int)errorCode)));
             }
 
-            Callback().Call(Receiver().Value(), std::initializer_list<napi_value>{ mutableError.Value() });
+            DeliverError(mutableError.Value());
         } catch (const std::exception &e) {
             LOG_ERROR_(LOGINSTANCE) << "JAsyncWorker error callback failure with details " + std::string(e.what());
         } catch (...) {
@@ -480,123 +871,355 @@ class JAsyncWorker<void,void> : public Napi::AsyncWorker
 
         cleanup();
     }
+
+    // Executed instead of OnOK/OnError when the worker was abandoned or skipped.
+    void OnAbandoned() override
+    {
+        LOG_VERBOSE_(LOGINSTANCE) << "JAsyncWorker: " << callerFunctionName << " result dropped as call was abandoned.";
+        cleanup();
+    }
 };
 
+/**
+ * Async worker utility that can run any Jabra (lambda) work function asynchronously.
+ * 
+ * This is the central worker that (almost all) n-api implementations of Jabra functions 
+ * should use to make sure code is non-blocking. This utility may be used directly for
+ * complex cases or indirectly thorugh high-level helpers like f.x. SimpleDeviceAsyncFunction 
+ * for simple cases.
+ * 
+ * The sole exception where this worker should NOT be used, is for handling Jabra c-callbacks
+ * in init and eventhandlers!
+ * 
+ * Nb. A BasicJAsyncWorker with std::function callables, so worker types only depend on the result types. Hot
+ * paths should prefer MakeJAsyncWorker, which avoids the std::function allocations and indirect calls.
+ */
+template <typename JabraWorkReturnType, typename NapiReturnType>
+class JAsyncWorker : public BasicJAsyncWorker<JabraWorkReturnType, NapiReturnType, 
+                                              std::function<JabraWorkReturnType()>,
+                                              std::function<NapiReturnType(const Napi::Env& env, const JabraWorkReturnType& jabraData)>,
+                                              std::function<void(JabraWorkReturnType& jabraData)>>
+{
+  private:
+    typedef BasicJAsyncWorker<JabraWorkReturnType, NapiReturnType, 
+                              std::function<JabraWorkReturnType()>,
+                              std::function<NapiReturnType(const Napi::Env& env, const JabraWorkReturnType& jabraData)>,
+                              std::function<void(JabraWorkReturnType& jabraData)>> Base;
+
+  public:
+    /**
+     * Construct a new worker - see BasicJAsyncWorker.
+     */
+    JAsyncWorker(const char * const callerFunctionName, 
+                 const Napi::Function &javascriptResultCallback, 
+                 const std::function<JabraWorkReturnType()>& jabraWorkFunc,
+                 const std::function<NapiReturnType(const Napi::Env& env, const JabraWorkReturnType& jabraData)>& jabraToNapiMapperFunc,
+                 const std::function<void(JabraWorkReturnType& jabraData)>& jabraCleanupFunc = [](JabraWorkReturnType& jabraData) {}
+                ) : Base(callerFunctionName, javascriptResultCallback, jabraWorkFunc, jabraToNapiMapperFunc, jabraCleanupFunc) {}
+
+    /**
+     * Construct a new promise based worker (see Promise()). Arguments as above except for the callback.
+     */
+    JAsyncWorker(const char * const callerFunctionName, 
+                 const Napi::Env &env, 
+                 const std::function<JabraWorkReturnType()>& jabraWorkFunc,
+                 const std::function<NapiReturnType(const Napi::Env& env, const JabraWorkReturnType& jabraData)>& jabraToNapiMapperFunc,
+                 const std::function<void(JabraWorkReturnType& jabraData)>& jabraCleanupFunc = [](JabraWorkReturnType& jabraData) {}
+                ) : Base(callerFunctionName, env, jabraWorkFunc, jabraToNapiMapperFunc, jabraCleanupFunc) {}
+};
+
+/**
+ * Async worker utility specilization that can run any Jabra (lambda) work procedure asynchronously.
+ * 
+ * Use this version when nothing should be returned from the async work other than a notification that
+ * it is completed (by calling the callback).
+ * 
+ * See full template of JAsyncWorker template for additional information !
+ */
+template <>
+class JAsyncWorker<void,void> : public BasicJAsyncVoidWorker<std::function<void()>, std::function<void()>>
+{
+  public:
+    /**
+     * Create a new worker - see BasicJAsyncVoidWorker.
+     */
+    JAsyncWorker(const char * const callerFunctionName, 
+                 const Napi::Function &javascriptResultCallback, 
+                 const std::function<void()>& jabraWorkFunc,
+                 const std::function<void()>& jabraCleanupFunc = [](){}
+                ) : BasicJAsyncVoidWorker(callerFunctionName, javascriptResultCallback, jabraWorkFunc, jabraCleanupFunc) {}
+
+    /**
+     * Create a new promise based worker (see Promise()). Arguments as above except for the callback.
+     */
+    JAsyncWorker(const char * const callerFunctionName, 
+                 const Napi::Env &env, 
+                 const std::function<void()>& jabraWorkFunc,
+                 const std::function<void()>& jabraCleanupFunc = [](){}
+                ) : BasicJAsyncVoidWorker(callerFunctionName, env, jabraWorkFunc, jabraCleanupFunc) {}
+};
+
+/**
+ * Create a new promise based BasicJAsyncWorker with callable types deduced from the arguments (see BasicJAsyncWorker
+ * for a description of the arguments).
+ */
+template <typename JabraWorkReturnType, typename NapiReturnType, typename WorkFunc, typename MapperFunc, typename CleanupFunc = NoCleanup>
+BasicJAsyncWorker<JabraWorkReturnType, NapiReturnType, WorkFunc, MapperFunc, CleanupFunc> * MakeJAsyncWorker(const char * const callerFunctionName,
+                                                                                                            const Napi::Env &env,
+                                                                                                            WorkFunc jabraWorkFunc,
+                                                                                                            MapperFunc jabraToNapiMapperFunc,
+                                                                                                            CleanupFunc jabraCleanupFunc = CleanupFunc()) {
+    return new BasicJAsyncWorker<JabraWorkReturnType, NapiReturnType, WorkFunc, MapperFunc, CleanupFunc>(
+        callerFunctionName, env, std::move(jabraWorkFunc), std::move(jabraToNapiMapperFunc), std::move(jabraCleanupFunc));
+}
+
+/**
+ * Create a new promise based BasicJAsyncVoidWorker with callable types deduced from the arguments.
+ */
+template <typename WorkFunc, typename CleanupFunc = NoCleanup>
+BasicJAsyncVoidWorker<WorkFunc, CleanupFunc> * MakeJAsyncVoidWorker(const char * const callerFunctionName,
+                                                                    const Napi::Env &env,
+                                                                    WorkFunc jabraWorkFunc,
+                                                                    CleanupFunc jabraCleanupFunc = CleanupFunc()) {
+    return new BasicJAsyncVoidWorker<WorkFunc, CleanupFunc>(callerFunctionName, env, std::move(jabraWorkFunc), std::move(jabraCleanupFunc));
+}
+
+/**
+* Get a promise rejected with the pending javascript exception (f.x. from a failed verifyArguments). Used by
+* promise based functions, so argument errors are reported like all other errors rather than thrown.
+**/
+inline Napi::Value RejectedPromise(const Napi::Env& env, const char * const callerFunctionName) {
+    Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+    if (env.IsExceptionPending()) {
+        deferred.Reject(env.GetAndClearPendingException().Value());
+    } else {
+        deferred.Reject(Napi::Error::New(env, "Invalid arguments to " + std::string(callerFunctionName)).Value());
+    }
+    return deferred.Promise();
+}
+
+/**
+* Get a promise already resolved with a value. Used by promise based functions that can answer without async work.
+**/
+inline Napi::Value ResolvedPromise(const Napi::Env& env, const Napi::Value& value) {
+    Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+    deferred.Resolve(value);
+    return deferred.Promise();
+}
+
+/**
+* Get a promise rejected with an AbortError. Used by promise based functions called with an already aborted cancellation token.
+**/
+inline Napi::Value AbortedPromise(const Napi::Env& env, const char * const callerFunctionName) {
+    Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+    deferred.Reject(AbandonedError(env, callerFunctionName, SdkAbandonReason::CANCELLED).Value());
+    return deferred.Promise();
+}
+
 /** 
 * Does all the skeleton work for a simple call to a async jabra call without arguments returning
-* a specific node type by a callback. The specific jabraWorkFunc function should do the actual async work, while jabraToNapiMapperFunc 
-* should convert the managed c++ result to a napi type that can be passed to the callback.
+* a specific node type by a promise. The specific jabraWorkFunc function should do the actual async work, while jabraToNapiMapperFunc 
+* should convert the managed c++ result to a napi type that the promise is resolved with.
+*
+* Javascript may pass CallOptions (timeout/cancellation) as an optional trailing argument.
 *
 * @callerFunctionName Thread-invariant name of function calling this code used for documentation (should generally be called with __func__).
+* @options Scheduling hints (f.x. AsyncOptions::ReadOnly() to share results of identical calls in flight or a priority class).
 * @info The javascript n-api function parameter informaton.
 * @jabraWorkFunc The async code (jabra sdk call) return a C data type (must NOT use any javascript / napi code or types).
 * @jabraToNapiMapperFunc Synchronous code converting the C data type to a javascript napi type.
 * @jabraCleanupFunc Synchronous code doing cleanup. 
 **/
-template <typename NapiReturnType, typename cppReturnType>
+template <typename NapiReturnType, typename cppReturnType, typename WorkFunc, typename MapperFunc, typename CleanupFunc = NoCleanup>
 Napi::Value SimpleAsyncFunction(const char * const callerFunctionName,
+                                      const AsyncOptions& options,
                                       const Napi::CallbackInfo &info, 
-                                      const std::function<cppReturnType ()>& jabraWorkFunc,
-                                      const std::function<NapiReturnType(const Napi::Env& env, const cppReturnType& jabraData)>& jabraToNapiMapperFunc,
-                                      const std::function<void(cppReturnType& jabraData)>& jabraCleanupFunc = [](cppReturnType& jabraData) {}
+                                      const WorkFunc& jabraWorkFunc,
+                                      const MapperFunc& jabraToNapiMapperFunc,
+                                      const CleanupFunc& jabraCleanupFunc = CleanupFunc()
                                      )
 {
     Napi::Env env = info.Env();
+    CallOptions callOptions;
 
-    if (util::verifyArguments(callerFunctionName, info, { util::FUNCTION }))
+    if (util::verifyArgumentsWithCallOptions(callerFunctionName, info, { }, callOptions))
     {
-        Napi::Function javascriptResultCallback = info[0].As<Napi::Function>();
+        if (callOptions.aborted) {
+            return AbortedPromise(env, callerFunctionName);
+        }
 
-        auto *const worker = new util::JAsyncWorker<cppReturnType, NapiReturnType>
+        auto *const worker = MakeJAsyncWorker<cppReturnType, NapiReturnType>
               (callerFunctionName, 
-               javascriptResultCallback, 
+               env, 
                jabraWorkFunc,
                jabraToNapiMapperFunc,
                jabraCleanupFunc
               );
 
+        worker->SetPriority(options.priority);
+        worker->SetCallOptions(callOptions);
+        if (options.readOnly) {
+            worker->SetCoalesceKey(callerFunctionName);
+        }
+
+        const Napi::Value promise = worker->Promise();
         worker->Queue();
+        return promise;
     }
 
-    return env.Undefined();
+    return RejectedPromise(env, callerFunctionName);
+};
+
+/** 
+* As SimpleAsyncFunction above with default options.
+**/
+template <typename NapiReturnType, typename cppReturnType, typename WorkFunc, typename MapperFunc, typename CleanupFunc = NoCleanup>
+Napi::Value SimpleAsyncFunction(const char * const callerFunctionName,
+                                      const Napi::CallbackInfo &info, 
+                                      const WorkFunc& jabraWorkFunc,
+                                      const MapperFunc& jabraToNapiMapperFunc,
+                                      const CleanupFunc& jabraCleanupFunc = CleanupFunc()
+                                     )
+{
+    return SimpleAsyncFunction<NapiReturnType, cppReturnType>(callerFunctionName, AsyncOptions(), info, jabraWorkFunc, jabraToNapiMapperFunc, jabraCleanupFunc);
 };
 
 
 /** 
 * Does all the skeleton work for a simple call to a async jabra call taking a deviceid as sole argument and returning
-* a specific node type by a callback. The specific jabraWorkFunc function should do the actual async work, while jabraToNapiMapperFunc 
-* should convert the managed c++ result to a napi type that can be passed to the callback.
+* a specific node type by a promise. The specific jabraWorkFunc function should do the actual async work, while jabraToNapiMapperFunc 
+* should convert the managed c++ result to a napi type that the promise is resolved with.
+*
+* The work is run on the device strand, i.e. in order with other work for the same device. Javascript may pass CallOptions
+* (timeout/cancellation) as an optional trailing argument.
 *
 * @callerFunctionName Thread-invariant name of function calling this code used for documentation (should generally be called with __func__).
+* @options Scheduling hints (f.x. AsyncOptions::ReadOnly() to share results of identical calls in flight or a priority class).
 * @info The javascript n-api function parameter informaton.
 * @jabraWorkFunc The async code (jabra sdk call) return a C data type (must NOT use any javascript / napi code or types).
 * @jabraToNapiMapperFunc Synchronous code converting the C data type to a javascript napi type.
 * @jabraCleanupFunc Synchronous code doing cleanup. 
 **/
-template <typename NapiReturnType, typename cppReturnType>
+template <typename NapiReturnType, typename cppReturnType, typename WorkFunc, typename MapperFunc, typename CleanupFunc = NoCleanup>
 Napi::Value SimpleDeviceAsyncFunction(const char * const callerFunctionName,
+                                      const AsyncOptions& options,
                                       const Napi::CallbackInfo &info, 
-                                      const std::function<cppReturnType (unsigned short)>& jabraWorkFunc,
-                                      const std::function<NapiReturnType(const Napi::Env& env, const cppReturnType& jabraData)>& jabraToNapiMapperFunc,
-                                      const std::function<void(cppReturnType& jabraData)>& jabraCleanupFunc = [](cppReturnType& jabraData) {}
+                                      const WorkFunc& jabraWorkFunc,
+                                      const MapperFunc& jabraToNapiMapperFunc,
+                                      const CleanupFunc& jabraCleanupFunc = CleanupFunc()
                                      )
 {
     Napi::Env env = info.Env();
+    CallOptions callOptions;
 
-    if (util::verifyArguments(callerFunctionName, info, {util::NUMBER, util::FUNCTION}))
+    if (util::verifyArgumentsWithCallOptions(callerFunctionName, info, {util::NUMBER}, callOptions))
     {
+        if (callOptions.aborted) {
+            return AbortedPromise(env, callerFunctionName);
+        }
+
         const unsigned short deviceId = info[0].As<Napi::Number>().Int32Value();
-        Napi::Function javascriptResultCallback = info[1].As<Napi::Function>();
 
-        auto *const worker = new util::JAsyncWorker<cppReturnType, NapiReturnType>
+        auto *const worker = MakeJAsyncWorker<cppReturnType, NapiReturnType>
               (callerFunctionName, 
-               javascriptResultCallback, 
-               std::bind(jabraWorkFunc, deviceId),
+               env, 
+               [jabraWorkFunc, deviceId]() mutable { return jabraWorkFunc(deviceId); },
                jabraToNapiMapperFunc,
                jabraCleanupFunc
               );
 
+        worker->SetDeviceStrand(deviceId);
+        worker->SetPriority(options.priority);
+        worker->SetCallOptions(callOptions);
+        if (options.readOnly) {
+            worker->SetCoalesceKey(std::string(callerFunctionName) + "/" + std::to_string(deviceId));
+        }
+
+        const Napi::Value promise = worker->Promise();
         worker->Queue();
+        return promise;
     }
 
-    return env.Undefined();
+    return RejectedPromise(env, callerFunctionName);
+};
+
+/** 
+* As SimpleDeviceAsyncFunction above with default options.
+**/
+template <typename NapiReturnType, typename cppReturnType, typename WorkFunc, typename MapperFunc, typename CleanupFunc = NoCleanup>
+Napi::Value SimpleDeviceAsyncFunction(const char * const callerFunctionName,
+                                      const Napi::CallbackInfo &info, 
+                                      const WorkFunc& jabraWorkFunc,
+                                      const MapperFunc& jabraToNapiMapperFunc,
+                                      const CleanupFunc& jabraCleanupFunc = CleanupFunc()
+                                     )
+{
+    return SimpleDeviceAsyncFunction<NapiReturnType, cppReturnType>(callerFunctionName, AsyncOptions(), info, jabraWorkFunc, jabraToNapiMapperFunc, jabraCleanupFunc);
 };
 
 
 /** 
-* Does all the skeleton work for a simple call to a async jabra setter taking a deviceid and a boolean as arguments with no result.
-* The specific jabraWorkFunc function should do the actual async work
+* Does all the skeleton work for a simple call to a async jabra setter taking a deviceid and a boolean as arguments, returning
+* a promise resolved with undefined.
+* The specific jabraWorkFunc function should do the actual async work, which is run on the device strand, i.e. in order with
+* other work for the same device. Javascript may pass CallOptions (timeout/cancellation) as an optional trailing argument.
 *
 * @callerFunctionName Thread-invariant name of function calling this code used for documentation (should generally be called with __func__).
+* @options Scheduling hints (f.x. AsyncOptions::CallControl() for call-control commands).
 * @info The javascript n-api function parameter informaton.
 * @jabraWorkFunc The async code (jabra sdk call) return a C data type (must NOT use any javascript / napi code or types).
 * @jabraCleanupFunc Synchronous code doing cleanup. 
 **/
-inline Napi::Value SimpleDeviceAsyncBoolSetter(const char * const callerFunctionName,
+template <typename WorkFunc, typename CleanupFunc = NoCleanup>
+Napi::Value SimpleDeviceAsyncBoolSetter(const char * const callerFunctionName,
+                                               const AsyncOptions& options,
                                                const Napi::CallbackInfo &info, 
-                                               const std::function<void (unsigned short, bool enable)>& jabraWorkFunc,
-                                               const std::function<void()>& jabraCleanupFunc = []() {}
+                                               const WorkFunc& jabraWorkFunc,
+                                               const CleanupFunc& jabraCleanupFunc = CleanupFunc()
                                               )
 {
     Napi::Env env = info.Env();
+    CallOptions callOptions;
 
-    if (util::verifyArguments(callerFunctionName, info, {util::NUMBER, util::BOOLEAN, util::FUNCTION}))
+    if (util::verifyArgumentsWithCallOptions(callerFunctionName, info, {util::NUMBER, util::BOOLEAN}, callOptions))
     {
+        if (callOptions.aborted) {
+            return AbortedPromise(env, callerFunctionName);
+        }
+
         const unsigned short deviceId = info[0].As<Napi::Number>().Int32Value();
         const bool enable = info[1].As<Napi::Boolean>().ToBoolean();
-        Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-        auto *const worker = new util::JAsyncWorker<void, void>
+        auto *const worker = MakeJAsyncVoidWorker
               (callerFunctionName, 
-               javascriptResultCallback, 
-               std::bind(jabraWorkFunc, deviceId, enable),
+               env, 
+               [jabraWorkFunc, deviceId, enable]() mutable { jabraWorkFunc(deviceId, enable); },
                jabraCleanupFunc
               );
 
+        worker->SetDeviceStrand(deviceId);
+        worker->SetPriority(options.priority);
+        worker->SetCallOptions(callOptions);
+
+        const Napi::Value promise = worker->Promise();
         worker->Queue();
+        return promise;
     }
 
-    return env.Undefined();
+    return RejectedPromise(env, callerFunctionName);
+};
+
+/** 
+* As SimpleDeviceAsyncBoolSetter above with default options.
+**/
+template <typename WorkFunc, typename CleanupFunc = NoCleanup>
+Napi::Value SimpleDeviceAsyncBoolSetter(const char * const callerFunctionName,
+                                               const Napi::CallbackInfo &info, 
+                                               const WorkFunc& jabraWorkFunc,
+                                               const CleanupFunc& jabraCleanupFunc = CleanupFunc()
+                                              )
+{
+    return SimpleDeviceAsyncBoolSetter(callerFunctionName, AsyncOptions(), info, jabraWorkFunc, jabraCleanupFunc);
 };
 
 
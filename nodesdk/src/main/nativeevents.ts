@@ -0,0 +1,192 @@
+import { AddonLogSeverity, DeviceInfo, PairedListInfo, DectInfo, DevLogData, JabraError, NativeStartupMetrics, DeviceIdentity } from "./core-types";
+import { enumDeviceBtnType, enumFirmwareEventType, enumFirmwareEventStatus, enumUploadEventStatus,
+         enumRemoteMmiType, enumRemoteMmiInput } from './jabra-enums';
+import { _JabraNativeAddonLog } from './logger';
+
+/**
+ * Kinds of events delivered by the native event channel.
+ *
+ * Nb. Must be kept in sync with NativeEventType in eventchannel.h.
+ *
+ * @internal
+ * @hidden
+ */
+export const enum NativeEventType {
+    initialized = 0,
+    firstScanDone = 1,
+    attached = 2,
+    detached = 3,
+    buttonInDataTranslated = 4,
+    devLog = 5,
+    batteryStatus = 6,
+    remoteMmi = 7,
+    firmwareProgress = 8,
+    uploadProgress = 9,
+    pairingList = 10,
+    gnpButton = 11,
+    dectInfo = 12
+}
+
+/**
+ * An event from the native event channel: The NativeEventType followed by the event arguments.
+ *
+ * @internal
+ * @hidden
+ */
+export type NativeEvent = [NativeEventType, ...any[]];
+
+/**
+ * Layout of the packed little-endian records of fixed-size events in binary event mode.
+ *
+ * Nb. Must be kept in sync with RECORD_* in eventchannel.h.
+ *
+ * @internal
+ * @hidden
+ */
+export const enum NativeEventRecordLayout {
+    size = 24,
+    typeOffset = 0,        // uint8
+    flagsOffset = 1,       // uint8
+    deviceIdOffset = 2,    // uint16
+    value0Offset = 4,      // int32 (events array index of boxed events)
+    value1Offset = 8,      // int32
+    value2Offset = 12,     // int32
+    timeOffset = 16,       // float64
+    flag0 = 0x01,
+    flag1 = 0x02,
+    flagBoxed = 0x80       // Event is not fixed-size - its NativeEvent is in the events array.
+}
+
+/**
+ * Receives batches of native events. In binary event mode, every event in the batch has a record
+ * in records (recordCount in total, in order), and events only holds the events without a
+ * fixed-size record (undefined if there are none). The records buffer is reused by the next batch,
+ * so it must be decoded right away.
+ *
+ * @internal
+ * @hidden
+ */
+export type NativeEventDispatcher = (events: NativeEvent[] | undefined, records?: ArrayBuffer, recordCount?: number) => void;
+
+/**
+ * Handlers for all native events. Handlers must not throw (errors are logged if they do).
+ *
+ * @internal
+ * @hidden
+ */
+export interface NativeEventHandlers {
+    initialized: (error: JabraError | undefined, startupTiming?: NativeStartupMetrics) => void;
+    firstScanDone: (event_time_ms: number) => void;
+    attached: (deviceInfo: DeviceInfo, event_time_ms: number, identity?: DeviceIdentity) => void;
+    detached: (deviceId: number, event_time_ms: number) => void;
+    buttonInDataTranslated: (deviceId: number, translatedInData: enumDeviceBtnType, buttonInData: boolean) => void;
+    devLog: (deviceId: number, data: DevLogData) => void;
+    batteryStatus: (deviceId: number, levelInPercent: number, isCharging: boolean, isBatteryLow: boolean) => void;
+    remoteMmi: (deviceId: number, type: enumRemoteMmiType, input: enumRemoteMmiInput) => void;
+    firmwareProgress: (deviceId: number, type: enumFirmwareEventType, status: enumFirmwareEventStatus, dwnFirmPercentage: number) => void;
+    uploadProgress: (deviceId: number, status: enumUploadEventStatus, percentage: number) => void;
+    pairingList: (deviceId: number, pairedListInfo: PairedListInfo) => void;
+    /* Pressed buttons as flattened (buttonTypeKey, key) pairs - see DeviceType._resolveGnpButtonEvents. */
+    gnpButton: (deviceId: number, buttonPairs: number[], catalogueRevision: number) => void;
+    dectInfo: (deviceId: number, dectInfo: DectInfo) => void;
+}
+
+/**
+ * Create the dispatcher passed to the native Initialize, calling the handler of each event in a
+ * delivered batch in order.
+ *
+ * @internal
+ * @hidden
+ */
+export function _createNativeEventDispatcher(handlers: NativeEventHandlers): NativeEventDispatcher {
+    // Indexed by NativeEventType:
+    const handlersByType: Array<(...args: any[]) => void> = [
+        handlers.initialized,
+        handlers.firstScanDone,
+        handlers.attached,
+        handlers.detached,
+        handlers.buttonInDataTranslated,
+        handlers.devLog,
+        handlers.batteryStatus,
+        handlers.remoteMmi,
+        handlers.firmwareProgress,
+        handlers.uploadProgress,
+        handlers.pairingList,
+        handlers.gnpButton,
+        handlers.dectInfo
+    ];
+
+    const dispatch = (event: NativeEvent) => {
+        const handler = handlersByType[event[0]];
+        if (handler) {
+            // Events have at most 4 arguments - passing them directly avoids copying each event.
+            handler(event[1], event[2], event[3], event[4]);
+        } else {
+            _JabraNativeAddonLog(AddonLogSeverity.error, "_createNativeEventDispatcher", "Unknown native event type " + event[0]);
+        }
+    };
+
+    // The native record buffer is allocated once, so the view on it is only created once too.
+    let recordView: DataView | undefined;
+
+    const dispatchRecord = (view: DataView, offset: number, events: NativeEvent[] | undefined) => {
+        const type: NativeEventType = view.getUint8(offset + NativeEventRecordLayout.typeOffset);
+        const flags = view.getUint8(offset + NativeEventRecordLayout.flagsOffset);
+        const value0 = view.getInt32(offset + NativeEventRecordLayout.value0Offset, true);
+        if (flags & NativeEventRecordLayout.flagBoxed) {
+            dispatch(events![value0]);
+            return;
+        }
+
+        const deviceId = view.getUint16(offset + NativeEventRecordLayout.deviceIdOffset, true);
+        switch (type) {
+            case NativeEventType.detached:
+                handlers.detached(deviceId, view.getFloat64(offset + NativeEventRecordLayout.timeOffset, true));
+                break;
+            case NativeEventType.buttonInDataTranslated:
+                handlers.buttonInDataTranslated(deviceId, value0, (flags & NativeEventRecordLayout.flag0) !== 0);
+                break;
+            case NativeEventType.batteryStatus:
+                handlers.batteryStatus(deviceId, value0, (flags & NativeEventRecordLayout.flag0) !== 0, (flags & NativeEventRecordLayout.flag1) !== 0);
+                break;
+            case NativeEventType.remoteMmi:
+                handlers.remoteMmi(deviceId, value0, view.getInt32(offset + NativeEventRecordLayout.value1Offset, true));
+                break;
+            case NativeEventType.firmwareProgress:
+                handlers.firmwareProgress(deviceId, value0, view.getInt32(offset + NativeEventRecordLayout.value1Offset, true),
+                                          view.getInt32(offset + NativeEventRecordLayout.value2Offset, true));
+                break;
+            case NativeEventType.uploadProgress:
+                handlers.uploadProgress(deviceId, value0, view.getInt32(offset + NativeEventRecordLayout.value1Offset, true));
+                break;
+            default:
+                _JabraNativeAddonLog(AddonLogSeverity.error, "_createNativeEventDispatcher", "Unknown native event record type " + type);
+        }
+    };
+
+    return (events, records, recordCount) => {
+        if (records) {
+            if (!recordView || recordView.buffer !== records) {
+                recordView = new DataView(records);
+            }
+            for (let i = 0; i < recordCount!; ++i) {
+                try {
+                    dispatchRecord(recordView, i * NativeEventRecordLayout.size, events);
+                } catch (err) {
+                    // Log but do not propagate js errors into native caller, so remaining events are still delivered:
+                    _JabraNativeAddonLog(AddonLogSeverity.error, "_createNativeEventDispatcher", err);
+                }
+            }
+            return;
+        }
+
+        for (let i = 0; i < events!.length; ++i) {
+            try {
+                dispatch(events![i]);
+            } catch (err) {
+                // Log but do not propagate js errors into native caller, so remaining events are still delivered:
+                _JabraNativeAddonLog(AddonLogSeverity.error, "_createNativeEventDispatcher", err);
+            }
+        }
+    };
+}
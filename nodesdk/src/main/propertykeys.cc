@@ -0,0 +1,62 @@
+#include "propertykeys.h"
+
+static const char * const PROPERTY_KEY_NAMES[] = {
+#define PROPERTY_KEY_NAME(name) #name,
+  PROPERTY_KEYS(PROPERTY_KEY_NAME)
+#undef PROPERTY_KEY_NAME
+};
+
+// Writable, enumerable and configurable like properties set from javascript (napi_default is none of these).
+static const napi_property_attributes JS_PROPERTY = static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable);
+
+Napi::ObjectReference * PropertyKeys::shared = nullptr;
+
+void PropertyKeys::init(Napi::Env env) {
+  if (shared == nullptr) {
+    // Strings used as property names are internalized by V8, so take the keys back from an object having them all
+    // (none of the names are array indexes, so the order is kept).
+    Napi::Object keyHolder = Napi::Object::New(env);
+    for (size_t i = 0; i < PROPERTY_KEY_COUNT; ++i) {
+      keyHolder.Set(PROPERTY_KEY_NAMES[i], Napi::Boolean::New(env, true));
+    }
+    shared = new Napi::ObjectReference(Napi::Persistent(static_cast<Napi::Object>(keyHolder.GetPropertyNames())));
+  }
+}
+
+PropertyKeys::PropertyKeys(Napi::Env _env) : env(_env), keyArray(), keys() {
+  if (shared == nullptr) {
+    throw std::logic_error("PropertyKeys used before init");
+  }
+  keyArray = shared->Value();
+}
+
+napi_value PropertyKeys::operator[](PropertyKey key) const {
+  const size_t index = static_cast<size_t>(key);
+  if (keys[index] == nullptr) {
+    keys[index] = keyArray.Get((uint32_t)index);
+  }
+  return keys[index];
+}
+
+ObjectBuilder::ObjectBuilder(const PropertyKeys& _keys) : keys(_keys), properties() {
+}
+
+ObjectBuilder& ObjectBuilder::set(PropertyKey key, napi_value value) {
+  napi_property_descriptor property = { nullptr, keys[key], nullptr, nullptr, nullptr, value, JS_PROPERTY, nullptr };
+  properties.push_back(property);
+  return *this;
+}
+
+Napi::Object ObjectBuilder::build() {
+  const Napi::Env env = keys.Env();
+  napi_value result;
+  napi_status status = napi_create_object(env, &result);
+  if (status == napi_ok) {
+    status = napi_define_properties(env, result, properties.size(), properties.data());
+  }
+  properties.clear();
+  if (status != napi_ok) {
+    throw Napi::Error::New(env);
+  }
+  return Napi::Object(env, result);
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "stdafx.h"
+
+#include <vector>
+
+/**
+ * Names of all properties of objects built with ObjectBuilder.
+ */
+#define PROPERTY_KEYS(X) \
+  /* DeviceSettings: */ \
+  X(errStatus) X(settingInfo) X(guid) X(name) X(helpText) X(isValidationSupport) X(validationRule) X(minLength) \
+  X(maxLength) X(errorMessage) X(regExp) X(isDeviceRestart) X(isSettingProtected) X(isSettingProtectionEnabled) \
+  X(isWirelessConnect) X(cntrlType) X(settingDataType) X(currValue) X(groupName) X(groupHelpText) X(isDepedentsetting) \
+  X(isPCsetting) X(isChildDeviceSetting) X(dependentDefaultValue) X(listSize) X(listKeyValue) X(key) X(value) \
+  X(dependentcount) X(dependents) X(GUID) X(enableFlag) \
+  /* DeviceInfo: */ \
+  X(deviceID) X(productID) X(vendorID) X(deviceName) X(usbDevicePath) X(parentInstanceId) X(errorStatus) \
+  X(isDongleDevice) X(dongleName) X(variant) X(ESN) X(isInFirmwareUpdateMode) X(connectionType) X(connectionId) \
+  X(parentDeviceId) \
+  /* Named assets and button events: */ \
+  X(elements) X(metadata) X(url) X(mime) X(buttonTypeKey) X(buttonTypeValue) X(buttonEventType) \
+  /* DectInfo: */ \
+  X(rawData) X(kind) X(sumMeasuredRSSI) X(maximumReferenceRSSI) X(numberMeasuredSlots) X(dataAgeSeconds) X(syncErrors) \
+  X(aErrors) X(xErrors) X(zErrors) X(hubSyncErrors) X(hubAErrors) X(handoversCount)
+
+enum class PropertyKey {
+#define PROPERTY_KEY_ENUM(name) name,
+  PROPERTY_KEYS(PROPERTY_KEY_ENUM)
+#undef PROPERTY_KEY_ENUM
+};
+
+#define PROPERTY_KEY_PLUS_ONE(name) + 1
+const size_t PROPERTY_KEY_COUNT = 0 PROPERTY_KEYS(PROPERTY_KEY_PLUS_ONE);
+#undef PROPERTY_KEY_PLUS_ONE
+
+/**
+ * Property key strings shared by all native-to-javascript conversions.
+ *
+ * The keys are created (and interned by V8) once when the module is loaded, instead of creating a new string for every
+ * property of every converted object. A PropertyKeys instance resolves keys for use in the current handle scope - each
+ * key only once, on first use - so create one per conversion, not per object.
+ */
+class PropertyKeys {
+  public:
+    /**
+     * Create the shared keys. Must be called from module Init.
+     */
+    static void init(Napi::Env env);
+
+    explicit PropertyKeys(Napi::Env env);
+
+    Napi::Env Env() const {
+      return env;
+    }
+
+    napi_value operator[](PropertyKey key) const;
+
+  private:
+    // Array of the keys indexed by PropertyKey (never freed).
+    static Napi::ObjectReference * shared;
+
+    Napi::Env env;
+    Napi::Object keyArray;
+    mutable napi_value keys[PROPERTY_KEY_COUNT];
+};
+
+/**
+ * Builds plain javascript objects, defining all properties of an object with a single napi_define_properties call
+ * rather than a Set call per property. Reuse a builder for many objects of the same kind (after build() it starts
+ * over), but use separate builders for nested objects.
+ */
+class ObjectBuilder {
+  public:
+    explicit ObjectBuilder(const PropertyKeys& keys);
+
+    ObjectBuilder& set(PropertyKey key, napi_value value);
+
+    /**
+     * Create an object with the properties set since the last build.
+     */
+    Napi::Object build();
+
+  private:
+    const PropertyKeys& keys;
+    std::vector<napi_property_descriptor> properties;
+};
@@ -0,0 +1,618 @@
+#include "sdkexecutor.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "logger.h"
+
+namespace util {
+
+static inline uint64_t elapsedMs(const std::chrono::steady_clock::time_point& since, const std::chrono::steady_clock::time_point& now) {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(now - since).count();
+}
+
+const char * toString(SdkPriority priority) {
+    switch (priority) {
+        case SdkPriority::CALL_CONTROL: return "callControl";
+        case SdkPriority::NORMAL: return "normal";
+        case SdkPriority::BULK: return "bulk";
+        default: return "???";
+    }
+}
+
+const char * toString(SdkAbandonReason reason) {
+    switch (reason) {
+        case SdkAbandonReason::TIMEOUT: return "timeout";
+        case SdkAbandonReason::CANCELLED: return "cancelled";
+        default: return "???";
+    }
+}
+
+SdkExecutor& SdkExecutor::instance() {
+    // Intentionally leaked - see class comment.
+    static SdkExecutor * executor = new SdkExecutor();
+    return *executor;
+}
+
+SdkExecutor::SdkExecutor()
+    : queueWait(), generalThreadCount(0), callControlThreadCount(0), stuckCallsReported(0), coalescedCount(0), skippedCount(0), started(false), completionHandle(), outstanding(0), submittedCount(0), completedCount(0),
+      requestedThreadCount(DEFAULT_THREAD_COUNT), deadlineTimer(), deadlines(), cancellable(), timedOutCount(0), cancelledCount(0),
+      watchdogThresholdMs(DEFAULT_WATCHDOG_THRESHOLD_MS), defaultTimeoutMs(NO_TIMEOUT) {
+}
+
+void SdkExecutor::configure(unsigned int threadCount, unsigned int _watchdogThresholdMs) {
+    if (_watchdogThresholdMs > 0) {
+        watchdogThresholdMs = _watchdogThresholdMs;
+    }
+
+    if (threadCount > 0) {
+        if (!started) {
+            requestedThreadCount = threadCount;
+        } else {
+            const unsigned int currentThreadCount = generalThreadCount;
+
+            if (threadCount > currentThreadCount) {
+                addThreads(threadCount - currentThreadCount, false);
+            } else if (threadCount < currentThreadCount) {
+                LOG_WARNING_(LOGINSTANCE) << "SdkExecutor: Ignoring request to reduce thread count from " << currentThreadCount << " to " << threadCount << " as threads are already running.";
+            }
+        }
+    }
+
+    LOG_INFO_(LOGINSTANCE) << "SdkExecutor: Configured with thread count " << (started ? generalThreadCount : requestedThreadCount) << " and watchdog threshold " << watchdogThresholdMs << " ms.";
+}
+
+void SdkExecutor::setDefaultTimeout(unsigned int timeoutMs) {
+    defaultTimeoutMs = timeoutMs;
+    LOG_INFO_(LOGINSTANCE) << "SdkExecutor: Default timeout set to " << timeoutMs << " ms (0 = none).";
+}
+
+unsigned int SdkExecutor::getDefaultTimeout() const {
+    return defaultTimeoutMs;
+}
+
+void SdkExecutor::ensureStarted(napi_env env) {
+    if (started) {
+        return;
+    }
+
+    uv_loop_t * loop = nullptr;
+    if (napi_get_uv_event_loop(env, &loop) != napi_ok || loop == nullptr) {
+        throw std::runtime_error("SdkExecutor could not get node event loop");
+    }
+
+    uv_async_init(loop, &completionHandle, &SdkExecutor::onCompletion);
+    completionHandle.data = this;
+    // Only keep node alive while we have outstanding work:
+    uv_unref(reinterpret_cast<uv_handle_t *>(&completionHandle));
+
+    uv_timer_init(loop, &deadlineTimer);
+    deadlineTimer.data = this;
+    // Outstanding work already keeps node alive through the completion handle:
+    uv_unref(reinterpret_cast<uv_handle_t *>(&deadlineTimer));
+
+    started = true;
+
+    addThreads(requestedThreadCount, false);
+    addThreads(CALL_CONTROL_THREAD_COUNT, true);
+
+    std::thread watchdogThread([this]() { watchdogLoop(); });
+    watchdogThread.detach();
+
+    LOG_INFO_(LOGINSTANCE) << "SdkExecutor: Started with " << requestedThreadCount << " threads (+" << CALL_CONTROL_THREAD_COUNT << " call-control thread) and watchdog threshold " << watchdogThresholdMs << " ms.";
+}
+
+void SdkExecutor::addThreads(unsigned int threadCount, bool callControlOnly) {
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        size_t slotIndex;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            slots.push_back(WorkerSlot{ nullptr, std::chrono::steady_clock::time_point(), false, false });
+            slotIndex = slots.size() - 1;
+        }
+
+        std::thread workerThread([this, slotIndex, callControlOnly]() { workerLoop(slotIndex, callControlOnly); });
+        workerThread.detach();
+
+        if (callControlOnly) {
+            ++callControlThreadCount;
+        } else {
+            ++generalThreadCount;
+        }
+    }
+}
+
+bool SdkExecutor::hasPending(bool callControlOnly) const {
+    // Nb. Called with mutex held.
+    const size_t priorities = callControlOnly ? 1 : SDK_PRIORITY_COUNT;
+    for (size_t i = 0; i < priorities; ++i) {
+        if (!pending[i].empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+SdkExecutor::QueuedTask SdkExecutor::popPending(bool callControlOnly) {
+    // Nb. Called with mutex held and hasPending(callControlOnly) true.
+    const size_t priorities = callControlOnly ? 1 : SDK_PRIORITY_COUNT;
+    for (size_t i = 0; i < priorities; ++i) {
+        if (!pending[i].empty()) {
+            QueuedTask queuedTask = pending[i].front();
+            pending[i].pop_front();
+
+            const uint64_t waitUs = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - queuedTask.enqueued).count();
+            SdkQueueWaitStats& waitStats = queueWait[i];
+            ++waitStats.count;
+            waitStats.totalUs += waitUs;
+            waitStats.maxUs = std::max(waitStats.maxUs, waitUs);
+
+            return queuedTask;
+        }
+    }
+    throw std::logic_error("SdkExecutor: No pending task");
+}
+
+void SdkExecutor::pushPending(const QueuedTask& queuedTask) {
+    // Nb. Called with mutex held.
+    pending[(size_t)queuedTask.task->priority()].push_back(queuedTask);
+}
+
+void SdkExecutor::notifyWorkers(SdkPriority priority) {
+    // Nb. Called without mutex held.
+    if (priority == SdkPriority::CALL_CONTROL) {
+        callControlWorkAvailable.notify_one();
+    }
+    workAvailable.notify_one();
+}
+
+void SdkExecutor::start(napi_env env) {
+    ensureStarted(env);
+}
+
+void SdkExecutor::submit(napi_env env, SdkTask * task) {
+    ensureStarted(env);
+
+    if (outstanding++ == 0) {
+        uv_ref(reinterpret_cast<uv_handle_t *>(&completionHandle));
+    }
+    ++submittedCount;
+
+    if (task->deadline() != std::chrono::steady_clock::time_point::max()) {
+        const bool earliest = deadlines.insert({ task->deadline(), task }).first == deadlines.begin();
+        if (earliest) {
+            scheduleDeadlineTimer();
+        }
+    }
+    if (task->cancellationId() != SdkTask::NO_CANCELLATION) {
+        cancellable[task->cancellationId()].push_back(task);
+    }
+
+    if (enqueue(QueuedTask{ task, std::chrono::steady_clock::now() })) {
+        notifyWorkers(task->priority());
+    }
+}
+
+void SdkExecutor::post(SdkTask * task) {
+    // Nb. Not counted as outstanding (main thread only), so drainCompleted skips the accounting for it.
+    task->posted = true;
+
+    if (enqueue(QueuedTask{ task, std::chrono::steady_clock::now() })) {
+        notifyWorkers(task->priority());
+    }
+}
+
+bool SdkExecutor::enqueue(const QueuedTask& queuedTask) {
+    // Nb. Called without mutex held. Returns true if the task is pending (so a worker should be notified).
+    SdkTask * const task = queuedTask.task;
+    const std::string& coalesceKey = task->coalesceKey();
+    const int strandKey = task->strand();
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!coalesceKey.empty()) {
+        auto leader = joinable.find(coalesceKey);
+        if (leader != joinable.end()) {
+            followers[leader->second].push_back(task);
+            ++coalescedCount;
+            return false;
+        }
+    }
+
+    if (strandKey != SdkTask::NO_STRAND) {
+        Strand& strand = strands[strandKey];
+
+        if (coalesceKey.empty()) {
+            // Potential write - later reads must not share results of reads submitted before it.
+            for (const auto& key : strand.joinableKeys) {
+                joinable.erase(key);
+            }
+            strand.joinableKeys.clear();
+        } else {
+            strand.joinableKeys.push_back(coalesceKey);
+        }
+    }
+
+    if (!coalesceKey.empty()) {
+        joinable[coalesceKey] = task;
+        followers[task]; // Leader may complete without followers.
+    }
+
+    if (strandKey != SdkTask::NO_STRAND) {
+        Strand& strand = strands[strandKey];
+        if (strand.active) {
+            // Ahead of the trailing waiting tasks it may overtake, so never ahead of a task of same or higher
+            // priority or of an earlier NORMAL write.
+            auto insertBefore = strand.waiting.end();
+            while (insertBefore != strand.waiting.begin() && mayOvertake(*task, *std::prev(insertBefore)->task)) {
+                --insertBefore;
+            }
+            strand.waiting.insert(insertBefore, queuedTask);
+            return false;
+        }
+        strand.active = true;
+    }
+
+    pushPending(queuedTask);
+    return true;
+}
+
+void SdkExecutor::stopJoining(SdkTask * task) {
+    // Nb. Called with mutex held. Later identical reads then start their own call.
+    const std::string& coalesceKey = task->coalesceKey();
+    if (coalesceKey.empty()) {
+        return;
+    }
+
+    auto leader = joinable.find(coalesceKey);
+    if (leader == joinable.end() || leader->second != task) {
+        return; // Not joinable since a write was submitted after it (the key may be of a newer leader by now).
+    }
+    joinable.erase(leader);
+
+    auto strandIt = strands.find(task->strand());
+    if (strandIt != strands.end()) {
+        auto& joinableKeys = strandIt->second.joinableKeys;
+        auto key = std::find(joinableKeys.begin(), joinableKeys.end(), coalesceKey);
+        if (key != joinableKeys.end()) {
+            joinableKeys.erase(key);
+        }
+    }
+}
+
+std::vector<SdkTask *> SdkExecutor::finishTask(SdkTask * task, bool& notifyWorker, SdkPriority& notifyPriority) {
+    // Nb. Called with mutex held.
+    std::vector<SdkTask *> taskFollowers;
+    notifyWorker = false;
+
+    const std::string& coalesceKey = task->coalesceKey();
+    const int strandKey = task->strand();
+
+    stopJoining(task);
+    if (!coalesceKey.empty()) {
+        auto taskFollowersIt = followers.find(task);
+        if (taskFollowersIt != followers.end()) {
+            taskFollowers.swap(taskFollowersIt->second);
+            followers.erase(taskFollowersIt);
+        }
+    }
+
+    if (strandKey != SdkTask::NO_STRAND) {
+        auto strandIt = strands.find(strandKey);
+        if (strandIt != strands.end()) {
+            Strand& strand = strandIt->second;
+
+            if (!strand.waiting.empty()) {
+                const QueuedTask next = strand.waiting.front();
+                strand.waiting.pop_front();
+                pushPending(next);
+                notifyWorker = true;
+                notifyPriority = next.task->priority();
+            } else {
+                strands.erase(strandIt);
+            }
+        }
+    }
+
+    return taskFollowers;
+}
+
+bool SdkExecutor::mayOvertake(const SdkTask& task, const SdkTask& waiting) {
+    // Read-only tasks and slow bulk/admin operations, which do not depend on call-control state.
+    return waiting.priority() > task.priority() && (!waiting.coalesceKey().empty() || waiting.priority() == SdkPriority::BULK);
+}
+
+bool SdkExecutor::isWanted(SdkTask * task, const std::chrono::steady_clock::time_point& now) const {
+    // Nb. Called with mutex held.
+    if (!task->isAbandoned() && now < task->deadline()) {
+        return true;
+    }
+
+    // An unwanted leader must still run for coalesced followers that want the result.
+    auto taskFollowers = followers.find(task);
+    if (taskFollowers != followers.end()) {
+        for (SdkTask * follower : taskFollowers->second) {
+            if (!follower->isAbandoned() && now < follower->deadline()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void SdkExecutor::workerLoop(size_t slotIndex, bool callControlOnly) {
+    std::condition_variable& available = callControlOnly ? callControlWorkAvailable : workAvailable;
+
+    while (true) {
+        SdkTask * task;
+        bool skip;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            available.wait(lock, [this, callControlOnly]() { return hasPending(callControlOnly); });
+            task = popPending(callControlOnly).task;
+
+            const auto now = std::chrono::steady_clock::now();
+            skip = !isWanted(task, now);
+            if (skip) {
+                // Identical reads submitted from now on must not adopt the skip of this one (nor any followers
+                // joined so far - they are all unwanted too):
+                stopJoining(task);
+                ++skippedCount;
+            } else {
+                WorkerSlot& slot = slots[slotIndex];
+                slot.taskName = task->name();
+                slot.started = now;
+                slot.busy = true;
+                slot.reported = false;
+            }
+        }
+
+        try {
+            if (skip) {
+                const SdkAbandonReason reason = std::chrono::steady_clock::now() >= task->deadline() ? SdkAbandonReason::TIMEOUT : SdkAbandonReason::CANCELLED;
+                LOG_INFO_(LOGINSTANCE) << "SdkExecutor: Skipped " << task->name() << " (" << toString(reason) << ") before it was started.";
+                task->skip(reason);
+            } else {
+                task->run();
+            }
+        } catch (const std::exception &e) {
+            LOG_ERROR_(LOGINSTANCE) << "SdkExecutor: " << task->name() << " failed with unhandled exception " << e.what();
+        } catch (...) {
+            LOG_ERROR_(LOGINSTANCE) << "SdkExecutor: " << task->name() << " failed with unhandled exception";
+        }
+
+        bool wasReported = false;
+        uint64_t runningMs = 0;
+        bool notifyWorker;
+        SdkPriority notifyPriority = SdkPriority::NORMAL;
+        std::vector<SdkTask *> taskFollowers;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!skip) {
+                WorkerSlot& slot = slots[slotIndex];
+                wasReported = slot.reported;
+                runningMs = elapsedMs(slot.started, std::chrono::steady_clock::now());
+                slot.busy = false;
+                slot.taskName = nullptr;
+            }
+
+            taskFollowers = finishTask(task, notifyWorker, notifyPriority);
+        }
+
+        if (notifyWorker) {
+            notifyWorkers(notifyPriority);
+        }
+
+        if (wasReported) {
+            LOG_WARNING_(LOGINSTANCE) << "SdkExecutor: Previously reported stuck call " << task->name() << " finally completed after " << runningMs << " ms.";
+        }
+
+        for (SdkTask * follower : taskFollowers) {
+            follower->adoptResult(*task);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(completedMutex);
+            completed.push_back(task);
+            completed.insert(completed.end(), taskFollowers.begin(), taskFollowers.end());
+        }
+        uv_async_send(&completionHandle);
+    }
+}
+
+void SdkExecutor::watchdogLoop() {
+    while (true) {
+        const unsigned int thresholdMs = watchdogThresholdMs;
+        const unsigned int checkIntervalMs = std::min(1000u, std::max(50u, thresholdMs / 4));
+        std::this_thread::sleep_for(std::chrono::milliseconds(checkIntervalMs));
+
+        std::vector<std::pair<std::string, uint64_t>> newlyStuck;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            const auto now = std::chrono::steady_clock::now();
+            for (auto& slot : slots) {
+                if (slot.busy && !slot.reported) {
+                    const uint64_t runningMs = elapsedMs(slot.started, now);
+                    if (runningMs >= watchdogThresholdMs) {
+                        slot.reported = true;
+                        ++stuckCallsReported;
+                        newlyStuck.push_back({ slot.taskName, runningMs });
+                    }
+                }
+            }
+        }
+
+        for (const auto& stuck : newlyStuck) {
+            LOG_WARNING_(LOGINSTANCE) << "SdkExecutor watchdog: " << stuck.first << " has been running for " << stuck.second << " ms (threshold is " << watchdogThresholdMs << " ms).";
+        }
+    }
+}
+
+void SdkExecutor::onCompletion(uv_async_t * handle) {
+    static_cast<SdkExecutor *>(handle->data)->drainCompleted();
+}
+
+void SdkExecutor::drainCompleted() {
+    while (true) {
+        std::vector<SdkTask *> tasks;
+        {
+            std::lock_guard<std::mutex> lock(completedMutex);
+            if (completed.empty()) {
+                break;
+            }
+            tasks.swap(completed);
+        }
+
+        for (SdkTask * task : tasks) {
+            const bool posted = task->posted;
+            if (!posted) {
+                unregisterTask(task);
+            }
+
+            try {
+                task->complete();
+            } catch (const std::exception &e) {
+                LOG_ERROR_(LOGINSTANCE) << "SdkExecutor: " << task->name() << " completion failed with unhandled exception " << e.what();
+            } catch (...) {
+                LOG_ERROR_(LOGINSTANCE) << "SdkExecutor: " << task->name() << " completion failed with unhandled exception";
+            }
+
+            delete task;
+
+            if (!posted) {
+                ++completedCount;
+                if (--outstanding == 0) {
+                    uv_unref(reinterpret_cast<uv_handle_t *>(&completionHandle));
+                }
+            }
+        }
+    }
+}
+
+void SdkExecutor::cancel(int cancellationId) {
+    auto found = cancellable.find(cancellationId);
+    if (found == cancellable.end()) {
+        return;
+    }
+
+    // Copy as tasks stay registered until completed.
+    const std::vector<SdkTask *> tasks = found->second;
+    for (SdkTask * task : tasks) {
+        abandonTask(task, SdkAbandonReason::CANCELLED);
+    }
+}
+
+void SdkExecutor::abandonTask(SdkTask * task, SdkAbandonReason reason) {
+    // Nb. Called on main thread for outstanding (not yet completed) tasks only.
+    if (task->abandoned.exchange(true)) {
+        return;
+    }
+
+    if (reason == SdkAbandonReason::TIMEOUT) {
+        ++timedOutCount;
+    } else {
+        ++cancelledCount;
+    }
+    LOG_WARNING_(LOGINSTANCE) << "SdkExecutor: Abandoned " << task->name() << " (" << toString(reason) << ").";
+
+    try {
+        task->abandon(reason);
+    } catch (const std::exception &e) {
+        LOG_ERROR_(LOGINSTANCE) << "SdkExecutor: " << task->name() << " abandon failed with unhandled exception " << e.what();
+    } catch (...) {
+        LOG_ERROR_(LOGINSTANCE) << "SdkExecutor: " << task->name() << " abandon failed with unhandled exception";
+    }
+}
+
+void SdkExecutor::unregisterTask(SdkTask * task) {
+    // Nb. Called on main thread.
+    if (task->deadline() != std::chrono::steady_clock::time_point::max()) {
+        deadlines.erase({ task->deadline(), task });
+    }
+
+    if (task->cancellationId() != SdkTask::NO_CANCELLATION) {
+        auto found = cancellable.find(task->cancellationId());
+        if (found != cancellable.end()) {
+            std::vector<SdkTask *>& tasks = found->second;
+            tasks.erase(std::remove(tasks.begin(), tasks.end(), task), tasks.end());
+            if (tasks.empty()) {
+                cancellable.erase(found);
+            }
+        }
+    }
+}
+
+void SdkExecutor::scheduleDeadlineTimer() {
+    // Nb. Called on main thread with a started executor.
+    if (deadlines.empty()) {
+        uv_timer_stop(&deadlineTimer);
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    const auto earliest = deadlines.begin()->first;
+    // Round up, so the timer never fires before the deadline has passed.
+    const uint64_t delayMs = earliest <= now ? 0 : (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(earliest - now + std::chrono::milliseconds(1) - std::chrono::nanoseconds(1)).count();
+    uv_timer_start(&deadlineTimer, &SdkExecutor::onDeadlineTimer, delayMs, 0);
+}
+
+void SdkExecutor::onDeadlineTimer(uv_timer_t * handle) {
+    static_cast<SdkExecutor *>(handle->data)->expireDeadlines();
+}
+
+void SdkExecutor::expireDeadlines() {
+    const auto now = std::chrono::steady_clock::now();
+
+    std::vector<SdkTask *> expired;
+    for (auto it = deadlines.begin(); it != deadlines.end() && it->first <= now; ++it) {
+        expired.push_back(it->second);
+    }
+
+    // Only dropped from deadlines - expired tasks stay cancellable until completed (abandoned at most once anyway).
+    for (SdkTask * task : expired) {
+        deadlines.erase({ task->deadline(), task });
+        abandonTask(task, SdkAbandonReason::TIMEOUT);
+    }
+
+    scheduleDeadlineTimer();
+}
+
+SdkExecutorStats SdkExecutor::getStats() {
+    SdkExecutorStats stats;
+    stats.watchdogThresholdMs = watchdogThresholdMs;
+    stats.submitted = submittedCount;
+    stats.completed = completedCount;
+    stats.timedOut = timedOutCount;
+    stats.cancelled = cancelledCount;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    stats.threadCount = started ? generalThreadCount : requestedThreadCount;
+    stats.callControlThreadCount = started ? callControlThreadCount : CALL_CONTROL_THREAD_COUNT;
+    stats.queued = 0;
+    for (size_t i = 0; i < SDK_PRIORITY_COUNT; ++i) {
+        stats.queued += pending[i].size();
+        stats.queueWait[i] = queueWait[i];
+    }
+    for (const auto& strand : strands) {
+        stats.queued += strand.second.waiting.size();
+    }
+    stats.running = 0;
+    stats.stuckCallsReported = stuckCallsReported;
+    stats.coalesced = coalescedCount;
+    stats.skipped = skippedCount;
+    stats.activeStrands = strands.size();
+
+    const auto now = std::chrono::steady_clock::now();
+    for (const auto& slot : slots) {
+        if (slot.busy) {
+            ++stats.running;
+            if (slot.reported) {
+                stats.stuckCalls.push_back({ slot.taskName, elapsedMs(slot.started, now) });
+            }
+        }
+    }
+
+    return stats;
+}
+
+} // namespace util
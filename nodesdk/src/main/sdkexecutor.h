@@ -0,0 +1,366 @@
+#pragma once
+
+// Needs to go first because of winsock issues
+#include <uv.h>
+#include <node_api.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace util {
+
+/**
+ * Scheduling priority classes for SdkTask's. Queued tasks of a higher priority class (lower value) are
+ * always started before queued tasks of lower priority classes.
+ */
+enum class SdkPriority {
+    /** User-visible call-control commands (ringer, hook, mute, hold etc.). */
+    CALL_CONTROL = 0,
+    /** Default for all other calls. */
+    NORMAL = 1,
+    /** Slow bulk/admin operations like settings and file transfers. */
+    BULK = 2
+};
+
+const size_t SDK_PRIORITY_COUNT = 3;
+
+/**
+ * Get display name of priority class (for logging and metrics).
+ */
+const char * toString(SdkPriority priority);
+
+/**
+ * Why an SdkTask was abandoned before it completed.
+ */
+enum class SdkAbandonReason {
+    /** The deadline of the task passed. */
+    TIMEOUT,
+    /** The task was cancelled from javascript (see SdkExecutor::cancel). */
+    CANCELLED
+};
+
+/**
+ * Get display name of abandon reason (for logging).
+ */
+const char * toString(SdkAbandonReason reason);
+
+/**
+ * A unit of work that can be run by the SdkExecutor.
+ *
+ * run() is executed on one of the executor threads and must NOT use any javascript / napi
+ * code or types. complete() is executed afterwards on the node main thread where it is
+ * safe to use javascript / napi again.
+ *
+ * The executor takes ownership of submitted tasks and deletes them once complete() has returned.
+ *
+ * A task with a deadline or a cancellation id may be abandoned before it completes. An abandoned task that has
+ * not been started is never run (skip() is called instead), while an abandoned task that is already running is
+ * left to finish in the background. Either way, complete() is still called afterwards so resources are released.
+ */
+class SdkTask {
+  public:
+    SdkTask() : abandoned(false), posted(false) {}
+    virtual ~SdkTask() {}
+
+    /**
+     * Thread-invariant name of the task used for logging and watchdog reports (should generally
+     * be the __func__ of the napi function that created the task).
+     */
+    virtual const char * name() const = 0;
+
+    /**
+     * Executed on an executor thread.
+     */
+    virtual void run() = 0;
+
+    /**
+     * Executed on the node main thread once run() has finished.
+     */
+    virtual void complete() = 0;
+
+    /**
+     * Key of the serial strand the task belongs to or NO_STRAND. Tasks on the same strand (generally
+     * the same device) are run one at a time in submission order, except that a waiting read-only or BULK
+     * task may be overtaken by a later task of a higher priority class (see SdkExecutor).
+     */
+    virtual int strand() const {
+        return NO_STRAND;
+    }
+
+    /**
+     * Non-empty for read-only tasks that may share the result of an identical task already in flight.
+     * Must uniquely identify the task type, function and arguments.
+     */
+    virtual const std::string& coalesceKey() const {
+        static const std::string none;
+        return none;
+    }
+
+    /**
+     * Called on an executor thread instead of run() when this task has been coalesced with an identical
+     * task (leader) that has just finished running. Leader is always of the same type as this task.
+     */
+    virtual void adoptResult(SdkTask& leader) {}
+
+    /**
+     * Scheduling priority class of the task.
+     */
+    virtual SdkPriority priority() const {
+        return SdkPriority::NORMAL;
+    }
+
+    /**
+     * Point in time after which the task is abandoned, or time_point::max() for no deadline. Must not change
+     * once the task has been submitted.
+     */
+    virtual std::chrono::steady_clock::time_point deadline() const {
+        return std::chrono::steady_clock::time_point::max();
+    }
+
+    /**
+     * Id of the javascript cancellation token of the task or NO_CANCELLATION (see SdkExecutor::cancel).
+     */
+    virtual int cancellationId() const {
+        return NO_CANCELLATION;
+    }
+
+    /**
+     * Executed on the node main thread when the task is abandoned before complete() - should settle
+     * the javascript side right away. complete() is still called later.
+     */
+    virtual void abandon(SdkAbandonReason reason) {}
+
+    /**
+     * Executed on an executor thread instead of run() when the task is no longer wanted once it is due
+     * to be started.
+     */
+    virtual void skip(SdkAbandonReason reason) {}
+
+    /**
+     * True once the task has been abandoned (may be read from any thread).
+     */
+    bool isAbandoned() const {
+        return abandoned;
+    }
+
+    static const int NO_STRAND = -1;
+    static const int NO_CANCELLATION = -1;
+
+  private:
+    friend class SdkExecutor;
+    std::atomic<bool> abandoned;
+    bool posted; // Queued with SdkExecutor::post rather than submit.
+};
+
+/**
+ * Time spent queued (from submission until started) for tasks of a priority class.
+ */
+struct SdkQueueWaitStats {
+    uint64_t count;
+    uint64_t totalUs;
+    uint64_t maxUs;
+};
+
+/**
+ * Snapshot of executor configuration and counters (for diagnostics only).
+ */
+struct SdkExecutorStats {
+    unsigned int threadCount;
+    unsigned int callControlThreadCount;
+    unsigned int watchdogThresholdMs;
+    size_t queued;
+    size_t running;
+    uint64_t submitted;
+    uint64_t completed;
+    uint64_t stuckCallsReported;
+    uint64_t coalesced;
+    size_t activeStrands;
+    uint64_t timedOut;
+    uint64_t cancelled;
+    uint64_t skipped;
+    SdkQueueWaitStats queueWait[SDK_PRIORITY_COUNT]; // Indexed by SdkPriority.
+
+    /** Name and running time (ms) of calls currently running for longer than the watchdog threshold. */
+    std::vector<std::pair<std::string, uint64_t>> stuckCalls;
+};
+
+/**
+ * Dedicated, separately sized thread pool for running (potentially slow and blocking) Jabra SDK calls.
+ *
+ * All JAsyncWorker's are executed here rather than on the shared libuv threadpool, so slow or hanging
+ * libjabra calls can never starve fs, dns, crypto etc. work in the host application. Results are passed
+ * back to the node main thread using a uv async handle that is only referenced while work is outstanding,
+ * so the executor never keeps the node process alive on its own.
+ *
+ * Tasks for the same strand (device) are run serially in submission order, and identical read-only tasks
+ * are coalesced, so only one of them reaches libjabra while the result is fanned out to all of them. A
+ * read-only task only joins an in-flight identical task if no other (writing) task has been submitted to the
+ * strand since, so reads never observe state from before an earlier write.
+ *
+ * Queued tasks are started in priority order. In addition to the general threads, a call-control thread only
+ * runs CALL_CONTROL tasks, so call-control commands never wait for a thread busy with slow bulk work. Inside a
+ * strand, a waiting task is placed ahead of waiting read-only and BULK tasks of lower priority classes, but never
+ * ahead of an earlier NORMAL or CALL_CONTROL write, so f.x. setBusyLight followed by mute reach the device in that
+ * order.
+ *
+ * A watchdog thread reports (logs and counts) calls that have been running for longer than a configurable
+ * threshold.
+ *
+ * Tasks may have a deadline (an explicit timeout or the configured default timeout) and a cancellation id. When
+ * a deadline passes, or a task is cancelled, the task is abandoned on the main thread, so javascript gets an
+ * error right away. A task abandoned while queued never reaches libjabra unless an identical coalesced task
+ * still wants its result. A running libjabra call can not be interrupted, so an abandoned running task keeps its
+ * thread until the call returns, after which its result is discarded and cleaned up as usual.
+ *
+ * Nb. The executor is a process-wide singleton that is deliberately never destroyed, as its threads may
+ * be blocked inside libjabra when the process exits.
+ */
+class SdkExecutor {
+  public:
+    static const unsigned int DEFAULT_THREAD_COUNT = 4;
+    static const unsigned int DEFAULT_WATCHDOG_THRESHOLD_MS = 10000;
+    static const unsigned int CALL_CONTROL_THREAD_COUNT = 1;
+    static const unsigned int NO_TIMEOUT = 0;
+
+    /**
+     * Get the singleton executor.
+     */
+    static SdkExecutor& instance();
+
+    /**
+     * Set number of threads and watchdog threshold. A zero value keeps the current setting.
+     *
+     * Threads are only ever added, so lowering the thread count once threads have been started
+     * has no effect. Must be called from the node main thread.
+     */
+    void configure(unsigned int threadCount, unsigned int watchdogThresholdMs);
+
+    /**
+     * Set timeout used for tasks without an explicit timeout (NO_TIMEOUT to disable, which is the default).
+     */
+    void setDefaultTimeout(unsigned int timeoutMs);
+
+    /**
+     * Get timeout used for tasks without an explicit timeout or NO_TIMEOUT.
+     */
+    unsigned int getDefaultTimeout() const;
+
+    /**
+     * Start the threads (done by the first submit). Must be called from the node main thread before post() is used.
+     */
+    void start(napi_env env);
+
+    /**
+     * Queue a task for execution (executor takes ownership). Must be called from the node main thread.
+     */
+    void submit(napi_env env, SdkTask * task);
+
+    /**
+     * Queue a task for execution from any thread, f.x. a libjabra callback thread (executor takes ownership). The
+     * task must not have a deadline or cancellation id, and does not keep the node process alive on its own. Must
+     * only be called once the executor has been started.
+     */
+    void post(SdkTask * task);
+
+    /**
+     * Abandon all outstanding tasks with the cancellation id. Must be called from the node main thread.
+     */
+    void cancel(int cancellationId);
+
+    /**
+     * Get a consistent snapshot of current executor state.
+     */
+    SdkExecutorStats getStats();
+
+  private:
+    struct WorkerSlot {
+        const char * taskName;
+        std::chrono::steady_clock::time_point started;
+        bool busy;
+        bool reported;
+    };
+
+    struct QueuedTask {
+        SdkTask * task;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+
+    struct Strand {
+        bool active;
+        std::deque<QueuedTask> waiting;
+        std::vector<std::string> joinableKeys;
+    };
+
+    SdkExecutor();
+    SdkExecutor(const SdkExecutor&) = delete;
+    SdkExecutor& operator=(const SdkExecutor&) = delete;
+
+    void ensureStarted(napi_env env);
+    bool enqueue(const QueuedTask& queuedTask);
+    void addThreads(unsigned int threadCount, bool callControlOnly);
+    void workerLoop(size_t slotIndex, bool callControlOnly);
+    bool hasPending(bool callControlOnly) const;
+    QueuedTask popPending(bool callControlOnly);
+    void pushPending(const QueuedTask& queuedTask);
+    void notifyWorkers(SdkPriority priority);
+    static bool mayOvertake(const SdkTask& task, const SdkTask& waiting);
+    void stopJoining(SdkTask * task);
+    std::vector<SdkTask *> finishTask(SdkTask * task, bool& notifyWorker, SdkPriority& notifyPriority);
+    void watchdogLoop();
+    void drainCompleted();
+    bool isWanted(SdkTask * task, const std::chrono::steady_clock::time_point& now) const;
+    void abandonTask(SdkTask * task, SdkAbandonReason reason);
+    void unregisterTask(SdkTask * task);
+    void scheduleDeadlineTimer();
+    void expireDeadlines();
+
+    static void onCompletion(uv_async_t * handle);
+    static void onDeadlineTimer(uv_timer_t * handle);
+
+    // Guards everything below until next comment.
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable callControlWorkAvailable;
+    std::deque<QueuedTask> pending[SDK_PRIORITY_COUNT]; // Indexed by SdkPriority.
+    SdkQueueWaitStats queueWait[SDK_PRIORITY_COUNT];
+    unsigned int generalThreadCount;
+    unsigned int callControlThreadCount;
+    std::deque<WorkerSlot> slots; // Deque so references stay valid when threads are added.
+    std::unordered_map<int, Strand> strands;
+    std::unordered_map<std::string, SdkTask *> joinable; // Coalesce key -> in-flight leader that may still be joined.
+    std::unordered_map<SdkTask *, std::vector<SdkTask *>> followers; // In-flight leader -> coalesced followers.
+    uint64_t stuckCallsReported;
+    uint64_t coalescedCount;
+    uint64_t skippedCount;
+
+    // Guards completed.
+    std::mutex completedMutex;
+    std::vector<SdkTask *> completed;
+
+    // Main thread only:
+    bool started;
+    uv_async_t completionHandle;
+    size_t outstanding;
+    uint64_t submittedCount;
+    uint64_t completedCount;
+    unsigned int requestedThreadCount;
+    uv_timer_t deadlineTimer;
+    std::set<std::pair<std::chrono::steady_clock::time_point, SdkTask *>> deadlines; // Outstanding tasks with a deadline.
+    std::unordered_map<int, std::vector<SdkTask *>> cancellable; // Cancellation id -> outstanding tasks.
+    uint64_t timedOutCount;
+    uint64_t cancelledCount;
+
+    std::atomic<unsigned int> watchdogThresholdMs;
+    std::atomic<unsigned int> defaultTimeoutMs;
+};
+
+} // namespace util
@@ -4,11 +4,12 @@
  * supplied for maximum type safety internally for this module.
  */
 
-import { ConfigParamsCloud, GenericConfigParams, enumHidState, AudioFileFormatEnum, DeviceSettings, DeviceInfo, PairedListInfo,
+import { ConfigParamsCloud, GenericConfigParams, NativeConfigParams, NativeCallOptions, NativeMetrics, BatchOperationDescriptor, BatchOperationResult, enumHidState, AudioFileFormatEnum, DeviceSettings, DeviceSettingsSchema, DeviceSettingValues, DeviceInfo, PairedListInfo,
          NamedAsset, AddonLogSeverity, JabraError, RemoteMmiActionOutput, DectInfo, WhiteboardPosition, ZoomLimits } from './core-types';
 import { enumDeviceBtnType, enumFirmwareEventType, enumFirmwareEventStatus,
          enumUploadEventStatus, enumBTPairedListType, enumRemoteMmiType,
          enumRemoteMmiInput, enumRemoteMmiPriority, enumRemoteMmiSequence } from './jabra-enums';
+import { NativeEventDispatcher, NativeEventType } from './nativeevents';
 
 /** 
  * Declares all natively implemented n-api functions that call into the Jabra C SDK.
@@ -16,10 +17,8 @@ import { enumDeviceBtnType, enumFirmwareEventType, enumFirmwareEventStatus,
  * These functions are considered a low-level implementation detail and should NOT
  * be exposed directly to the users of the wrapper.
  * 
- * The functions all use simple callbacks because the current n-api c++ interface do
- * not handle promises well. This means that the high-level parts of this wrapper
- * should convert the callbacks into promises when required (the standard node 
- * function util.promisify can be useful for this).
+ * Async functions return promises directly and take optional call options
+ * (timeout/cancellation) as last argument (see _withCallOptions).
  *  
  * @internal 
  **/
@@ -27,23 +26,13 @@ export declare interface SdkIntegration {
     isOnlineSupported(isOnlineSupported: any);
     /**
      * Initialize SDK + Jabra_SetAppID + pre-register all callback functions
-     * for all events.
+     * for all events. All events, including the result of the initialization,
+     * are delivered in batches to the event dispatcher (see
+     * NativeEventDispatcher for the arguments in binary event mode).
      */
     Initialize(appId: string,
-               success: (error: JabraError, result: void) => void,
-               firstScanDone: (event_time_ms: number) => void,
-               attached: (deviceId: DeviceInfo, event_time_ms: number) => void,
-               deAttached: (deviceId: number, event_time_ms: number) => void,
-               buttonInDataTranslated: (deviceId: number, translatedInData: enumDeviceBtnType, buttonInData: bool) => void,
-               devLogCallback: (deviceId: number, json: string) => void,
-               batteryStatusCallback: (deviceId: number, levelInPercent: number, isCharging: boolean, isBatteryLow: boolean) => void,
-               onRemoteMmiEvent: (deviceId: number, type: enumRemoteMmiType, input: enumRemoteMmiInput) => void,
-               downloadFirmwareProgressCallback: (deviceId: number, type: enumFirmwareEventType, status: enumFirmwareEventStatus, dwnFirmPercentage: number) => void,
-               uploadProgressCallback: (deviceId: number, status: enumUploadEventStatus, percentage: number) => void,
-               registerPairingListCallback: (deviceId: number, pairedListInfo: PairedListInfo) => void,
-               onGNPBtnEventCallback: (deviceId: number, btnEvents: Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }>) => void,
-               dectInfoCallback: (deviceId: number, dectInfo: DectInfo) => void,
-               configParams: ConfigParamsCloud & GenericConfigParams) : void;
+               eventDispatcher: NativeEventDispatcher,
+               configParams: ConfigParamsCloud & GenericConfigParams & NativeConfigParams) : void;
 
     /**
      * Uninitialize SDK and free resources. Must be called when 
@@ -52,6 +41,11 @@ export declare interface SdkIntegration {
      * Nb. This method is blocking!!
      */
     UnInitialize(): boolean;
+
+    /**
+     * Get the DeviceInfo of all devices currently attached (according to the Jabra SDK) in one call.
+     */
+    GetAttachedDevices(): DeviceInfo[];
     
     /***
      * Add a message to native log file (internal utility, not directly Jabra SDK related).
@@ -76,6 +70,48 @@ export declare interface SdkIntegration {
      */
     GetNativeAddonLogConfig() : NativeAddonLogConfig;
 
+    /**
+     * Get native diagnostics such as executor state and stuck call counters (internal utility, 
+     * not directly Jabra SDK related).
+     */
+    GetNativeMetrics() : NativeMetrics;
+
+    /**
+     * Set which device events javascript has listeners for (bit n set for NativeEventType n). Device events
+     * not in the mask are dropped natively. Devices have no interest until this is called.
+     */
+    SetDeviceEventInterest(deviceId: number, eventMask: number): void;
+
+    /**
+     * Get the recent events of a device with a sequence number above sinceSequenceNumber, in order.
+     * Each event is [sequenceNumber, time_ms] followed by the native event (type, device id and arguments).
+     */
+    GetDeviceEventHistory(deviceId: number, sinceSequenceNumber: number): { lastSequenceNumber: number, events: Array<[number, number, NativeEventType, ...any[]]> };
+
+    /**
+     * Get the cached GNP button catalogue of a device (the supported button events, extended with any
+     * pressed buttons missing from them). Revision changes whenever buttons are added.
+     */
+    GetButtonCatalogue(deviceId: number): { revision: number, buttons: Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }> };
+
+    ExecuteBatch(operations: BatchOperationDescriptor[], callOptions?: NativeCallOptions): Promise<BatchOperationResult[]>;
+
+    CancelCall(cancellationId: number): void;
+
+    /**
+     * Convert a synthetic DeviceSettings object with settingCount settings iterations times and
+     * return the last result - legacy selects the old conversion for comparison. Only available
+     * when built with "node-gyp rebuild --build_benchmarks=true".
+     */
+    BenchmarkSettingsConversion?(settingCount: number, iterations: number, legacy: boolean): DeviceSettings;
+
+    /**
+     * Convert the current values of a synthetic DeviceSettings object with settingCount settings
+     * iterations times and return the last result (see getSettingValuesAsync). Only available
+     * when built with "node-gyp rebuild --build_benchmarks=true".
+     */
+    BenchmarkSettingValuesConversion?(settingCount: number, iterations: number): DeviceSettingValues;
+
     /**
      * Template for calling experimental N-API code synchronously. For development use only for
      * experiments only. Otherwise not called.
@@ -85,150 +121,153 @@ export declare interface SdkIntegration {
     SyncExperiment(param: any): any;
     
     // -----------------------------------------------------------------------------------------------------------------------
-    // 1-1 non-blocking mappings of the non-device related SDK API using callbacks for results/completion.
+    // 1-1 non-blocking mappings of the non-device related SDK API.
     // ------------------------------------------------------------------------------------------------------------------------
 
-    ConnectToJabraApplication(guid: string, softphoneName: string, callback: (error: JabraError, result: boolean) => void): void;
-    DisconnectFromJabraApplication(callback: (error: JabraError, result: void) => void): void;
+    ConnectToJabraApplication(guid: string, softphoneName: string, callOptions?: NativeCallOptions): Promise<boolean>;
+    DisconnectFromJabraApplication(callOptions?: NativeCallOptions): Promise<void>;
 
-    SetSoftphoneReady(isReady: boolean, callback: (error: JabraError, result: void) => void): void;
-    IsSoftphoneInFocus(callback: (error: JabraError, result: boolean) => void): void;
+    SetSoftphoneReady(isReady: boolean, callOptions?: NativeCallOptions): Promise<void>;
+    IsSoftphoneInFocus(callOptions?: NativeCallOptions): Promise<boolean>;
 
-    GetErrorString(errStatusCode: number, callback: (error: JabraError, result: string) => void): void;
+    GetErrorString(errStatusCode: number, callOptions?: NativeCallOptions): Promise<string>;
 
     // ------------------------------------------------------------------------------------------------------------------------
-    // 1-1 non-blocking mappings of the device related SDK API using callbacks for results/completion.
+    // 1-1 non-blocking mappings of the device related SDK API.
     // ------------------------------------------------------------------------------------------------------------------------
 
-    GetLatestFirmwareInformation(deviceId: number, string: authorizationId, callback: (error: JabraError, result: FirmwareInfoType) => void): void;
-    GetFirmwareVersion(deviceId: number, callback: (error: JabraError, result: string) => void): void;
-    IsFirmwareLockEnabled(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    EnableFirmwareLock(deviceId: number, enable: boolean, callback: (error: JabraError, result: void) => void): void;
+    GetLatestFirmwareInformation(deviceId: number, authorizationId: string, callOptions?: NativeCallOptions): Promise<FirmwareInfoType>;
+    GetFirmwareVersion(deviceId: number, callOptions?: NativeCallOptions): Promise<string>;
+    IsFirmwareLockEnabled(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    EnableFirmwareLock(deviceId: number, enable: boolean, callOptions?: NativeCallOptions): Promise<void>;
 
-    IsDevLogEnabled(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    EnableDevLog(deviceId: number, enabled: boolean, callback: (error: JabraError, result: void) => void): void;
+    IsDevLogEnabled(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    EnableDevLog(deviceId: number, enabled: boolean, callOptions?: NativeCallOptions): Promise<void>;
 
-    GetDeviceImagePath(deviceId: number, callback: (error: JabraError, result: string) => void): void;
-    GetDeviceImageThumbnailPath(deviceId: number, callback: (error: JabraError, result: string) => void): void;
+    GetDeviceImagePath(deviceId: number, callOptions?: NativeCallOptions): Promise<string>;
+    GetDeviceImageThumbnailPath(deviceId: number, callOptions?: NativeCallOptions): Promise<string>;
 
-    IsGnHidStdHidSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    GetHidWorkingState(deviceId: number, callback: (error: JabraError, result: enumHidState) => void): void;
-    SetHidWorkingState(deviceId: number, state: enumHidState, callback: (error: JabraError, result: void) => void): void;
+    IsGnHidStdHidSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    GetHidWorkingState(deviceId: number, callOptions?: NativeCallOptions): Promise<enumHidState>;
+    SetHidWorkingState(deviceId: number, state: enumHidState, callOptions?: NativeCallOptions): Promise<void>;
 
-    GetSettings(deviceId: number, callback: (error: JabraError, result: DeviceSettings) => void): void;
-    GetSetting(deviceId: number, guid: string, callback: (error: JabraError, result: DeviceSettings) => void): void;
-    SetSettings(deviceId: number, settings: DeviceSettings, callback: (error: JabraError, result: void) => void): void;
+    GetSettings(deviceId: number, callOptions?: NativeCallOptions): Promise<DeviceSettings>;
+    GetSetting(deviceId: number, guid: string, callOptions?: NativeCallOptions): Promise<DeviceSettings>;
+    GetSettingsSchema(deviceId: number, callOptions?: NativeCallOptions): Promise<DeviceSettingsSchema>;
+    GetSettingValues(deviceId: number, callOptions?: NativeCallOptions): Promise<DeviceSettingValues>;
+    GetSettingValue(deviceId: number, guid: string, callOptions?: NativeCallOptions): Promise<DeviceSettingValues>;
+    SetSettings(deviceId: number, settings: DeviceSettings, callOptions?: NativeCallOptions): Promise<void>;
     
     
-    FactoryReset(deviceId: number, callback: (error: JabraError, result: void) => void): void;
-    IsFactoryResetSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
+    FactoryReset(deviceId: number, callOptions?: NativeCallOptions): Promise<void>;
+    IsFactoryResetSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
 
-    IsSettingProtectionEnabled(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
+    IsSettingProtectionEnabled(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
 
-    IsUploadRingtoneSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    IsUploadImageSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
+    IsUploadRingtoneSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    IsUploadImageSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
 
-    IsRingerSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    SetRinger(deviceId: number, enable: boolean, callback: (error: JabraError, result: void) => void): void;
+    IsRingerSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    SetRinger(deviceId: number, enable: boolean, callOptions?: NativeCallOptions): Promise<void>;
 
-    IsOffHookSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    SetOffHook(deviceId: number, enable: boolean, callback: (error: JabraError, result: void) => void): void;
+    IsOffHookSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    SetOffHook(deviceId: number, enable: boolean, callOptions?: NativeCallOptions): Promise<void>;
 
-    GetVersion(callback: (error: JabraError, result: string) => void) : void;
+    GetVersion(callOptions?: NativeCallOptions): Promise<string>;
 
-    GetBatteryStatus(deviceId: number, callback: (error: JabraError, result: BatteryStatusType) => void): void;
-    IsBatteryStatusSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
+    GetBatteryStatus(deviceId: number, callOptions?: NativeCallOptions): Promise<BatteryStatusType>;
+    IsBatteryStatusSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
     
-    UploadRingtone(deviceId: number, filename: string, callback: (error: JabraError, result: void) => void): void;
-    UploadWavRingtone(deviceId: number, filename: string, callback: (error: JabraError, result: void) => void): void;
+    UploadRingtone(deviceId: number, filename: string, callOptions?: NativeCallOptions): Promise<void>;
+    UploadWavRingtone(deviceId: number, filename: string, callOptions?: NativeCallOptions): Promise<void>;
 
-    UploadImage(deviceId: number, filename: string, callback: (error: JabraError, result: void) => void): void;
+    UploadImage(deviceId: number, filename: string, callOptions?: NativeCallOptions): Promise<void>;
 
-    GetNamedAsset(deviceId: number, filename: assetName, callback: (error: JabraError, result: NamedAsset) => void): void;
+    GetNamedAsset(deviceId: number, filename: assetName, callOptions?: NativeCallOptions): Promise<NamedAsset>;
 
-    GetPanics(deviceId: number, callback: (error: JabraError, result: string[]) => void): void;
+    GetPanics(deviceId: number, callOptions?: NativeCallOptions): Promise<string[]>;
 
-    DownloadFirmware(deviceId: number, version: string, authorization?: string, callback: (error: JabraError, result: void) => void): void;
-    UpdateFirmware(deviceId: number, firmFile: string, callback: (error: JabraError, result: void) => void): void;
-    DownloadFirmwareUpdater(deviceId: number, authorization?: string, callback: (error: JabraError, result: void) => void): void;
-    GetFirmwareFilePath(deviceId: number, version: string, callback: (error: JabraError, result: string) => void): void;
+    DownloadFirmware(deviceId: number, version: string, authorization?: string, callOptions?: NativeCallOptions): Promise<void>;
+    UpdateFirmware(deviceId: number, firmFile: string, callOptions?: NativeCallOptions): Promise<void>;
+    DownloadFirmwareUpdater(deviceId: number, authorization?: string, callOptions?: NativeCallOptions): Promise<void>;
+    GetFirmwareFilePath(deviceId: number, version: string, callOptions?: NativeCallOptions): Promise<string>;
 
-    SearchNewDevices(deviceId: number, callback: (error: JabraError, result: void) => void): void;
-    ConnectBTDevice(deviceId: number, callback: (error: JabraError, result: void) => void): void;
-    ConnectNewDevice(deviceId: number, deviceName: string, deviceBTAddr: string, isConnected: boolean, callback: (error: JabraError, result: void) => void): void;
-    ConnectPairedDevice(deviceId: number, deviceName: string, deviceBTAddr: string, isConnected: boolean, callback: (error: JabraError, result: void) => void): void;
-    GetConnectedBTDeviceName(deviceId: number, callback: (error: JabraError, result: string) => void): void;
-    GetSearchDeviceList(deviceId: number, callback: (error: JabraError, result: Array<{ deviceName: string, deviceBTAddr: string, isConnected: boolean }>) => void): void;
+    SearchNewDevices(deviceId: number, callOptions?: NativeCallOptions): Promise<void>;
+    ConnectBTDevice(deviceId: number, callOptions?: NativeCallOptions): Promise<void>;
+    ConnectNewDevice(deviceId: number, deviceName: string, deviceBTAddr: string, isConnected: boolean, callOptions?: NativeCallOptions): Promise<void>;
+    ConnectPairedDevice(deviceId: number, deviceName: string, deviceBTAddr: string, isConnected: boolean, callOptions?: NativeCallOptions): Promise<void>;
+    GetConnectedBTDeviceName(deviceId: number, callOptions?: NativeCallOptions): Promise<string>;
+    GetSearchDeviceList(deviceId: number, callOptions?: NativeCallOptions): Promise<Array<{ deviceName: string, deviceBTAddr: string, isConnected: boolean }>>;
     
-    DisconnectBTDevice(deviceId: number, callback: (error: JabraError, result: void) => void): void;
-    DisconnectPairedDevice(deviceId: number, deviceName: string, deviceBTAddr: string, isConnected: boolean, callback: (error: JabraError, result: void) => void): void;
+    DisconnectBTDevice(deviceId: number, callOptions?: NativeCallOptions): Promise<void>;
+    DisconnectPairedDevice(deviceId: number, deviceName: string, deviceBTAddr: string, isConnected: boolean, callOptions?: NativeCallOptions): Promise<void>;
  
-    GetAutoPairing(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    SetAutoPairing(deviceId: number, enable: boolean, callback: (error: JabraError, result: void) => void): void;
-    IsPairingListSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    GetPairingList(deviceId: number, callback: (error: JabraError, result: Array<{ deviceName: string, deviceBTAddr: string, isConnected: boolean }>) => void): void;
+    GetAutoPairing(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    SetAutoPairing(deviceId: number, enable: boolean, callOptions?: NativeCallOptions): Promise<void>;
+    IsPairingListSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    GetPairingList(deviceId: number, callOptions?: NativeCallOptions): Promise<Array<{ deviceName: string, deviceBTAddr: string, isConnected: boolean }>>;
 
-    ClearPairingList(deviceId: number, callback: (error: JabraError, result: void) => void): void;
-    ClearPairedDevice(deviceId: number, deviceName: string, deviceBTAddr: string, isConnected: boolean, callback: (error: JabraError, result: void) => void): void;
+    ClearPairingList(deviceId: number, callOptions?: NativeCallOptions): Promise<void>;
+    ClearPairedDevice(deviceId: number, deviceName: string, deviceBTAddr: string, isConnected: boolean, callOptions?: NativeCallOptions): Promise<void>;
     
-    StopBTPairing(deviceId: number, callback: (error: JabraError, result: void) => void): void;
-    SetBTPairing(deviceId: number, callback: (error: JabraError, result: void) => void): void;
+    StopBTPairing(deviceId: number, callOptions?: NativeCallOptions): Promise<void>;
+    SetBTPairing(deviceId: number, callOptions?: NativeCallOptions): Promise<void>;
        
-    GetSupportedButtonEvents(deviceId: number, callback: (error: JabraError, result: Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }>) => void): void;
+    GetSupportedButtonEvents(deviceId: number, callOptions?: NativeCallOptions): Promise<Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }>>;
     
-    IsMuteSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    SetMute(deviceId: number, enable: boolean, callback: (error: JabraError, result: void) => void): void;
-
-    IsHoldSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-
-    IsBusyLightSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    SetHold(deviceId: number, enable: boolean, callback: (error: JabraError, result: void) => void): void;
-    GetBusyLightStatus(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    SetBusyLightStatus(deviceId: number, enable: boolean, callback: (error: JabraError, result: void) => void): void;
-    SetOnline(deviceId: number, online: boolean, callback: (error: JabraError, result: void) => void): void;
-
-    IsSetDateTimeSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    IsFeatureSupported(deviceId: number, feature: number, callback: (error: JabraError, result: boolean) => void): void;
-    GetWizardMode(deviceId: number, callback: (error: JabraError, result: number) => void): void;   
-    GetSecureConnectionMode(deviceId: number, callback: (error: JabraError, result: number) => void): void;   
-    RebootDevice(deviceId: number, callback: (error: JabraError, result: void) => void): void;   
-    IsEqualizerSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    IsEqualizerEnabled(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    EnableEqualizer(deviceId: number, enable: boolean, callback: (error: JabraError, result: void) => void): void;
+    IsMuteSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    SetMute(deviceId: number, enable: boolean, callOptions?: NativeCallOptions): Promise<void>;
+
+    IsHoldSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+
+    IsBusyLightSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    SetHold(deviceId: number, enable: boolean, callOptions?: NativeCallOptions): Promise<void>;
+    GetBusyLightStatus(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    SetBusyLightStatus(deviceId: number, enable: boolean, callOptions?: NativeCallOptions): Promise<void>;
+    SetOnline(deviceId: number, online: boolean, callOptions?: NativeCallOptions): Promise<void>;
+
+    IsSetDateTimeSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    IsFeatureSupported(deviceId: number, feature: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    GetWizardMode(deviceId: number, callOptions?: NativeCallOptions): Promise<number>;   
+    GetSecureConnectionMode(deviceId: number, callOptions?: NativeCallOptions): Promise<number>;   
+    RebootDevice(deviceId: number, callOptions?: NativeCallOptions): Promise<void>;   
+    IsEqualizerSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    IsEqualizerEnabled(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    EnableEqualizer(deviceId: number, enable: boolean, callOptions?: NativeCallOptions): Promise<void>;
     
-    IsOnlineSupported(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
+    IsOnlineSupported(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
     
-    CancelFirmwareDownload( deviceId: number, callback: (error: JabraError, result: void) => void): void;
-    SetTimestamp( deviceId: number, timeStamp: number, callback: (error: JabraError, result: void) => void): void;
-    SetEqualizerParameters( deviceId: number, bands:Array<number>, callback: (error: JabraError, result: void) => void): void;
-    CheckForFirmwareUpdate( deviceId: number, authorization:string, callback: (error: JabraError, result: boolean) => void): void;
-    PlayRingTone( deviceId: number, level:number, type:number,callback: (error: JabraError, result:void) => void): void;
-    GetESN(deviceId: number, callback: (error: JabraError, result: string) => void): void;
-    GetFailedSettingNames(deviceId: number, callback: (error: JabraError, result: Array<string>) => void): void;
-    GetTimestamp(deviceId: number, callback: (error: JabraError, result: number) => void): void;
-    SetWizardMode(deviceId: number, wizardModes:number, callback: (error: JabraError, result: void) => void): void;
-    GetAudioFileParametersForUpload(deviceId: number, callback: (error: JabraError, result: { audioFileType: AudioFileFormatEnum, numChannels: number, bitsPerSample: number, sampleRate: number, maxFileSize: number }) => void): void;
-    SetDatetime(deviceId: number, dateTime: { sec: number, min: number, hour: number, mday: number, mon: number, year: number, wday: number }, callback: (error: JabraError, result: void) => void): void;
-    GetEqualizerParameters(deviceId: number, maxNBands:number, callback: (error: JabraError, result: Array<{ max_gain: number, centerFrequency: number, currentGain: number }>) => void): void;
-    GetSupportedFeatures(deviceId: number, callback: (error: JabraError, result: Array<enumDeviceFeature>) => void): void;
-
-    GetButtonFocus(deviceId: number, btnEvents: Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }>, callback: (error: JabraError, result: void) => void): void;
-    ReleaseButtonFocus(deviceId: number, btnEvents: Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }>, callback: (error: JabraError, result: void) => void): void;
-
-    GetRemoteMmiFocus(deviceId: number, type: enumRemoteMmiType, input: enumRemoteMmiInput, priority: enumRemoteMmiPriority, callback: (error: JabraError, result: void) => void): void;    
-    ReleaseRemoteMmiFocus(deviceId: number, type: enumRemoteMmiType, callback: (error: JabraError, result: void) => void): void;
-    IsRemoteMmiInFocus(deviceId: number, type: enumRemoteMmiType, callback: (error: JabraError, result: boolean) => void): void;
-    SetRemoteMmiAction(deviceId: number, type: enumRemoteMmiType, actionOuput: RemoteMmiActionOutput, callback: (error: JabraError, result: void) => void): void;
-
-    IsNewportRemoteManagementEnabled(deviceId: number, callback: (error: JabraError, result: boolean) => void): void;
-    EnableNewportRemoteManagement(deviceId: number, enable: boolean, callback: (error: JabraError, result: void) => void): void;
-    SetXpressUrl(deviceId: number, url: string, callback: (error: JabraError, result: void) => void): void;
-    GetXpressUrl(deviceId: number, callback: (error: JabraError, result: string) => void): void;
-
-    GetWhiteboardPosition(deviceId: number, whiteboardId: number, callback: (error: JabraError, result: WhiteboardPosition) => void): void;
-    SetWhiteboardPosition(deviceId: number, whiteboardId: number, whiteboardPosition: WhiteboardPosition, callback: (error: JabraError, result: void) => void): void;
-
-    GetZoom(deviceId: number, callback: (error: JabraError, result: number) => void): void;
-    SetZoom(deviceId: number, zoom: number, callback: (error: JabraError, result: void) => void): void;
-    GetZoomLimits(deviceId: number, callback: (error: JabraError, result: ZoomLimits) => void): void;
+    CancelFirmwareDownload( deviceId: number, callOptions?: NativeCallOptions): Promise<void>;
+    SetTimestamp( deviceId: number, timeStamp: number, callOptions?: NativeCallOptions): Promise<void>;
+    SetEqualizerParameters( deviceId: number, bands:Array<number>, callOptions?: NativeCallOptions): Promise<void>;
+    CheckForFirmwareUpdate( deviceId: number, authorization:string, callOptions?: NativeCallOptions): Promise<boolean>;
+    PlayRingTone( deviceId: number, level:number, type:number, callOptions?: NativeCallOptions): Promise<void>;
+    GetESN(deviceId: number, callOptions?: NativeCallOptions): Promise<string>;
+    GetFailedSettingNames(deviceId: number, callOptions?: NativeCallOptions): Promise<Array<string>>;
+    GetTimestamp(deviceId: number, callOptions?: NativeCallOptions): Promise<number>;
+    SetWizardMode(deviceId: number, wizardModes:number, callOptions?: NativeCallOptions): Promise<void>;
+    GetAudioFileParametersForUpload(deviceId: number, callOptions?: NativeCallOptions): Promise<{ audioFileType: AudioFileFormatEnum, numChannels: number, bitsPerSample: number, sampleRate: number, maxFileSize: number }>;
+    SetDatetime(deviceId: number, dateTime: { sec: number, min: number, hour: number, mday: number, mon: number, year: number, wday: number }, callOptions?: NativeCallOptions): Promise<void>;
+    GetEqualizerParameters(deviceId: number, maxNBands:number, callOptions?: NativeCallOptions): Promise<Array<{ max_gain: number, centerFrequency: number, currentGain: number }>>;
+    GetSupportedFeatures(deviceId: number, callOptions?: NativeCallOptions): Promise<Array<enumDeviceFeature>>;
+
+    GetButtonFocus(deviceId: number, btnEvents: Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }>, callOptions?: NativeCallOptions): Promise<void>;
+    ReleaseButtonFocus(deviceId: number, btnEvents: Array<{ buttonTypeKey: number, buttonTypeValue: string, buttonEventType: Array<{ key: number, value: string }> }>, callOptions?: NativeCallOptions): Promise<void>;
+
+    GetRemoteMmiFocus(deviceId: number, type: enumRemoteMmiType, input: enumRemoteMmiInput, priority: enumRemoteMmiPriority, callOptions?: NativeCallOptions): Promise<void>;    
+    ReleaseRemoteMmiFocus(deviceId: number, type: enumRemoteMmiType, callOptions?: NativeCallOptions): Promise<void>;
+    IsRemoteMmiInFocus(deviceId: number, type: enumRemoteMmiType, callOptions?: NativeCallOptions): Promise<boolean>;
+    SetRemoteMmiAction(deviceId: number, type: enumRemoteMmiType, actionOuput: RemoteMmiActionOutput, callOptions?: NativeCallOptions): Promise<void>;
+
+    IsNewportRemoteManagementEnabled(deviceId: number, callOptions?: NativeCallOptions): Promise<boolean>;
+    EnableNewportRemoteManagement(deviceId: number, enable: boolean, callOptions?: NativeCallOptions): Promise<void>;
+    SetXpressUrl(deviceId: number, url: string, callOptions?: NativeCallOptions): Promise<void>;
+    GetXpressUrl(deviceId: number, callOptions?: NativeCallOptions): Promise<string>;
+
+    GetWhiteboardPosition(deviceId: number, whiteboardId: number, callOptions?: NativeCallOptions): Promise<WhiteboardPosition>;
+    SetWhiteboardPosition(deviceId: number, whiteboardId: number, whiteboardPosition: WhiteboardPosition, callOptions?: NativeCallOptions): Promise<void>;
+
+    GetZoom(deviceId: number, callOptions?: NativeCallOptions): Promise<number>;
+    SetZoom(deviceId: number, zoom: number, callOptions?: NativeCallOptions): Promise<void>;
+    GetZoomLimits(deviceId: number, callOptions?: NativeCallOptions): Promise<ZoomLimits>;
 }
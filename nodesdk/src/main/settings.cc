@@ -1,4 +1,7 @@
 #include "settings.h"
+#include "capabilities.h"
+#include "metadatacache.h"
+#include "propertykeys.h"
 
 #include <string.h>
 #include <limits.h>
@@ -286,120 +289,204 @@ static DeviceSettings *toCType(const unsigned short deviceId, Napi::Object src)
   return result;
 }
 
+SettingSchema SettingSchema::fromDeviceSettings(const DeviceSettings& src) {
+  SettingSchema result;
+  result.settings.reserve(src.settingCount);
+  result.revision = 0;
+
+  for (unsigned int i=0; i<src.settingCount; ++i) {
+    const SettingInfo& settingSrc = src.settingInfo[i];
+    Setting setting;
+
+    setting.guid = settingSrc.guid ? settingSrc.guid : "";
+    setting.name = settingSrc.name ? settingSrc.name : "";
+    setting.helpText = settingSrc.helpText ? settingSrc.helpText : "";
+    setting.isValidationSupport = settingSrc.isValidationSupport;
+    setting.hasValidationRule = settingSrc.validationRule != nullptr;
+    setting.minLength = settingSrc.validationRule ? settingSrc.validationRule->minLength : 0;
+    setting.maxLength = settingSrc.validationRule ? settingSrc.validationRule->maxLength : 0;
+    setting.regExp = settingSrc.validationRule && settingSrc.validationRule->regExp ? settingSrc.validationRule->regExp : "";
+    setting.errorMessage = settingSrc.validationRule && settingSrc.validationRule->errorMessage ? settingSrc.validationRule->errorMessage : "";
+    setting.isDeviceRestart = settingSrc.isDeviceRestart;
+    setting.isSettingProtected = settingSrc.isSettingProtected;
+    setting.isWirelessConnect = settingSrc.isWirelessConnect;
+    setting.cntrlType = settingSrc.cntrlType;
+    setting.settingDataType = settingSrc.settingDataType;
+    setting.groupName = settingSrc.groupName ? settingSrc.groupName : "";
+    setting.groupHelpText = settingSrc.groupHelpText ? settingSrc.groupHelpText : "";
+    setting.isDepedentsetting = settingSrc.isDepedentsetting;
+    setting.hasDependentDefaultValue = false;
+    if (settingSrc.dependentDefaultValue) {
+      if (settingSrc.settingDataType == DataType::settingByte) {
+        setting.hasDependentDefaultValue = true;
+        setting.dependentDefaultValue = std::string(1, *((char *)settingSrc.dependentDefaultValue));
+      } else if (settingSrc.settingDataType == DataType::settingString) {
+        setting.hasDependentDefaultValue = true;
+        setting.dependentDefaultValue = (char *)settingSrc.dependentDefaultValue;
+      }
+    }
+    setting.isPCsetting = settingSrc.isPCsetting;
+    setting.isChildDeviceSetting = settingSrc.isChildDeviceSetting;
+
+    for (int j=0; j<settingSrc.listSize; ++j) {
+      const ListKeyValue& listKeyValueSrc = settingSrc.listKeyValue[j];
+      ListEntry entry;
+      entry.key = listKeyValueSrc.key;
+      entry.value = listKeyValueSrc.value ? (char *)listKeyValueSrc.value : "";
+      for (int k=0; k<listKeyValueSrc.dependentcount; ++k) {
+        const DependencySetting& dependencySettingSrc = listKeyValueSrc.dependents[k];
+        entry.dependents.emplace_back(dependencySettingSrc.GUID ? dependencySettingSrc.GUID : "", dependencySettingSrc.enableFlag);
+      }
+      setting.listKeyValue.push_back(std::move(entry));
+    }
+
+    result.settings.push_back(std::move(setting));
+  }
+
+  return result;
+}
+
+bool SettingSchema::matches(const DeviceSettings& src) const {
+  if (src.settingCount != settings.size()) {
+    return false;
+  }
+  for (unsigned int i=0; i<src.settingCount; ++i) {
+    if (settings[i].guid != (src.settingInfo[i].guid ? src.settingInfo[i].guid : "")) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int SettingSchema::indexOf(const char * guid, unsigned int hint) const {
+  if (!guid) {
+    return -1;
+  }
+  if (hint < settings.size() && settings[hint].guid == guid) {
+    return (int)hint;
+  }
+  for (size_t i=0; i<settings.size(); ++i) {
+    if (settings[i].guid == guid) {
+      return (int)i;
+    }
+  }
+  return -1;
+}
+
 /**
 * Copy a native sdk DeviceSettings object into an empty napi device settings object (the reverse of toCType).
 */
-static void toNodeType(const unsigned short deviceId, DeviceSettings *src, Napi::Object& dest) {
+void toNodeType(const unsigned short deviceId, DeviceSettings *src, Napi::Object& dest) {
   Napi::Env env = dest.Env();
+  const PropertyKeys keys(env);
+  ObjectBuilder settingDst(keys), validationRuleDst(keys), listKeyValueDst(keys), dependencySettingDst(keys);
   
   Napi::Array settings = Napi::Array::New(env, src->settingCount);
   for (unsigned int i=0; i<src->settingCount; ++i) {
     SettingInfo& settingSrc = src->settingInfo[i];
 
-    Napi::Object settingDst = Napi::Object::New(env);
-
-    settingDst.Set(Napi::String::New(env, "guid"), Napi::String::New(env, settingSrc.guid ? settingSrc.guid : ""));
-    settingDst.Set(Napi::String::New(env, "name"), Napi::String::New(env, settingSrc.name ? settingSrc.name : ""));
-    settingDst.Set(Napi::String::New(env, "helpText"), Napi::String::New(env, settingSrc.helpText ? settingSrc.helpText : ""));
-    settingDst.Set(Napi::String::New(env, "isValidationSupport"), Napi::Boolean::New(env, settingSrc.isValidationSupport));
+    settingDst.set(PropertyKey::guid, Napi::String::New(env, settingSrc.guid ? settingSrc.guid : ""));
+    settingDst.set(PropertyKey::name, Napi::String::New(env, settingSrc.name ? settingSrc.name : ""));
+    settingDst.set(PropertyKey::helpText, Napi::String::New(env, settingSrc.helpText ? settingSrc.helpText : ""));
+    settingDst.set(PropertyKey::isValidationSupport, Napi::Boolean::New(env, settingSrc.isValidationSupport));
 
     ValidationRule *validationRuleSrc = settingSrc.validationRule;
     if (validationRuleSrc) {
-       Napi::Object validationRuleDst = Napi::Object::New(env);
+       validationRuleDst.set(PropertyKey::minLength, Napi::Number::New(env, validationRuleSrc->minLength));
+       validationRuleDst.set(PropertyKey::maxLength, Napi::Number::New(env, validationRuleSrc->maxLength));
 
-       validationRuleDst.Set(Napi::String::New(env, "minLength"), Napi::Number::New(env, validationRuleSrc->minLength));
-       validationRuleDst.Set(Napi::String::New(env, "maxLength"), Napi::Number::New(env, validationRuleSrc->maxLength));
+       validationRuleDst.set(PropertyKey::errorMessage, Napi::String::New(env, validationRuleSrc->errorMessage ? validationRuleSrc->errorMessage : ""));
+       validationRuleDst.set(PropertyKey::regExp, Napi::String::New(env, validationRuleSrc->regExp ? validationRuleSrc->regExp : ""));
 
-       validationRuleDst.Set(Napi::String::New(env, "errorMessage"), Napi::String::New(env, validationRuleSrc->errorMessage ? validationRuleSrc->errorMessage : ""));
-       validationRuleDst.Set(Napi::String::New(env, "regExp"), Napi::String::New(env, validationRuleSrc->regExp ? validationRuleSrc->regExp : ""));
-
-       settingDst.Set(Napi::String::New(env, "validationRule"), validationRuleDst);
+       settingDst.set(PropertyKey::validationRule, validationRuleDst.build());
     }
 
-    settingDst.Set(Napi::String::New(env, "isDeviceRestart"), Napi::Boolean::New(env, settingSrc.isDeviceRestart));
-    settingDst.Set(Napi::String::New(env, "isSettingProtected"), Napi::Boolean::New(env, settingSrc.isSettingProtected));
-    settingDst.Set(Napi::String::New(env, "isSettingProtectionEnabled"), Napi::Boolean::New(env, settingSrc.isSettingProtectionEnabled));
-    settingDst.Set(Napi::String::New(env, "isWirelessConnect"), Napi::Boolean::New(env, settingSrc.isWirelessConnect));
-    settingDst.Set(Napi::String::New(env, "cntrlType"), Napi::Number::New(env, settingSrc.cntrlType));
-    settingDst.Set(Napi::String::New(env, "settingDataType"), Napi::Number::New(env, settingSrc.settingDataType));
+    settingDst.set(PropertyKey::isDeviceRestart, Napi::Boolean::New(env, settingSrc.isDeviceRestart));
+    settingDst.set(PropertyKey::isSettingProtected, Napi::Boolean::New(env, settingSrc.isSettingProtected));
+    settingDst.set(PropertyKey::isSettingProtectionEnabled, Napi::Boolean::New(env, settingSrc.isSettingProtectionEnabled));
+    settingDst.set(PropertyKey::isWirelessConnect, Napi::Boolean::New(env, settingSrc.isWirelessConnect));
+    settingDst.set(PropertyKey::cntrlType, Napi::Number::New(env, settingSrc.cntrlType));
+    settingDst.set(PropertyKey::settingDataType, Napi::Number::New(env, settingSrc.settingDataType));
 
     if (settingSrc.currValue) {
       if (settingSrc.settingDataType == DataType::settingByte) {
-        settingDst.Set(Napi::String::New(env, "currValue"), Napi::Number::New(env, *((uint8_t *)settingSrc.currValue)));
+        settingDst.set(PropertyKey::currValue, Napi::Number::New(env, *((uint8_t *)settingSrc.currValue)));
       } else if (settingSrc.settingDataType == DataType::settingString) {
-        settingDst.Set(Napi::String::New(env, "currValue"), Napi::String::New(env, (char *)settingSrc.currValue));
+        settingDst.set(PropertyKey::currValue, Napi::String::New(env, (char *)settingSrc.currValue));
       } else {
         LOG_ERROR_(LOGINSTANCE) << "Device " << deviceId << " has unexpected settingDataType " << settingSrc.currValue << " for settings GUID " << settingSrc.guid;
       }
     }
 
-    settingDst.Set(Napi::String::New(env, "groupName"), Napi::String::New(env, settingSrc.groupName ? settingSrc.groupName : ""));
-    settingDst.Set(Napi::String::New(env, "groupHelpText"), Napi::String::New(env, settingSrc.groupHelpText ? settingSrc.groupHelpText : ""));
-    settingDst.Set(Napi::String::New(env, "isDepedentsetting"), Napi::Boolean::New(env, settingSrc.isDepedentsetting));
+    settingDst.set(PropertyKey::groupName, Napi::String::New(env, settingSrc.groupName ? settingSrc.groupName : ""));
+    settingDst.set(PropertyKey::groupHelpText, Napi::String::New(env, settingSrc.groupHelpText ? settingSrc.groupHelpText : ""));
+    settingDst.set(PropertyKey::isDepedentsetting, Napi::Boolean::New(env, settingSrc.isDepedentsetting));
 
-    settingDst.Set(Napi::String::New(env, "isPCsetting"), Napi::Boolean::New(env, settingSrc.isPCsetting));
-    settingDst.Set(Napi::String::New(env, "isChildDeviceSetting"), Napi::Boolean::New(env, settingSrc.isChildDeviceSetting));
+    settingDst.set(PropertyKey::isPCsetting, Napi::Boolean::New(env, settingSrc.isPCsetting));
+    settingDst.set(PropertyKey::isChildDeviceSetting, Napi::Boolean::New(env, settingSrc.isChildDeviceSetting));
     
     if (settingSrc.dependentDefaultValue) {
       if (settingSrc.settingDataType == DataType::settingByte) {
-        settingDst.Set(Napi::String::New(env, "dependentDefaultValue"), Napi::Number::New(env, *((uint8_t *)settingSrc.dependentDefaultValue)));
+        settingDst.set(PropertyKey::dependentDefaultValue, Napi::Number::New(env, *((uint8_t *)settingSrc.dependentDefaultValue)));
       } else if (settingSrc.settingDataType == DataType::settingString) {
-        settingDst.Set(Napi::String::New(env, "dependentDefaultValue"), Napi::String::New(env, (char *)settingSrc.dependentDefaultValue));
+        settingDst.set(PropertyKey::dependentDefaultValue, Napi::String::New(env, (char *)settingSrc.dependentDefaultValue));
       } else {
         LOG_ERROR_(LOGINSTANCE) << "Device " << deviceId << " has unexpected settingDataType " << settingSrc.settingDataType << " for settings GUID " << settingSrc.guid;
       }
     }
 
     Napi::Array keyValueList = Napi::Array::New(env, settingSrc.listSize);
-    settingDst.Set(Napi::String::New(env, "listSize"), Napi::Number::New(env, settingSrc.listSize));
+    settingDst.set(PropertyKey::listSize, Napi::Number::New(env, settingSrc.listSize));
     for (int j=0; j< settingSrc.listSize; ++j) {
       ListKeyValue& listKeyValueSrc = settingSrc.listKeyValue[j];
 
-      Napi::Object listKeyValueDst = Napi::Object::New(env);
-      listKeyValueDst.Set(Napi::String::New(env, "key"), Napi::Number::New(env, listKeyValueSrc.key));
+      listKeyValueDst.set(PropertyKey::key, Napi::Number::New(env, listKeyValueSrc.key));
  
       if (listKeyValueSrc.value) {
-        listKeyValueDst.Set(Napi::String::New(env, "value"), Napi::String::New(env, (char *)listKeyValueSrc.value));
+        listKeyValueDst.set(PropertyKey::value, Napi::String::New(env, (char *)listKeyValueSrc.value));
       }
 
-      listKeyValueDst.Set(Napi::String::New(env, "dependentcount"), Napi::Number::New(env, listKeyValueSrc.dependentcount));
+      listKeyValueDst.set(PropertyKey::dependentcount, Napi::Number::New(env, listKeyValueSrc.dependentcount));
 
       Napi::Array dependenciesList = Napi::Array::New(env, listKeyValueSrc.dependentcount);
       for (int k=0; k< listKeyValueSrc.dependentcount; ++k) {
         DependencySetting& dependencySettingSrc = listKeyValueSrc.dependents[k];
 
-        Napi::Object dependencySettingDst = Napi::Object::New(env);
-        dependencySettingDst.Set(Napi::String::New(env, "GUID"), Napi::String::New(env, dependencySettingSrc.GUID ? dependencySettingSrc.GUID : ""));
-        dependencySettingDst.Set(Napi::String::New(env, "enableFlag"), Napi::Boolean::New(env, dependencySettingSrc.enableFlag));
+        dependencySettingDst.set(PropertyKey::GUID, Napi::String::New(env, dependencySettingSrc.GUID ? dependencySettingSrc.GUID : ""));
+        dependencySettingDst.set(PropertyKey::enableFlag, Napi::Boolean::New(env, dependencySettingSrc.enableFlag));
 
-        dependenciesList.Set(k, dependencySettingDst);
+        dependenciesList.Set(k, dependencySettingDst.build());
       }
 
-      listKeyValueDst.Set(Napi::String::New(env, "dependents"), dependenciesList);
+      listKeyValueDst.set(PropertyKey::dependents, dependenciesList);
 
-      keyValueList.Set(j, listKeyValueDst);
+      keyValueList.Set(j, listKeyValueDst.build());
     }
 
-    settingDst.Set(Napi::String::New(env, "listKeyValue"), keyValueList);
+    settingDst.set(PropertyKey::listKeyValue, keyValueList);
 
-    settings.Set(i, settingDst);
+    settings.Set(i, settingDst.build());
   }
 
-  dest.Set(Napi::String::New(env, "errStatus"), Napi::Number::New(env, src->errStatus));
-  dest.Set(Napi::String::New(env, "settingInfo"), settings);
+  dest.Set(keys[PropertyKey::errStatus], Napi::Number::New(env, src->errStatus));
+  dest.Set(keys[PropertyKey::settingInfo], settings);
 }
 
 Napi::Value napi_GetSettings(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
-    Napi::Function javascriptResultCallback = info[1].As<Napi::Function>();
 
-    (new util::JAsyncWorker<DeviceSettings *, Napi::Object>(
+    auto * const worker = new util::JAsyncWorker<DeviceSettings *, Napi::Object>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId]() -> DeviceSettings * { 
         DeviceSettings * const rawSetttings = Jabra_GetSettings(deviceId);
 
@@ -409,6 +496,11 @@ Napi::Value napi_GetSettings(const Napi::CallbackInfo& info) {
             IF_LOG_(LOGINSTANCE, plog::verbose) {
               LOG_VERBOSE_(LOGINSTANCE) << "napi_GetSetting got raw object : '" << toString(rawSetttings) << "'";
             }
+
+            // Settings are incomplete if the manifest could not be downloaded:
+            if (rawSetttings->errStatus == Jabra_ErrorStatus::NoError) {
+              DeviceMetadataCache::instance().storeSettings(deviceId, *rawSetttings);
+            }
         }
 
         return rawSetttings;
@@ -423,24 +515,35 @@ Napi::Value napi_GetSettings(const Napi::CallbackInfo& info) {
             Jabra_FreeDeviceSettings(rawSetttings);
           }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetPriority(util::SdkPriority::BULK);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_GetSetting(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::STRING, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     const std::string guid = info[1].As<Napi::String>();
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
-    (new util::JAsyncWorker<DeviceSettings *, Napi::Object>(
+    auto * const worker = new util::JAsyncWorker<DeviceSettings *, Napi::Object>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, guid]() -> DeviceSettings * { 
         DeviceSettings * const rawSetttings = Jabra_GetSetting(deviceId, guid.c_str());
 
@@ -465,29 +568,300 @@ Napi::Value napi_GetSetting(const Napi::CallbackInfo& info) {
             Jabra_FreeDeviceSettings(rawSetttings);
           }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetPriority(util::SdkPriority::BULK);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
+  }
+
+  return util::RejectedPromise(env, functionName);
+}
+
+/**
+ * Convert a settings schema to { revision, errStatus, settingInfo } with the same setting properties as toNodeType,
+ * except currValue and isSettingProtectionEnabled (see toNapiSettingValues).
+ */
+static Napi::Object toNapiSettingSchema(const Napi::Env& env, const SettingSchema& schema, Jabra_ErrorStatus errStatus) {
+  const PropertyKeys keys(env);
+  ObjectBuilder settingDst(keys), validationRuleDst(keys), listKeyValueDst(keys), dependencySettingDst(keys);
+
+  Napi::Array settings = Napi::Array::New(env, schema.settings.size());
+  for (size_t i=0; i<schema.settings.size(); ++i) {
+    const SettingSchema::Setting& settingSrc = schema.settings[i];
+
+    settingDst.set(PropertyKey::guid, Napi::String::New(env, settingSrc.guid));
+    settingDst.set(PropertyKey::name, Napi::String::New(env, settingSrc.name));
+    settingDst.set(PropertyKey::helpText, Napi::String::New(env, settingSrc.helpText));
+    settingDst.set(PropertyKey::isValidationSupport, Napi::Boolean::New(env, settingSrc.isValidationSupport));
+
+    if (settingSrc.hasValidationRule) {
+       validationRuleDst.set(PropertyKey::minLength, Napi::Number::New(env, settingSrc.minLength));
+       validationRuleDst.set(PropertyKey::maxLength, Napi::Number::New(env, settingSrc.maxLength));
+       validationRuleDst.set(PropertyKey::errorMessage, Napi::String::New(env, settingSrc.errorMessage));
+       validationRuleDst.set(PropertyKey::regExp, Napi::String::New(env, settingSrc.regExp));
+       settingDst.set(PropertyKey::validationRule, validationRuleDst.build());
+    }
+
+    settingDst.set(PropertyKey::isDeviceRestart, Napi::Boolean::New(env, settingSrc.isDeviceRestart));
+    settingDst.set(PropertyKey::isSettingProtected, Napi::Boolean::New(env, settingSrc.isSettingProtected));
+    settingDst.set(PropertyKey::isWirelessConnect, Napi::Boolean::New(env, settingSrc.isWirelessConnect));
+    settingDst.set(PropertyKey::cntrlType, Napi::Number::New(env, settingSrc.cntrlType));
+    settingDst.set(PropertyKey::settingDataType, Napi::Number::New(env, settingSrc.settingDataType));
+    settingDst.set(PropertyKey::groupName, Napi::String::New(env, settingSrc.groupName));
+    settingDst.set(PropertyKey::groupHelpText, Napi::String::New(env, settingSrc.groupHelpText));
+    settingDst.set(PropertyKey::isDepedentsetting, Napi::Boolean::New(env, settingSrc.isDepedentsetting));
+    settingDst.set(PropertyKey::isPCsetting, Napi::Boolean::New(env, settingSrc.isPCsetting));
+    settingDst.set(PropertyKey::isChildDeviceSetting, Napi::Boolean::New(env, settingSrc.isChildDeviceSetting));
+
+    if (settingSrc.hasDependentDefaultValue) {
+      if (settingSrc.settingDataType == DataType::settingByte) {
+        settingDst.set(PropertyKey::dependentDefaultValue, Napi::Number::New(env, (uint8_t)settingSrc.dependentDefaultValue[0]));
+      } else {
+        settingDst.set(PropertyKey::dependentDefaultValue, Napi::String::New(env, settingSrc.dependentDefaultValue));
+      }
+    }
+
+    Napi::Array keyValueList = Napi::Array::New(env, settingSrc.listKeyValue.size());
+    settingDst.set(PropertyKey::listSize, Napi::Number::New(env, settingSrc.listKeyValue.size()));
+    for (size_t j=0; j<settingSrc.listKeyValue.size(); ++j) {
+      const SettingSchema::ListEntry& listKeyValueSrc = settingSrc.listKeyValue[j];
+
+      listKeyValueDst.set(PropertyKey::key, Napi::Number::New(env, listKeyValueSrc.key));
+      listKeyValueDst.set(PropertyKey::value, Napi::String::New(env, listKeyValueSrc.value));
+      listKeyValueDst.set(PropertyKey::dependentcount, Napi::Number::New(env, listKeyValueSrc.dependents.size()));
+
+      Napi::Array dependenciesList = Napi::Array::New(env, listKeyValueSrc.dependents.size());
+      for (size_t k=0; k<listKeyValueSrc.dependents.size(); ++k) {
+        dependencySettingDst.set(PropertyKey::GUID, Napi::String::New(env, listKeyValueSrc.dependents[k].first));
+        dependencySettingDst.set(PropertyKey::enableFlag, Napi::Boolean::New(env, listKeyValueSrc.dependents[k].second));
+        dependenciesList.Set(k, dependencySettingDst.build());
+      }
+      listKeyValueDst.set(PropertyKey::dependents, dependenciesList);
+
+      keyValueList.Set(j, listKeyValueDst.build());
+    }
+    settingDst.set(PropertyKey::listKeyValue, keyValueList);
+
+    settings.Set(i, settingDst.build());
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set(Napi::String::New(env, "revision"), Napi::Number::New(env, schema.revision));
+  result.Set(keys[PropertyKey::errStatus], Napi::Number::New(env, errStatus));
+  result.Set(keys[PropertyKey::settingInfo], settings);
+  return result;
+}
+
+Napi::Object toNapiSettingValues(const Napi::Env& env, const SettingSchema& schema, const DeviceSettings& src) {
+  const size_t count = schema.settings.size();
+  Napi::Int16Array values = Napi::Int16Array::New(env, count);
+  Napi::Uint8Array protectionEnabled = Napi::Uint8Array::New(env, count);
+  Napi::Object stringValues = Napi::Object::New(env);
+
+  int16_t * const valueData = values.Data();
+  uint8_t * const protectionEnabledData = protectionEnabled.Data();
+  for (size_t i=0; i<count; ++i) {
+    valueData[i] = -1;
+    protectionEnabledData[i] = 0;
+  }
+
+  for (unsigned int i=0; i<src.settingCount; ++i) {
+    const SettingInfo& settingSrc = src.settingInfo[i];
+    const int index = schema.indexOf(settingSrc.guid, i);
+    if (index < 0) {
+      continue; // Not in the schema (only if it was replaced meanwhile, see schemaRevision).
+    }
+
+    protectionEnabledData[index] = settingSrc.isSettingProtectionEnabled ? 1 : 0;
+    if (settingSrc.currValue) {
+      if (settingSrc.settingDataType == DataType::settingByte) {
+        valueData[index] = *((uint8_t *)settingSrc.currValue);
+      } else if (settingSrc.settingDataType == DataType::settingString) {
+        stringValues.Set((uint32_t)index, Napi::String::New(env, (char *)settingSrc.currValue));
+      }
+    }
   }
 
-  return env.Undefined();
+  Napi::Object result = Napi::Object::New(env);
+  result.Set(Napi::String::New(env, "schemaRevision"), Napi::Number::New(env, schema.revision));
+  result.Set(Napi::String::New(env, "errStatus"), Napi::Number::New(env, src.errStatus));
+  result.Set(Napi::String::New(env, "values"), values);
+  result.Set(Napi::String::New(env, "stringValues"), stringValues);
+  result.Set(Napi::String::New(env, "protectionEnabled"), protectionEnabled);
+  return result;
+}
+
+/**
+ * Settings fetched from libjabra with the schema to index their values by.
+ */
+struct FetchedSettingValues {
+  DeviceSettings * rawSettings;
+  std::shared_ptr<const SettingSchema> schema;
+};
+
+/**
+ * The schema in effect after fetching all settings of a device (a schema not cached has revision 0).
+ */
+static std::shared_ptr<const SettingSchema> schemaOf(unsigned short deviceId, DeviceSettings * const rawSettings) {
+  try {
+    // Settings are incomplete if the manifest could not be downloaded:
+    std::shared_ptr<const SettingSchema> schema = rawSettings->errStatus == Jabra_ErrorStatus::NoError
+      ? DeviceMetadataCache::instance().storeSettings(deviceId, *rawSettings)
+      : DeviceMetadataCache::instance().getSettingSchema(deviceId);
+    return schema ? schema : std::make_shared<const SettingSchema>(SettingSchema::fromDeviceSettings(*rawSettings));
+  } catch (...) {
+    Jabra_FreeDeviceSettings(rawSettings);
+    throw;
+  }
+}
+
+/**
+ * Fetch current values of all settings, or of one setting if guid is set and the schema of the device is known.
+ */
+static FetchedSettingValues fetchSettingValues(const char * const functionName, unsigned short deviceId, const std::string& guid) {
+  if (!guid.empty()) {
+    std::shared_ptr<const SettingSchema> schema = DeviceMetadataCache::instance().getSettingSchema(deviceId);
+    if (schema) {
+      DeviceSettings * const rawSettings = Jabra_GetSetting(deviceId, guid.c_str());
+      if (!rawSettings) {
+        util::JabraException::LogAndThrow(functionName, "null returned");
+      }
+
+      bool known = true;
+      for (unsigned int i=0; i<rawSettings->settingCount; ++i) {
+        known = known && schema->indexOf(rawSettings->settingInfo[i].guid, 0) >= 0;
+      }
+      if (known) {
+        return { rawSettings, schema };
+      }
+      Jabra_FreeDeviceSettings(rawSettings); // Schema outdated - fetch all settings instead to replace it.
+    }
+  }
+
+  DeviceSettings * const rawSettings = Jabra_GetSettings(deviceId);
+  if (!rawSettings) {
+    util::JabraException::LogAndThrow(functionName, "null returned");
+  }
+  return { rawSettings, schemaOf(deviceId, rawSettings) };
+}
+
+static Napi::Value getSettingValues(const char * const functionName, const Napi::CallbackInfo& info, bool single) {
+  Napi::Env env = info.Env();
+
+  util::CallOptions callOptions;
+  if (single ? util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::STRING}, callOptions)
+             : util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
+    const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
+    const std::string guid = single ? info[1].As<Napi::String>().Utf8Value() : "";
+
+    auto * const worker = new util::JAsyncWorker<FetchedSettingValues, Napi::Object>(
+      functionName,
+      env,
+      [functionName, deviceId, guid]() {
+        return fetchSettingValues(functionName, deviceId, guid);
+      }, [](const Napi::Env& env, const FetchedSettingValues& fetched) {
+        return toNapiSettingValues(env, *fetched.schema, *fetched.rawSettings);
+      }, [](FetchedSettingValues& fetched) {
+        if (fetched.rawSettings) {
+          Jabra_FreeDeviceSettings(fetched.rawSettings);
+        }
+      }
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetPriority(util::SdkPriority::BULK);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
+  }
+
+  return util::RejectedPromise(env, functionName);
+}
+
+Napi::Value napi_GetSettingValues(const Napi::CallbackInfo& info) {
+  return getSettingValues(__func__, info, false);
+}
+
+Napi::Value napi_GetSettingValue(const Napi::CallbackInfo& info) {
+  return getSettingValues(__func__, info, true);
+}
+
+Napi::Value napi_GetSettingsSchema(const Napi::CallbackInfo& info) {
+  const char * const functionName = __func__;
+  Napi::Env env = info.Env();
+
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
+    const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
+
+    auto * const worker = new util::JAsyncWorker<std::pair<std::shared_ptr<const SettingSchema>, Jabra_ErrorStatus>, Napi::Object>(
+      functionName,
+      env,
+      [functionName, deviceId]() {
+        // Known from disk or from an earlier call in the usual case:
+        std::shared_ptr<const SettingSchema> schema = DeviceMetadataCache::instance().getSettingSchema(deviceId);
+        if (schema) {
+          return std::make_pair(schema, Jabra_ErrorStatus::NoError);
+        }
+
+        DeviceSettings * const rawSettings = Jabra_GetSettings(deviceId);
+        if (!rawSettings) {
+          util::JabraException::LogAndThrow(functionName, "null returned");
+        }
+        schema = schemaOf(deviceId, rawSettings);
+        const Jabra_ErrorStatus errStatus = rawSettings->errStatus;
+        Jabra_FreeDeviceSettings(rawSettings);
+        return std::make_pair(schema, errStatus);
+      }, [](const Napi::Env& env, const std::pair<std::shared_ptr<const SettingSchema>, Jabra_ErrorStatus>& result) {
+        return toNapiSettingSchema(env, *result.first, result.second);
+      }
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetPriority(util::SdkPriority::BULK);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
+  }
+
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_SetSettings(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::OBJECT, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER, util::OBJECT}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
     Napi::Object settings = info[1].As<Napi::Object>();
-    Napi::Function javascriptResultCallback = info[2].As<Napi::Function>();
 
     DeviceSettings * const rawDeviceSettings = toCType(deviceId, settings);
     IF_LOG_(LOGINSTANCE, plog::verbose) {
       LOG_VERBOSE_(LOGINSTANCE) << "napi_SetSettings translated settings input argument into raw object : '" << toString(rawDeviceSettings) << "'";
     }
 
-    (new util::JAsyncWorker<void, void>(
+    auto * const worker = new util::JAsyncWorker<void, void>(
       functionName,
-      javascriptResultCallback,
+      env,
       [functionName, deviceId, rawDeviceSettings](){
         Jabra_ReturnCode retv;
         if ((retv = Jabra_SetSettings(deviceId, rawDeviceSettings)) != Return_Ok) {
@@ -498,10 +872,17 @@ Napi::Value napi_SetSettings(const Napi::CallbackInfo& info) {
           Custom_FreeDeviceSettings(rawDeviceSettings);
         }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetPriority(util::SdkPriority::BULK);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
 
 Napi::Value napi_FactoryReset(const Napi::CallbackInfo& info) {
@@ -516,31 +897,22 @@ Napi::Value napi_FactoryReset(const Napi::CallbackInfo& info) {
 }
 
 Napi::Value napi_IsSettingProtectionEnabled(const Napi::CallbackInfo& info) {
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, info, [](unsigned short deviceId) {
+  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, util::AsyncOptions::ReadOnly(), info, [](unsigned short deviceId) {
     bool retv = Jabra_IsSettingProtectionEnabled(deviceId);
     return retv;
   }, [](const Napi::Env& env, bool cppResult) { return Napi::Boolean::New(env, cppResult); });
 }
 
 Napi::Value napi_IsUploadImageSupported(const Napi::CallbackInfo& info) {
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, info, [](unsigned short deviceId) {
-    bool retv = Jabra_IsUploadImageSupported(deviceId);
-    return retv;
-  }, [](const Napi::Env& env, bool cppResult) { return Napi::Boolean::New(env, cppResult); });
+  return CachedCapabilityFunction(__func__, DeviceCapability::UPLOAD_IMAGE, info);
 }
 
 Napi::Value napi_IsUploadRingtoneSupported(const Napi::CallbackInfo& info) {
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, info, [](unsigned short deviceId) {
-    bool retv = Jabra_IsUploadRingtoneSupported(deviceId);
-    return retv;
-  }, [](const Napi::Env& env, bool cppResult) { return Napi::Boolean::New(env, cppResult); });
+  return CachedCapabilityFunction(__func__, DeviceCapability::UPLOAD_RINGTONE, info);
 }
 
 Napi::Value napi_IsFactoryResetSupported(const Napi::CallbackInfo& info) {
-  return util::SimpleDeviceAsyncFunction<Napi::Boolean, bool>(__func__, info, [](unsigned short deviceId) {
-    bool retv = Jabra_IsFactoryResetSupported(deviceId);
-    return retv;
-  }, [](const Napi::Env& env, bool cppResult) { return Napi::Boolean::New(env, cppResult); });
+  return CachedCapabilityFunction(__func__, DeviceCapability::FACTORY_RESET, info);
 }
 
 /**
@@ -560,13 +932,17 @@ Napi::Value napi_GetFailedSettingNames(const Napi::CallbackInfo& info) {
   const char * const functionName = __func__;
   Napi::Env env = info.Env();
 
-  if (util::verifyArguments(functionName, info, {util::NUMBER, util::FUNCTION})) {
+  util::CallOptions callOptions;
+  if (util::verifyArgumentsWithCallOptions(functionName, info, {util::NUMBER}, callOptions)) {
+    if (callOptions.aborted) {
+      return util::AbortedPromise(env, functionName);
+    }
+
     const unsigned short deviceId = (unsigned short)(info[0].As<Napi::Number>().Int32Value());
-    Napi::Function javascriptResultCallback = info[1].As<Napi::Function>();
 
-    (new util::JAsyncWorker<FailedSettings *, Napi::Object>(
+    auto * const worker = new util::JAsyncWorker<FailedSettings *, Napi::Object>(
       functionName, 
-      javascriptResultCallback,
+      env,
       [functionName, deviceId]() -> FailedSettings * { 
         FailedSettings * const rawSetttings = Jabra_GetFailedSettingNames(deviceId);
         return rawSetttings;
@@ -581,8 +957,14 @@ Napi::Value napi_GetFailedSettingNames(const Napi::CallbackInfo& info) {
             Jabra_FreeFailedSettings(rawSetttings);
           }
       }
-    ))->Queue();
+    );
+    worker->SetDeviceStrand(deviceId);
+    worker->SetCallOptions(callOptions);
+
+    const Napi::Value promise = worker->Promise();
+    worker->Queue();
+    return promise;
   }
 
-  return env.Undefined();
+  return util::RejectedPromise(env, functionName);
 }
@@ -1,11 +1,97 @@
+#pragma once
+
 #include "stdafx.h"
 
+#include <string>
+#include <vector>
+
 Napi::Value napi_GetSetting(const Napi::CallbackInfo& info);
 Napi::Value napi_GetSettings(const Napi::CallbackInfo& info);
+Napi::Value napi_GetSettingsSchema(const Napi::CallbackInfo& info);
+Napi::Value napi_GetSettingValues(const Napi::CallbackInfo& info);
+Napi::Value napi_GetSettingValue(const Napi::CallbackInfo& info);
 Napi::Value napi_SetSettings(const Napi::CallbackInfo& info);
 Napi::Value napi_FactoryReset(const Napi::CallbackInfo& info);
 Napi::Value napi_IsSettingProtectionEnabled(const Napi::CallbackInfo& info);
 Napi::Value napi_IsUploadImageSupported(const Napi::CallbackInfo& info);
 Napi::Value napi_IsUploadRingtoneSupported(const Napi::CallbackInfo& info);
 Napi::Value napi_IsFactoryResetSupported(const Napi::CallbackInfo& info);
-Napi::Value napi_GetFailedSettingNames(const Napi::CallbackInfo& info);
\ No newline at end of file
+Napi::Value napi_GetFailedSettingNames(const Napi::CallbackInfo& info);
+
+/**
+ * The static part of a device's settings (everything but the current values and the protection state), which is the
+ * same for all devices with the same product ID and firmware version (see DeviceMetadataCache).
+ */
+struct SettingSchema {
+  struct ListEntry {
+    unsigned short key;
+    std::string value;
+    std::vector<std::pair<std::string, bool>> dependents; // (GUID, enableFlag)
+  };
+
+  struct Setting {
+    std::string guid;
+    std::string name;
+    std::string helpText;
+    bool isValidationSupport;
+    bool hasValidationRule;
+    int minLength;
+    int maxLength;
+    std::string regExp;
+    std::string errorMessage;
+    bool isDeviceRestart;
+    bool isSettingProtected;
+    bool isWirelessConnect;
+    ControlType cntrlType;
+    DataType settingDataType;
+    std::string groupName;
+    std::string groupHelpText;
+    bool isDepedentsetting;
+    bool hasDependentDefaultValue;
+    std::string dependentDefaultValue; // A single byte for DataType::settingByte.
+    bool isPCsetting;
+    bool isChildDeviceSetting;
+    std::vector<ListEntry> listKeyValue;
+  };
+
+  std::vector<Setting> settings;
+  uint32_t revision; // Per device, bumped when its schema is replaced (see DeviceMetadataCache::storeSettings).
+
+  /**
+   * Extract the schema from settings returned by Jabra_GetSettings.
+   */
+  static SettingSchema fromDeviceSettings(const DeviceSettings& src);
+
+  /**
+   * True if the settings have the same GUIDs in the same order as this schema (i.e. values can be indexed by it).
+   */
+  bool matches(const DeviceSettings& src) const;
+
+  /**
+   * Index of the setting with a GUID, or -1. Expected to be near hint (the index in a Jabra_GetSettings result).
+   */
+  int indexOf(const char * guid, unsigned int hint) const;
+};
+
+/**
+ * Copy a native sdk DeviceSettings object into an empty napi device settings object (exposed for benchmarks).
+ */
+void toNodeType(const unsigned short deviceId, DeviceSettings *src, Napi::Object& dest);
+
+/**
+ * Convert the current values of native sdk settings to { schemaRevision, errStatus, values, stringValues,
+ * protectionEnabled }, indexed by the position of each setting in the schema (exposed for benchmarks).
+ */
+Napi::Object toNapiSettingValues(const Napi::Env& env, const SettingSchema& schema, const DeviceSettings& src);
+
+#ifdef BUILD_BENCHMARKS
+/**
+ * Convert a synthetic DeviceSettings object repeatedly (see src/benchmark/settings-conversion.cc).
+ */
+Napi::Value napi_BenchmarkSettingsConversion(const Napi::CallbackInfo& info);
+
+/**
+ * Convert the values of a synthetic DeviceSettings object repeatedly (see src/benchmark/settings-conversion.cc).
+ */
+Napi::Value napi_BenchmarkSettingValuesConversion(const Napi::CallbackInfo& info);
+#endif
\ No newline at end of file
@@ -0,0 +1,55 @@
+#include "startup.h"
+#include "latencyhistogram.h"
+
+/**
+ * Name of a stage as reported to javascript.
+ */
+static const char * toString(StartupStage stage) {
+  switch (stage) {
+    case StartupStage::APP_ID_SET: return "appIdSetMs";
+    case StartupStage::CATALOGUE_READY: return "catalogueReadyMs";
+    case StartupStage::INITIALIZED: return "initializedMs";
+    case StartupStage::FIRST_SCAN_DONE: return "firstScanDoneMs";
+    case StartupStage::FIRST_ATTACH: return "firstAttachMs";
+    default: return "???";
+  }
+}
+
+StartupTiming& StartupTiming::instance() {
+  static StartupTiming timing;
+  return timing;
+}
+
+StartupTiming::StartupTiming() : startNs(0) {
+  for (auto& ns : stageNs) {
+    ns = 0;
+  }
+}
+
+void StartupTiming::start() {
+  for (auto& ns : stageNs) {
+    ns = 0;
+  }
+  startNs = util::monotonicTimeNs();
+}
+
+void StartupTiming::mark(StartupStage stage) {
+  uint64_t expected = 0;
+  if (stageNs[static_cast<size_t>(stage)].compare_exchange_strong(expected, util::monotonicTimeNs())) {
+    LOG_DEBUG_(LOGINSTANCE) << "Startup stage " << toString(stage) << " reached";
+  }
+}
+
+Napi::Object StartupTiming::toNapi(const Napi::Env& env) const {
+  Napi::Object result = Napi::Object::New(env);
+
+  const uint64_t start = startNs;
+  for (size_t s = 0; s < STARTUP_STAGE_COUNT; ++s) {
+    const uint64_t ns = stageNs[s];
+    if (start != 0 && ns >= start) {
+      result.Set(Napi::String::New(env, toString(static_cast<StartupStage>(s))), Napi::Number::New(env, (double)(ns - start) / 1000000.0));
+    }
+  }
+
+  return result;
+}
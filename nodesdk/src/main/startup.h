@@ -0,0 +1,51 @@
+#pragma once
+
+#include "stdafx.h"
+
+#include <atomic>
+
+/**
+ * Milestones of sdk startup, in the order they normally happen.
+ */
+enum class StartupStage {
+  APP_ID_SET = 0,
+  CATALOGUE_READY,  // Preload zip of the device catalogue read (only if configured).
+  INITIALIZED,      // Jabra_InitializeV2 returned and all callbacks are registered.
+  FIRST_SCAN_DONE,
+  FIRST_ATTACH
+};
+
+const size_t STARTUP_STAGE_COUNT = 5;
+
+/**
+ * When the startup milestones were reached, measured from the start of napi_Initialize - for tuning cold starts.
+ *
+ * Thread-safe: Stages are marked from the init thread and the sdk callback threads.
+ */
+class StartupTiming {
+  public:
+    static StartupTiming& instance();
+
+    /**
+     * Start measuring (forgetting stages of an earlier initialization).
+     */
+    void start();
+
+    /**
+     * Record that a stage is reached now, unless it was already reached.
+     */
+    void mark(StartupStage stage);
+
+    /**
+     * Get the stages reached so far as { <stage>Ms: ms since start } (f.x. { initializedMs: 120.5 }). Main thread only.
+     */
+    Napi::Object toNapi(const Napi::Env& env) const;
+
+  private:
+    StartupTiming();
+    StartupTiming(const StartupTiming&) = delete;
+    StartupTiming& operator=(const StartupTiming&) = delete;
+
+    std::atomic<uint64_t> startNs;
+    std::atomic<uint64_t> stageNs[STARTUP_STAGE_COUNT]; // Indexed by StartupStage - 0 until reached.
+};
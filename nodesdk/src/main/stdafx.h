@@ -19,6 +19,7 @@
 #include <Common.h>
 #include <JabraDeviceConfig.h>
 #include <JabraNativeHid.h>
+#include "jabralib.h" // libjabra is loaded lazily - see jabralib.h.
 
 // Own stuff:
 #include "jabrautil.h"
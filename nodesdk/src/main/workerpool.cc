@@ -0,0 +1,92 @@
+#include "workerpool.h"
+
+#include <new>
+
+namespace util {
+
+SdkWorkerPool& SdkWorkerPool::instance() {
+    // Intentionally leaked - see class comment.
+    static SdkWorkerPool * pool = new SdkWorkerPool();
+    return *pool;
+}
+
+SdkWorkerPool::SdkWorkerPool()
+    : mutex(), freeLists(), capacity(DEFAULT_CAPACITY), hitCount(0), missCount(0), discardedCount(0) {
+}
+
+size_t SdkWorkerPool::sizeClassOf(size_t size) {
+    return (size + SIZE_CLASS_BYTES - 1) / SIZE_CLASS_BYTES - 1;
+}
+
+void SdkWorkerPool::setCapacity(unsigned int _capacity) {
+    std::lock_guard<std::mutex> lock(mutex);
+    capacity = _capacity;
+    for (auto& freeList : freeLists) {
+        while (freeList.size() > capacity) {
+            ::operator delete(freeList.back());
+            freeList.pop_back();
+        }
+        freeList.shrink_to_fit();
+    }
+}
+
+void * SdkWorkerPool::allocate(size_t size) {
+    if (size > 0 && size <= MAX_POOLED_BYTES) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<void *>& freeList = freeLists[sizeClassOf(size)];
+        if (!freeList.empty()) {
+            void * const memory = freeList.back();
+            freeList.pop_back();
+            ++hitCount;
+            return memory;
+        }
+        ++missCount;
+
+        // Allocate the full size class, so the memory can be reused by any worker of the same class:
+        return ::operator new((sizeClassOf(size) + 1) * SIZE_CLASS_BYTES);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++missCount;
+    }
+    return ::operator new(size);
+}
+
+void SdkWorkerPool::release(void * memory, size_t size) {
+    if (memory == nullptr) {
+        return;
+    }
+
+    if (size > 0 && size <= MAX_POOLED_BYTES) {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<void *>& freeList = freeLists[sizeClassOf(size)];
+        if (freeList.size() < capacity) {
+            try {
+                freeList.push_back(memory);
+                return;
+            } catch (const std::bad_alloc&) {
+                // Called from operator delete, so must not throw - just free the memory below.
+            }
+        }
+        ++discardedCount;
+    }
+
+    ::operator delete(memory);
+}
+
+SdkWorkerPoolStats SdkWorkerPool::getStats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    SdkWorkerPoolStats stats;
+    stats.capacity = capacity;
+    stats.pooled = 0;
+    for (const auto& freeList : freeLists) {
+        stats.pooled += freeList.size();
+    }
+    stats.hits = hitCount;
+    stats.misses = missCount;
+    stats.discarded = discardedCount;
+    return stats;
+}
+
+} // namespace util
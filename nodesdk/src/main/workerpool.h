@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace util {
+
+/**
+ * Snapshot of worker pool configuration and counters (for diagnostics only).
+ */
+struct SdkWorkerPoolStats {
+    /** Max number of free workers kept per size class (0 = pooling disabled). */
+    unsigned int capacity;
+    /** Number of free workers currently kept by the pool. */
+    size_t pooled;
+    /** Workers created in memory reused from the pool. */
+    uint64_t hits;
+    /** Workers created in newly allocated memory (pool empty, disabled or worker too large). */
+    uint64_t misses;
+    /** Released workers whose memory was freed because the pool was full. */
+    uint64_t discarded;
+};
+
+/**
+ * Bounded pool of memory for async workers, so the high rate of short-lived workers created by frequent
+ * polling calls does not turn into a steady churn of heap allocations.
+ *
+ * Workers are created and deleted as usual - SdkAsyncWorker's class-level operator new/delete get their
+ * memory here. Memory is kept in free lists per size class (multiples of SIZE_CLASS_BYTES), so workers of
+ * all the common helper shapes share the same few free lists. When the free list of a size class is empty,
+ * or a worker is larger than MAX_POOLED_BYTES, memory is allocated normally. When a free list is full, the
+ * memory of a released worker is freed normally.
+ *
+ * Nb. The pool is a process wide singleton that is intentionally leaked (like the SdkExecutor), as workers
+ * may still be released during process shutdown.
+ */
+class SdkWorkerPool {
+  public:
+    static const size_t SIZE_CLASS_BYTES = 64;
+    static const size_t MAX_POOLED_BYTES = 1024;
+    static const unsigned int DEFAULT_CAPACITY = 32;
+
+    static SdkWorkerPool& instance();
+
+    /**
+     * Set max number of free workers kept per size class (0 disables pooling). Shrinks the free lists if needed.
+     */
+    void setCapacity(unsigned int capacity);
+
+    /**
+     * Get memory for a worker of the given size.
+     */
+    void * allocate(size_t size);
+
+    /**
+     * Release memory from allocate(). Size must be the same as passed to allocate().
+     */
+    void release(void * memory, size_t size);
+
+    SdkWorkerPoolStats getStats();
+
+  private:
+    static const size_t SIZE_CLASS_COUNT = MAX_POOLED_BYTES / SIZE_CLASS_BYTES;
+
+    SdkWorkerPool();
+    SdkWorkerPool(const SdkWorkerPool&) = delete;
+    SdkWorkerPool& operator=(const SdkWorkerPool&) = delete;
+
+    static size_t sizeClassOf(size_t size);
+
+    std::mutex mutex;
+    std::vector<void *> freeLists[SIZE_CLASS_COUNT]; // Indexed by size class.
+    unsigned int capacity;
+    uint64_t hitCount;
+    uint64_t missCount;
+    uint64_t discardedCount;
+};
+
+} // namespace util
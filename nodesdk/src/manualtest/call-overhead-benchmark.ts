@@ -0,0 +1,52 @@
+import { createJabraApplication } from '../main/index';
+import { SdkIntegration } from '../main/sdkintegration';
+
+/**
+ * Measures the per-call overhead of promise returning native functions built on
+ * JAsyncWorker (std::function callables) compared to those built with MakeJAsyncWorker.
+ *
+ * GetErrorString (JAsyncWorker) and GetVersion (MakeJAsyncWorker) are both trivial
+ * libjabra calls that do not need a device, so the difference between them is
+ * dominated by the worker type.
+ */
+
+const CALLS = parseInt(process.env.BENCHMARK_CALLS || "20000");
+
+async function measure(name: string, call: () => Promise<any>) {
+    // Warm up so JIT and native executor threads are ready.
+    for (let i = 0; i < 1000; ++i) {
+        await call();
+    }
+
+    const gc = (global as any).gc;
+    if (gc) {
+        gc();
+    }
+
+    const heapBefore = process.memoryUsage().heapUsed;
+    const start = process.hrtime();
+    for (let i = 0; i < CALLS; ++i) {
+        await call();
+    }
+    const [s, ns] = process.hrtime(start);
+    const heapAfter = process.memoryUsage().heapUsed;
+
+    const totalUs = s * 1e6 + ns / 1e3;
+    console.log(name + ": " + (totalUs / CALLS).toFixed(2) + " us/call, " +
+                ((heapAfter - heapBefore) / CALLS).toFixed(0) + " heap bytes/call");
+}
+
+(async () => {
+    try {
+        let jabra = await createJabraApplication('A7tSsfD42VenLagL2mM6i2f0VafP/842cbuPCnC+uE8=');
+
+        const sdkIntegration: SdkIntegration = require('bindings')('sdkintegration');
+        console.log("Sequential calls: " + CALLS + " (run with node --expose-gc for heap numbers)");
+        await measure("JAsyncWorker (GetErrorString)", () => sdkIntegration.GetErrorString(8));
+        await measure("MakeJAsyncWorker (GetVersion)", () => sdkIntegration.GetVersion());
+
+        await jabra.disposeAsync();
+    } catch (err) {
+        console.error("Benchmark failed with error " + err);
+    }
+})();
@@ -0,0 +1,33 @@
+import * as child_process from 'child_process';
+
+/**
+ * Measures how long requiring the native addon takes in a fresh node process.
+ *
+ * The addon loads libjabra lazily at initialization (see jabralib.h), so requiring it should not
+ * pay for loading libjabra and its dependencies. Run on a build from before and after that change
+ * to compare. The time to load libjabra itself is reported as library.loadMs by
+ * getNativeMetricsAsync() after initialization.
+ */
+
+const RUNS = parseInt(process.env.BENCHMARK_RUNS || "20");
+
+function measureRequireMs(): number {
+    const script = "const start = process.hrtime(); require('bindings')('sdkintegration'); " +
+                   "const [s, ns] = process.hrtime(start); process.stdout.write(String(s * 1e3 + ns / 1e6));";
+    return parseFloat(child_process.execFileSync(process.execPath, [ "-e", script ], { cwd: process.cwd() }).toString());
+}
+
+try {
+    measureRequireMs(); // Warm up the os file cache.
+
+    const times: number[] = [];
+    for (let i = 0; i < RUNS; ++i) {
+        times.push(measureRequireMs());
+    }
+    times.sort((a, b) => a - b);
+
+    console.log("Addon require time over " + RUNS + " fresh processes: median " + times[Math.floor(RUNS / 2)].toFixed(2) +
+                " ms, min " + times[0].toFixed(2) + " ms, max " + times[RUNS - 1].toFixed(2) + " ms");
+} catch (err) {
+    console.error("Benchmark failed with error " + err);
+}
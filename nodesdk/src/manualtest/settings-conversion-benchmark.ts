@@ -0,0 +1,57 @@
+import { SdkIntegration } from '../main/sdkintegration';
+
+/**
+ * Measures converting a synthetic DeviceSettings object with many settings to javascript,
+ * comparing the old conversion (new key string and Set call per property) with the current one
+ * (shared interned keys, all properties of an object defined at once), and with converting only
+ * the current values as getSettingValuesAsync does.
+ *
+ * Needs the addon built with "node-gyp rebuild --build_benchmarks=true" (done by
+ * "npm run benchmark-settings-conversion"). No device or sdk initialization is needed.
+ */
+
+const SETTINGS = parseInt(process.env.BENCHMARK_SETTINGS || "500");
+const ITERATIONS = parseInt(process.env.BENCHMARK_ITERATIONS || "200");
+
+function measure(name: string, convert: () => any): any {
+    // Warm up so JIT and V8 object shapes are ready.
+    convert();
+
+    const gc = (global as any).gc;
+    if (gc) {
+        gc();
+    }
+
+    const start = process.hrtime();
+    const result = convert();
+    const [s, ns] = process.hrtime(start);
+
+    const totalUs = s * 1e6 + ns / 1e3;
+    console.log(name + ": " + (totalUs / ITERATIONS / 1000).toFixed(2) + " ms/conversion, " +
+                (totalUs * 1000 / ITERATIONS / SETTINGS).toFixed(0) + " ns/setting");
+    return result;
+}
+
+try {
+    const sdkIntegration: SdkIntegration = require('bindings')('sdkintegration');
+    const benchmark = sdkIntegration.BenchmarkSettingsConversion;
+    if (!benchmark) {
+        throw new Error("addon not built with --build_benchmarks=true");
+    }
+
+    console.log("Converting " + SETTINGS + " settings " + ITERATIONS + " times (run with node --expose-gc for stable numbers)");
+    const legacyResult = measure("legacy (key string + Set per property)", () => benchmark(SETTINGS, ITERATIONS, true));
+    const internedResult = measure("interned keys + napi_define_properties", () => benchmark(SETTINGS, ITERATIONS, false));
+    const valuesBenchmark = sdkIntegration.BenchmarkSettingValuesConversion;
+    if (valuesBenchmark) {
+        measure("values only (typed array)", () => valuesBenchmark(SETTINGS, ITERATIONS));
+    }
+
+    if (JSON.stringify(legacyResult) !== JSON.stringify(internedResult)) {
+        console.error("Conversions differ - the benchmark is not comparing like with like!");
+        process.exitCode = 1;
+    }
+} catch (err) {
+    console.error("Benchmark failed with error " + err);
+    process.exitCode = 1;
+}
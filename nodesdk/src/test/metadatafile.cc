@@ -0,0 +1,314 @@
+/**
+ * Tests of the cache files of DeviceMetadataCache (see MetadataFile): Round trip of all metadata, dropping corrupt,
+ * truncated and wrong-key files, and evicting the least recently used files beyond the size limit.
+ *
+ * Only uses the napi and libjabra headers for their types - neither is called. Build and run with
+ * "npm run test-native".
+ */
+
+#include "../main/metadatafile.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#include <sys/utime.h>
+#define getpid _getpid
+#define rmdir _rmdir
+#define utime _utime
+#define utimbuf _utimbuf
+#else
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+static int failures = 0;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++failures; \
+        } \
+    } while (false)
+
+static std::string testDirectory() {
+    const char * tmp = std::getenv("TMPDIR");
+    if (!tmp) {
+        tmp = std::getenv("TEMP");
+    }
+    return std::string(tmp ? tmp : "/tmp") + "/metadatafile-test-" + std::to_string(getpid());
+}
+
+static bool exists(const std::string& path) {
+    return std::ifstream(path).good();
+}
+
+static std::string readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static void writeFile(const std::string& path, const std::string& content) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), content.size());
+}
+
+static void setLastUsed(const std::string& path, time_t time) {
+    struct utimbuf times;
+    times.actime = time;
+    times.modtime = time;
+    utime(path.c_str(), &times);
+}
+
+static DeviceMetadata key(unsigned short productId, const std::string& firmwareVersion) {
+    DeviceMetadata metadata;
+    metadata.productId = productId;
+    metadata.firmwareVersion = firmwareVersion;
+    metadata.libraryVersion = "1.2.3";
+    return metadata;
+}
+
+static DeviceMetadata sample(unsigned short productId, const std::string& firmwareVersion) {
+    DeviceMetadata metadata = key(productId, firmwareVersion);
+    for (size_t i = 0; i < DEVICE_CAPABILITY_COUNT; ++i) {
+        metadata.capabilities.known[i] = i % 3 != 0;
+        metadata.capabilities.supported[i] = i % 2 == 0;
+    }
+    metadata.capabilities.features = { BusyLight, PairingList, RemoteMMI };
+    metadata.buttonTypes = {
+        { 0x23, "Volume", { { 1, "Up" }, { 2, "Down" } } },
+        { 0x2F, "Mute", {} }
+    };
+
+    auto schema = std::make_shared<SettingSchema>();
+    schema->revision = 1;
+    SettingSchema::Setting setting = {};
+    setting.guid = "{2E5A2A2A-1234-4B5C-9D6E-7F8091A2B3C4}";
+    setting.name = "Ringtone";
+    setting.helpText = "Select the ringtone";
+    setting.hasValidationRule = true;
+    setting.minLength = 1;
+    setting.maxLength = 16;
+    setting.regExp = "[a-z]+";
+    setting.errorMessage = "Invalid";
+    setting.isDeviceRestart = true;
+    setting.cntrlType = cntrlComboBox;
+    setting.settingDataType = settingByte;
+    setting.groupName = "Audio";
+    setting.groupHelpText = "Audio settings";
+    setting.isDepedentsetting = true;
+    setting.dependentDefaultValue = "\x01";
+    setting.listKeyValue = {
+        { 0, "Off", { { "{DEPENDENT-GUID}", false } } },
+        { 1, "Ring 1", {} }
+    };
+    schema->settings.push_back(setting);
+    metadata.settingSchema = schema;
+    return metadata;
+}
+
+static bool sameMetadata(const DeviceMetadata& a, const DeviceMetadata& b) {
+    for (size_t i = 0; i < DEVICE_CAPABILITY_COUNT; ++i) {
+        if (a.capabilities.known[i] != b.capabilities.known[i] || a.capabilities.supported[i] != b.capabilities.supported[i]) {
+            return false;
+        }
+    }
+    if (a.capabilities.features != b.capabilities.features || a.buttonTypes.size() != b.buttonTypes.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.buttonTypes.size(); ++i) {
+        if (a.buttonTypes[i].key != b.buttonTypes[i].key || a.buttonTypes[i].value != b.buttonTypes[i].value
+            || a.buttonTypes[i].events != b.buttonTypes[i].events) {
+            return false;
+        }
+    }
+    if (!a.settingSchema || !b.settingSchema) {
+        return !a.settingSchema && !b.settingSchema;
+    }
+    const auto& x = a.settingSchema->settings;
+    const auto& y = b.settingSchema->settings;
+    if (x.size() != y.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < x.size(); ++i) {
+        if (x[i].guid != y[i].guid || x[i].name != y[i].name || x[i].helpText != y[i].helpText
+            || x[i].isValidationSupport != y[i].isValidationSupport || x[i].hasValidationRule != y[i].hasValidationRule
+            || x[i].minLength != y[i].minLength || x[i].maxLength != y[i].maxLength || x[i].regExp != y[i].regExp
+            || x[i].errorMessage != y[i].errorMessage || x[i].isDeviceRestart != y[i].isDeviceRestart
+            || x[i].isSettingProtected != y[i].isSettingProtected || x[i].isWirelessConnect != y[i].isWirelessConnect
+            || x[i].cntrlType != y[i].cntrlType || x[i].settingDataType != y[i].settingDataType
+            || x[i].groupName != y[i].groupName || x[i].groupHelpText != y[i].groupHelpText
+            || x[i].isDepedentsetting != y[i].isDepedentsetting
+            || x[i].hasDependentDefaultValue != y[i].hasDependentDefaultValue
+            || x[i].dependentDefaultValue != y[i].dependentDefaultValue || x[i].isPCsetting != y[i].isPCsetting
+            || x[i].isChildDeviceSetting != y[i].isChildDeviceSetting
+            || x[i].listKeyValue.size() != y[i].listKeyValue.size()) {
+            return false;
+        }
+        for (size_t j = 0; j < x[i].listKeyValue.size(); ++j) {
+            if (x[i].listKeyValue[j].key != y[i].listKeyValue[j].key || x[i].listKeyValue[j].value != y[i].listKeyValue[j].value
+                || x[i].listKeyValue[j].dependents != y[i].listKeyValue[j].dependents) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void testRoundTrip(const std::string& directory) {
+    const DeviceMetadata written = sample(0x2456, "1.8.0");
+    DeviceMetadata read = key(0x2456, "1.8.0");
+    CHECK(MetadataFile::read(directory, read) == MetadataFile::ReadResult::MISSING);
+
+    CHECK(MetadataFile::write(directory, written, 1024 * 1024).written);
+    CHECK(MetadataFile::read(directory, read) == MetadataFile::ReadResult::READ);
+    CHECK(sameMetadata(written, read));
+
+    // Without a settings schema (settings not fetched yet):
+    DeviceMetadata withoutSchema = sample(0x2456, "1.9.0");
+    withoutSchema.settingSchema = nullptr;
+    read = key(0x2456, "1.9.0");
+    CHECK(MetadataFile::write(directory, withoutSchema, 1024 * 1024).written);
+    CHECK(MetadataFile::read(directory, read) == MetadataFile::ReadResult::READ);
+    CHECK(!read.settingSchema);
+    CHECK(sameMetadata(withoutSchema, read));
+
+    std::remove(MetadataFile::path(directory, written).c_str());
+    std::remove(MetadataFile::path(directory, withoutSchema).c_str());
+}
+
+static void testDropsDamagedFiles(const std::string& directory) {
+    const DeviceMetadata written = sample(0x0412, "3.1.4");
+    const std::string path = MetadataFile::path(directory, written);
+    CHECK(MetadataFile::write(directory, written, 1024 * 1024).written);
+    const std::string content = readFile(path);
+    CHECK(content.size() > 64);
+
+    // Truncated anywhere (header or payload):
+    const size_t truncatedSizes[] = { 3, 15, content.size() / 2, content.size() - 1 };
+    for (const size_t size : truncatedSizes) {
+        writeFile(path, content.substr(0, size));
+        DeviceMetadata read = key(0x0412, "3.1.4");
+        CHECK(MetadataFile::read(directory, read) == MetadataFile::ReadResult::DROPPED);
+        CHECK(!exists(path));
+        CHECK(read.buttonTypes.empty() && !read.settingSchema);
+    }
+
+    // A flipped bit in the header or the payload (caught by the header checks or the CRC):
+    const size_t flippedBytes[] = { 0, 5, content.size() / 2, content.size() - 1 };
+    for (const size_t index : flippedBytes) {
+        std::string corrupt = content;
+        corrupt[index] ^= 0x10;
+        writeFile(path, corrupt);
+        DeviceMetadata read = key(0x0412, "3.1.4");
+        CHECK(MetadataFile::read(directory, read) == MetadataFile::ReadResult::DROPPED);
+        CHECK(!exists(path));
+    }
+
+    // Rebuilt by the next write:
+    CHECK(MetadataFile::write(directory, written, 1024 * 1024).written);
+    DeviceMetadata read = key(0x0412, "3.1.4");
+    CHECK(MetadataFile::read(directory, read) == MetadataFile::ReadResult::READ);
+    CHECK(sameMetadata(written, read));
+    std::remove(path.c_str());
+}
+
+static void testRejectsWrongKey(const std::string& directory) {
+    // A file name hash collision - another key's (intact) file at the path of the key read:
+    const DeviceMetadata other = sample(0x0412, "3.1.4");
+    CHECK(MetadataFile::write(directory, other, 1024 * 1024).written);
+    const std::string otherPath = MetadataFile::path(directory, other);
+
+    const char * const otherVersions[] = { "3.1.5", nullptr };
+    for (const char * const version : otherVersions) {
+        DeviceMetadata wanted = version ? key(0x0412, version) : key(0x0412, "3.1.4");
+        if (!version) {
+            wanted.libraryVersion = "1.2.4"; // Same firmware, other libjabra version.
+        }
+        const std::string wantedPath = MetadataFile::path(directory, wanted);
+        CHECK(wantedPath != otherPath);
+        writeFile(wantedPath, readFile(otherPath));
+
+        CHECK(MetadataFile::read(directory, wanted) == MetadataFile::ReadResult::DROPPED);
+        CHECK(wanted.capabilities.features.empty() && wanted.buttonTypes.empty() && !wanted.settingSchema);
+        CHECK(!exists(wantedPath));
+        CHECK(exists(otherPath));
+    }
+
+    // Another product ID:
+    DeviceMetadata wanted = key(0x0413, "3.1.4");
+    const std::string wantedPath = MetadataFile::path(directory, wanted);
+    writeFile(wantedPath, readFile(otherPath));
+    CHECK(MetadataFile::read(directory, wanted) == MetadataFile::ReadResult::DROPPED);
+    CHECK(!exists(wantedPath));
+
+    std::remove(otherPath.c_str());
+}
+
+static void testEvictsLeastRecentlyUsed(const std::string& directory) {
+    // Files of about the same size, last used long ago in this order (mtime, as updated by each read):
+    std::vector<DeviceMetadata> files;
+    for (unsigned short productId = 1; productId <= 4; ++productId) {
+        files.push_back(sample(productId, "1.0.0"));
+        CHECK(MetadataFile::write(directory, files.back(), 1024 * 1024).written);
+        setLastUsed(MetadataFile::path(directory, files.back()), 1000000 + productId * 100);
+    }
+    const uint64_t fileSize = readFile(MetadataFile::path(directory, files[0])).size();
+
+    // Reading marks a file as recently used:
+    DeviceMetadata read = key(1, "1.0.0");
+    CHECK(MetadataFile::read(directory, read) == MetadataFile::ReadResult::READ);
+
+    // Room for three of the five files - the least recently used (2 and 3) are evicted, not the one just written:
+    const DeviceMetadata newest = sample(5, "1.0.0");
+    MetadataFile::WriteResult result = MetadataFile::write(directory, newest, 3 * fileSize + fileSize / 2);
+    CHECK(result.written);
+    CHECK(result.evicted == 2);
+    CHECK(result.fileCount == 3);
+    CHECK(result.sizeBytes <= 3 * fileSize + fileSize / 2);
+    CHECK(exists(MetadataFile::path(directory, files[0])));
+    CHECK(!exists(MetadataFile::path(directory, files[1])));
+    CHECK(!exists(MetadataFile::path(directory, files[2])));
+    CHECK(exists(MetadataFile::path(directory, files[3])));
+    CHECK(exists(MetadataFile::path(directory, newest)));
+
+    // A limit below the size of a single file still keeps the file just written:
+    result = MetadataFile::write(directory, newest, 1);
+    CHECK(result.written);
+    CHECK(result.evicted == 2);
+    CHECK(result.fileCount == 1);
+    CHECK(exists(MetadataFile::path(directory, newest)));
+
+    std::remove(MetadataFile::path(directory, newest).c_str());
+}
+
+int main() {
+    const std::string directory = testDirectory();
+    if (!MetadataFile::createDirectory(directory)) {
+        std::fprintf(stderr, "metadatafile: could not create %s\n", directory.c_str());
+        return 1;
+    }
+
+    testRoundTrip(directory);
+    testDropsDamagedFiles(directory);
+    testRejectsWrongKey(directory);
+    testEvictsLeastRecentlyUsed(directory);
+
+    if (rmdir(directory.c_str()) != 0) {
+        std::fprintf(stderr, "metadatafile: files left in %s\n", directory.c_str());
+        ++failures;
+    }
+
+    if (failures > 0) {
+        std::fprintf(stderr, "metadatafile: %d checks failed\n", failures);
+        return 1;
+    }
+    std::printf("metadatafile: all tests passed\n");
+    return 0;
+}
@@ -0,0 +1,159 @@
+/**
+ * Tests of util::MpscRing, including the overflow handling of EventChannel::enqueue: Events with the DROP_OLDEST
+ * policy are pushed as evictable with pushOrEvict(), all others with push().
+ *
+ * Needs neither node nor libjabra. Build and run with "npm run test-native".
+ */
+
+#include "../main/mpscring.h"
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+static int failures = 0;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++failures; \
+        } \
+    } while (false)
+
+// Stand-in for PendingEvent:
+struct Event {
+    bool dropOldest; // Overflow policy of the event type.
+    int id;
+};
+
+static bool enqueue(util::MpscRing<Event>& ring, Event event, std::vector<Event>& evicted) {
+    if (event.dropOldest) {
+        return ring.pushOrEvict(event, 4, [&evicted](Event& oldest) { evicted.push_back(oldest); });
+    }
+    return ring.push(event);
+}
+
+static std::vector<Event> drain(util::MpscRing<Event>& ring) {
+    std::vector<Event> events;
+    Event event;
+    while (ring.pop(event)) {
+        events.push_back(event);
+    }
+    return events;
+}
+
+static void testFifo() {
+    util::MpscRing<Event> ring(3);
+    CHECK(ring.getCapacity() == 4);
+
+    Event event = { false, 0 };
+    CHECK(!ring.pop(event));
+    for (int id = 1; id <= 4; ++id) {
+        event.id = id;
+        CHECK(ring.push(event));
+    }
+    event.id = 5;
+    CHECK(!ring.push(event));
+
+    const std::vector<Event> events = drain(ring);
+    CHECK(events.size() == 4);
+    for (size_t i = 0; i < events.size(); ++i) {
+        CHECK(events[i].id == (int)i + 1);
+    }
+}
+
+static void testDropOldestEvictsOnlyDropOldest() {
+    util::MpscRing<Event> ring(8);
+    std::vector<Event> evicted;
+
+    // Status events (DROP_OLDEST) mixed with button/lifecycle events (DROP_NEWEST):
+    const bool policies[8] = { true, true, false, true, false, false, true, false };
+    for (int id = 0; id < 8; ++id) {
+        CHECK(enqueue(ring, Event { policies[id], id }, evicted));
+    }
+
+    // The oldest two are status events, so newer status events take their room:
+    CHECK(enqueue(ring, Event { true, 100 }, evicted));
+    CHECK(enqueue(ring, Event { true, 101 }, evicted));
+    CHECK(evicted.size() == 2 && evicted[0].id == 0 && evicted[1].id == 1);
+
+    // Now a button event is the oldest, so new events of either policy are dropped instead:
+    CHECK(!enqueue(ring, Event { true, 102 }, evicted));
+    CHECK(!enqueue(ring, Event { false, 103 }, evicted));
+    CHECK(evicted.size() == 2);
+
+    const std::vector<Event> events = drain(ring);
+    const int expected[8] = { 2, 3, 4, 5, 6, 7, 100, 101 };
+    CHECK(events.size() == 8);
+    for (size_t i = 0; i < events.size() && i < 8; ++i) {
+        CHECK(events[i].id == expected[i]);
+    }
+}
+
+static void testConcurrentProducersNeverEvictDropNewest() {
+    // Producers flood a small ring with status events, while others post events that must not be evicted:
+    const int producerCount = 4;
+    const int eventsPerProducer = 20000;
+    util::MpscRing<Event> ring(16);
+    std::atomic<int> queuedDropNewest(0);
+    std::atomic<int> evictedDropNewest(0);
+    std::atomic<bool> producing(true);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producerCount; ++p) {
+        producers.emplace_back([&ring, &queuedDropNewest, &evictedDropNewest, p]() {
+            const bool dropOldest = p % 2 == 0;
+            for (int i = 0; i < eventsPerProducer; ++i) {
+                Event event = { dropOldest, i };
+                if (dropOldest) {
+                    ring.pushOrEvict(event, 4, [&evictedDropNewest](Event& oldest) {
+                        if (!oldest.dropOldest) {
+                            ++evictedDropNewest;
+                        }
+                    });
+                } else if (ring.push(event)) {
+                    ++queuedDropNewest;
+                }
+            }
+        });
+    }
+
+    int poppedDropNewest = 0;
+    std::thread consumer([&ring, &producing, &poppedDropNewest]() {
+        Event event;
+        for (;;) {
+            const bool done = !producing.load();
+            if (ring.pop(event)) {
+                if (!event.dropOldest) {
+                    ++poppedDropNewest;
+                }
+            } else if (done) {
+                break;
+            }
+        }
+    });
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    producing.store(false);
+    consumer.join();
+
+    CHECK(evictedDropNewest.load() == 0);
+    CHECK(poppedDropNewest == queuedDropNewest.load());
+}
+
+int main() {
+    testFifo();
+    testDropOldestEvictsOnlyDropOldest();
+    testConcurrentProducersNeverEvictDropNewest();
+
+    if (failures > 0) {
+        std::fprintf(stderr, "mpscring: %d checks failed\n", failures);
+        return 1;
+    }
+    std::printf("mpscring: all tests passed\n");
+    return 0;
+}